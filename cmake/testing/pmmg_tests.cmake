@@ -49,6 +49,16 @@ IF( BUILD_TESTING )
       endforeach()
     endforeach()
 
+    # balance the interface displacement by the predicted remeshing work
+    foreach( NP 2 4 6 )
+      add_test( NAME cube-unit-coarse-dual_density-workwgt-${NP}
+        COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} ${NP} $<TARGET_FILE:${PROJECT_NAME}>
+        ${CI_DIR}/Cube/cube-unit-coarse.mesh
+        -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+        -out ${CI_DIR_RESULTS}/dual_density-workwgt-${NP}-out.mesh
+        -work-wgt -mesh-size ${mesh_size} ${myargs} )
+    endforeach()
+
     # remesh a non constant anisotropic test case: a torus with a planar shock
     # on 1,2,4,6,8 processors
     foreach( TYPE anisotropic-test )
@@ -98,7 +108,12 @@ IF( BUILD_TESTING )
       "-hgrad"
       "-hmax"
       "-nr"
-      "-ar" )
+      "-ar"
+      "-nthreads"
+      "-work-wgt"
+      "-auto-tune"
+      "-sfc-renum"
+      "-lb" )
 
     SET ( VAL
       "5"
@@ -108,7 +123,12 @@ IF( BUILD_TESTING )
       "-1"
       "0.05"
       ""
-      "10" )
+      "10"
+      "4"
+      ""
+      ""
+      "0"
+      "sfc" )
 
     SET ( NAME
       "v5"
@@ -118,7 +138,12 @@ IF( BUILD_TESTING )
       "nohgrad"
       "hmax0.05"
       "nr"
-      "ar10" )
+      "ar10"
+      "nthreads4"
+      "workwgt"
+      "autotune"
+      "nosfcrenum"
+      "lbsfc" )
 
     SET ( MESH_SIZE
       "16384"
@@ -128,6 +153,11 @@ IF( BUILD_TESTING )
       "16384"
       "16384"
       "16384"
+      "16384"
+      "16384"
+      "16384"
+      "16384"
+      "16384"
       "16384" )
 
     LIST(LENGTH OPTION nbTests_tmp)
@@ -207,6 +237,73 @@ IF( BUILD_TESTING )
       ${myargs}
       )
 
+    # collective reading of a centralized binary mesh
+    add_test( NAME parallel_input-gen
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 2 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.mesh
+      -out ${CI_DIR_RESULTS}/parallel-input-cube.meshb
+      -mesh-size ${mesh_size} ${myargs}
+      )
+    add_test( NAME parallel_input-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      -parallel-input
+      ${CI_DIR_RESULTS}/parallel-input-cube.meshb
+      -out ${CI_DIR_RESULTS}/parallel-input-cube-4-out.meshb
+      -hsiz 0.05 ${myargs}
+      )
+    set_tests_properties(parallel_input-4 PROPERTIES DEPENDS parallel_input-gen )
+
+    # collective reading without metric file next to the mesh
+    add_test( NAME parallel_input-nosol-copy
+      COMMAND ${CMAKE_COMMAND} -E copy
+      ${CI_DIR_RESULTS}/parallel-input-cube.meshb
+      ${CI_DIR_RESULTS}/parallel-input-nosol-cube.meshb
+      )
+    set_tests_properties(parallel_input-nosol-copy PROPERTIES DEPENDS parallel_input-gen )
+    add_test( NAME parallel_input-nosol-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      -parallel-input
+      ${CI_DIR_RESULTS}/parallel-input-nosol-cube.meshb
+      -out ${CI_DIR_RESULTS}/parallel-input-nosol-cube-4-out.meshb
+      -hsiz 0.05 ${myargs}
+      )
+    set_tests_properties(parallel_input-nosol-4 PROPERTIES DEPENDS parallel_input-nosol-copy )
+
+    # fields are not read in parallel: centralized reading is used instead
+    add_test( NAME parallel_input-field-gen
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 1 $<TARGET_FILE:${PROJECT_NAME}>
+      -niter 0
+      ${CI_DIR}/Cube/cube-unit-coarse.mesh
+      -out ${CI_DIR_RESULTS}/parallel-input-field-cube.meshb
+      ${myargs}
+      )
+    add_test( NAME parallel_input-field-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      -parallel-input
+      ${CI_DIR_RESULTS}/parallel-input-field-cube.meshb
+      -field ${CI_DIR}/Interpolation/cube-unit-coarse-field.sol
+      -out ${CI_DIR_RESULTS}/parallel-input-field-cube-4-out.meshb
+      ${myargs}
+      )
+    set_tests_properties(parallel_input-field-4 PROPERTIES DEPENDS parallel_input-field-gen )
+
+    # collective writing of a centralized binary mesh (read back in parallel)
+    add_test( NAME parallel_output-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      -parallel-output
+      ${CI_DIR}/Cube/cube-unit-coarse.mesh
+      -out ${CI_DIR_RESULTS}/parallel-output-cube-4-out.meshb
+      -hsiz 0.05 ${myargs}
+      )
+    add_test( NAME parallel_output-reread-2
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 2 $<TARGET_FILE:${PROJECT_NAME}>
+      -parallel-input -niter 0
+      ${CI_DIR_RESULTS}/parallel-output-cube-4-out.meshb
+      -out ${CI_DIR_RESULTS}/parallel-output-cube-reread-out.mesh
+      ${myargs}
+      )
+    set_tests_properties(parallel_output-reread-2 PROPERTIES DEPENDS parallel_output-4 )
+
     ###############################################################################
     #####
     #####        Tests fields interpolation with or without metric
@@ -240,6 +337,56 @@ IF( BUILD_TESTING )
       -out ${CI_DIR_RESULTS}/InterpolationFields-refinement-4-out.mesh
       -field ${CI_DIR}/Interpolation/cube-unit-coarse-field.sol ${myargs} )
 
+    ###############################################################################
+    #####
+    #####        Tests adaptive number of iterations
+    #####
+    ###############################################################################
+    add_test( NAME AdaptiveNiter-withMet-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Interpolation/coarse.mesh
+      -out ${CI_DIR_RESULTS}/AdaptiveNiter-withMet-4-out.mesh
+      -sol ${CI_DIR}/Interpolation/field3_iso-coarse.sol
+      -adaptive-niter -niter-max 5 -v 5
+      -mesh-size 60000 ${myargs} )
+    # the convergence criteria must be evaluated between the iterations
+    set_property( TEST AdaptiveNiter-withMet-4
+      PROPERTY PASS_REGULAR_EXPRESSION "unadapted edges .*worst quality" )
+    # the pass regex hides the exit status: catch the failures in the output
+    set_property( TEST AdaptiveNiter-withMet-4
+      PROPERTY FAIL_REGULAR_EXPRESSION "## Error|## ERROR|Abort|Segmentation" )
+
+    add_test( NAME SkipAdapted-withMet-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Interpolation/coarse.mesh
+      -out ${CI_DIR_RESULTS}/SkipAdapted-withMet-4-out.mesh
+      -sol ${CI_DIR}/Interpolation/field3_iso-coarse.sol
+      -skip-adapted -niter 5 -v 5
+      -mesh-size 60000 ${myargs} )
+    # some groups must be skipped once the mesh is adapted
+    set_property( TEST SkipAdapted-withMet-4
+      PROPERTY PASS_REGULAR_EXPRESSION "[1-9][0-9]*/[0-9]+ already adapted groups not remeshed" )
+    set_property( TEST SkipAdapted-withMet-4
+      PROPERTY FAIL_REGULAR_EXPRESSION "## Error|## ERROR|Abort|Segmentation" )
+
+    add_test( NAME CheckComm-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse
+      -out ${CI_DIR_RESULTS}/CheckComm-cube-unit-coarse-4-out.mesh
+      -hsiz 0.05 -check-comm ${myargs} )
+
+    ###############################################################################
+    #####
+    #####        Tests performance trace
+    #####
+    ###############################################################################
+    add_test( NAME Trace-InterpolationFields-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse
+      -out ${CI_DIR_RESULTS}/Trace-InterpolationFields-4-out.mesh
+      -field ${CI_DIR}/Interpolation/cube-unit-coarse-field.sol
+      -trace ${CI_DIR_RESULTS}/Trace-InterpolationFields-4.json ${myargs} )
+
     ###############################################################################
     #####
     #####        Tests distributed surface adaptation
@@ -536,6 +683,28 @@ IF( BUILD_TESTING )
 
     ENDFOREACH ( )
 
+    # Strided mesh arrays setters/getters round trip (a mismatch aborts)
+    ADD_LIBRARY_TEST ( libparmmg_centralized_mesh_arrays
+      ${PROJECT_SOURCE_DIR}/libexamples/adaptation_example0/sequential_IO/manual_IO/mesh_arrays.c
+      "copy_pmmg_headers" "${lib_name}" )
+
+    ADD_TEST ( NAME libparmmg_centralized_mesh_arrays-1
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 1
+      $<TARGET_FILE:libparmmg_centralized_mesh_arrays>
+      ${PROJECT_SOURCE_DIR}/libexamples/adaptation_example0/cube.mesh
+      ${CI_DIR_RESULTS}/io-seq-mesh-arrays-cube.o.mesh )
+
+    IF ( MPI_Fortran_FOUND )
+      ADD_LIBRARY_TEST ( libparmmg_fortran_centralized_mesh_arrays
+        ${PROJECT_SOURCE_DIR}/libexamples/adaptation_example0/sequential_IO/manual_IO/mesh_arrays.F90
+        "copy_pmmg_headers" "${lib_name}" )
+
+      ADD_TEST ( NAME libparmmg_fortran_centralized_mesh_arrays-1
+        COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 1
+        $<TARGET_FILE:libparmmg_fortran_centralized_mesh_arrays>
+        ${PROJECT_SOURCE_DIR}/libexamples/adaptation_example0/cube.mesh )
+    ENDIF ( )
+
     # Distributed lib test
     ADD_LIBRARY_TEST ( libparmmg_distributed_external_gen_mesh
       ${PROJECT_SOURCE_DIR}/libexamples/adaptation_example0/parallel_IO/external_IO/gen_distributedMesh.c
@@ -590,6 +759,20 @@ IF( BUILD_TESTING )
       ENDFOREACH()
     ENDFOREACH()
 
+    # Successive adaptations in session mode
+    SET( test_name libparmmg_distributed_example2 )
+    ADD_LIBRARY_TEST ( ${test_name}
+      ${PROJECT_SOURCE_DIR}/libexamples/adaptation_example2/main.c
+      "copy_pmmg_headers" "${lib_name}" )
+
+    FOREACH( NP 4 )
+      ADD_TEST ( NAME  libparmmg_distributed_example2_session-${NP}
+        COMMAND  ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} ${NP}
+        $<TARGET_FILE:${test_name}>
+        ${PROJECT_SOURCE_DIR}/libexamples/adaptation_example1/wave
+        ${CI_DIR_RESULTS}/io-par_session_wave-${NP} )
+    ENDFOREACH()
+
 
     #----------------- Tests using the library in the testparmmg repos
     IF ( NOT ONLY_LIBRARY_TESTS )
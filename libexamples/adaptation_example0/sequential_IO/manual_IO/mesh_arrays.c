@@ -0,0 +1,174 @@
+/**
+ * Example of use of the parmmg library (strided mesh arrays).
+ *
+ * This example gets the vertices and tetrahedra of a mesh with
+ * PMMG_Get_meshArrays using an interleaved layout, sets them into a new
+ * parmesh with PMMG_Set_meshArrays using a component-major layout, reads them
+ * back with a padded layout and checks that the round trip is exact. The
+ * mesh built from the arrays is then adapted and saved.
+ *
+ * \author Algiane Froehly (InriaSoft)
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Include the parmmg library hader file */
+// if the header file is in the "include" directory
+// #include "libparmmg.h"
+// if the header file is in "include/parmmg"
+#include "parmmg/libparmmg.h"
+
+/** Stride of the padded layout used to read back the arrays */
+#define PAD_STRIDE 5
+
+int main(int argc,char *argv[]) {
+  PMMG_pParMesh   parmesh,parmesh2;
+  int             ier,rank,k,i,nerr;
+  int             np,ne,nprism,nt,nquad,na;
+  int             *vref,*vref3,*tetra,*tref,*tetra2,*tref2,*tetra3,*tref3;
+  double          *vert,*vert2,*vert3;
+  char            *filename,*fileout;
+
+  MPI_Init( &argc, &argv );
+  MPI_Comm_rank( MPI_COMM_WORLD, &rank );
+
+  if ( !rank ) fprintf(stdout,"  -- TEST PARMMGLIB: STRIDED MESH ARRAYS\n");
+
+  if ( argc!=3 ) {
+    if ( !rank ) printf(" Usage: %s filein fileout\n",argv[0]);
+    MPI_Finalize();
+    return 1;
+  }
+  filename = argv[1];
+  fileout  = argv[2];
+
+  /** ------------------------------ STEP   I -------------------------- */
+  /** 1) Load the reference mesh */
+  parmesh = NULL;
+  PMMG_Init_parMesh(PMMG_ARG_start,
+                    PMMG_ARG_ppParMesh,&parmesh,
+                    PMMG_ARG_pMesh,PMMG_ARG_pMet,
+                    PMMG_ARG_dim,3,PMMG_ARG_MPIComm,MPI_COMM_WORLD,
+                    PMMG_ARG_end);
+
+  if ( PMMG_loadMesh_centralized(parmesh,filename) != 1 ) {
+    MPI_Abort(MPI_COMM_WORLD,1);
+  }
+
+  if ( PMMG_Get_meshSize(parmesh,&np,&ne,&nprism,&nt,&nquad,&na) != 1 ) {
+    MPI_Abort(MPI_COMM_WORLD,1);
+  }
+
+  /** 2) Get the arrays with an interleaved layout (x0 y0 z0 x1 y1 z1 ...) */
+  vert   = (double*)malloc(3*np*sizeof(double));
+  vert2  = (double*)malloc(3*np*sizeof(double));
+  vert3  = (double*)malloc(PAD_STRIDE*np*sizeof(double));
+  vref   = (int*)malloc(np*sizeof(int));
+  vref3  = (int*)malloc(np*sizeof(int));
+  tetra  = (int*)malloc(4*ne*sizeof(int));
+  tetra2 = (int*)malloc(4*ne*sizeof(int));
+  tetra3 = (int*)malloc(PAD_STRIDE*ne*sizeof(int));
+  tref   = (int*)malloc(ne*sizeof(int));
+  tref2  = (int*)malloc(ne*sizeof(int));
+  tref3  = (int*)malloc(ne*sizeof(int));
+  if ( !vert || !vert2 || !vert3 || !vref || !vref3
+       || !tetra || !tetra2 || !tetra3 || !tref || !tref2 || !tref3 ) {
+    perror("  ## Memory problem: malloc");
+    MPI_Abort(MPI_COMM_WORLD,2);
+  }
+
+  if ( PMMG_Get_meshArrays(parmesh,vert,3,1,vref,tetra,4,1,tref) != 1 ) {
+    MPI_Abort(MPI_COMM_WORLD,1);
+  }
+
+  /** 3) Convert them to a component-major layout (x0 x1 ... y0 y1 ...) */
+  for ( k=0; k<np; k++ ) {
+    for ( i=0; i<3; i++ ) vert2[i*np+k] = vert[3*k+i];
+  }
+  for ( k=0; k<ne; k++ ) {
+    for ( i=0; i<4; i++ ) tetra2[i*ne+k] = tetra[4*k+i];
+    tref2[k] = tref[k];
+  }
+
+  /** ------------------------------ STEP  II -------------------------- */
+  /** 1) Set the component-major arrays into a new parmesh */
+  parmesh2 = NULL;
+  PMMG_Init_parMesh(PMMG_ARG_start,
+                    PMMG_ARG_ppParMesh,&parmesh2,
+                    PMMG_ARG_pMesh,PMMG_ARG_pMet,
+                    PMMG_ARG_dim,3,PMMG_ARG_MPIComm,MPI_COMM_WORLD,
+                    PMMG_ARG_end);
+
+  if ( PMMG_Set_meshSize(parmesh2,np,ne,0,0,0,0) != 1 ) {
+    MPI_Abort(MPI_COMM_WORLD,1);
+  }
+  if ( PMMG_Set_meshArrays(parmesh2,vert2,1,np,vref,tetra2,1,ne,tref2) != 1 ) {
+    MPI_Abort(MPI_COMM_WORLD,1);
+  }
+
+  /** 2) Get them back with a padded layout and compare */
+  if ( PMMG_Get_meshArrays(parmesh2,vert3,PAD_STRIDE,1,vref3,
+                           tetra3,PAD_STRIDE,1,tref3) != 1 ) {
+    MPI_Abort(MPI_COMM_WORLD,1);
+  }
+
+  nerr = 0;
+  for ( k=0; k<np; k++ ) {
+    for ( i=0; i<3; i++ ) {
+      if ( vert3[PAD_STRIDE*k+i] != vert[3*k+i] ) ++nerr;
+    }
+    if ( vref3[k] != vref[k] ) ++nerr;
+  }
+  for ( k=0; k<ne; k++ ) {
+    for ( i=0; i<4; i++ ) {
+      if ( tetra3[PAD_STRIDE*k+i] != tetra[4*k+i] ) ++nerr;
+    }
+    if ( tref3[k] != tref[k] ) ++nerr;
+  }
+
+  if ( nerr ) {
+    fprintf(stderr,"  ## Error: %d values differ after the strided round"
+            " trip.\n",nerr);
+    MPI_Abort(MPI_COMM_WORLD,1);
+  }
+  if ( !rank ) fprintf(stdout,"  -- STRIDED ROUND TRIP OK (%d vertices,"
+                       " %d tetrahedra)\n",np,ne);
+
+  free(vert);   free(vert2);  free(vert3);  free(vref);   free(vref3);
+  free(tetra);  free(tetra2); free(tetra3);
+  free(tref);   free(tref2);  free(tref3);
+
+  PMMG_Free_all(PMMG_ARG_start,
+                PMMG_ARG_ppParMesh,&parmesh,
+                PMMG_ARG_end);
+
+  /** ------------------------------ STEP III -------------------------- */
+  /** The mesh built from the arrays must be usable by the remesher */
+  if ( !PMMG_Set_iparameter( parmesh2, PMMG_IPARAM_niter, 1 ) ) {
+    MPI_Abort(MPI_COMM_WORLD,1);
+  }
+  ier = PMMG_parmmglib_centralized(parmesh2);
+
+  if ( ier != PMMG_STRONGFAILURE ) {
+    if ( PMMG_saveMesh_centralized(parmesh2,fileout) != 1 ) {
+      fprintf(stdout,"UNABLE TO SAVE MESH\n");
+      ier = PMMG_STRONGFAILURE;
+    }
+  }
+  else {
+    fprintf(stdout,"BAD ENDING OF PARMMGLIB: UNABLE TO SAVE MESH\n");
+  }
+
+  PMMG_Free_all(PMMG_ARG_start,
+                PMMG_ARG_ppParMesh,&parmesh2,
+                PMMG_ARG_end);
+
+  MPI_Finalize();
+
+  return ier;
+}
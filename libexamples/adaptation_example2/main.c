@@ -0,0 +1,167 @@
+/**
+ * Example of use of the parmmg library in session mode with a distributed
+ * input mesh (successive adaptations to a moving metric)
+ *
+ * The distributed mesh and its interfaces are loaded once. Each adaptation
+ * step only provides the new metric at the vertices of the mesh adapted by the
+ * previous step: the partition, the communicators and the geometric analysis
+ * are kept by the library between the calls.
+ *
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/** Include the parmmg and mmg3d library header file */
+#include "libparmmg.h"
+#include "libmmg3d.h"
+
+/** Number of adaptation steps of the session */
+#define NSTEP 3
+
+/**
+ * \param c vertex coordinates.
+ * \param istep adaptation step.
+ *
+ * \return the wanted edge length at the vertex: the mesh is refined near a
+ * plane that moves along the x axis with the steps.
+ *
+ */
+static double size_at_vertex( double *c,int istep ) {
+  double xc;
+
+  xc = 0.25 + 0.25*istep;
+
+  return 0.06 + 0.24*fabs(c[0]-xc);
+}
+
+int main(int argc,char *argv[]) {
+  PMMG_pParMesh   parmesh;
+  int             ierlib,rank,istep,k;
+  int             nVertices,nTetrahedra,nTriangles,nEdges;
+  double          *vert,*met;
+  char            *filename,*fileout;
+
+  MPI_Init( &argc, &argv );
+  MPI_Comm_rank( MPI_COMM_WORLD, &rank );
+
+  if ( !rank ) fprintf(stdout,"  -- TEST PARMMGLIB: successive adaptations in session mode\n");
+
+  if ( argc!=3 ) {
+    if ( !rank ) printf(" Usage: %s filein fileout\n",argv[0]);
+    MPI_Finalize();
+    return 1;
+  }
+
+  filename = argv[1];
+  fileout  = argv[2];
+
+  /** ------------------------------ STEP   I -------------------------- */
+  /** 1) Initialisation of th parmesh structures */
+  parmesh = NULL;
+
+  PMMG_Init_parMesh(PMMG_ARG_start,
+                    PMMG_ARG_ppParMesh,&parmesh,
+                    PMMG_ARG_pMesh,PMMG_ARG_pMet,
+                    PMMG_ARG_dim,3,PMMG_ARG_MPIComm,MPI_COMM_WORLD,
+                    PMMG_ARG_end);
+
+  /** 2) Load mesh and communicators (only once for the whole session) */
+  if ( !PMMG_loadMesh_distributed(parmesh,filename) ) {
+    fprintf ( stderr, "Error: Unable to load %s distributed mesh.\n",filename);
+    MPI_Finalize();
+    exit(EXIT_FAILURE);
+  }
+
+  /** 3) Parameters: keep the parallel structures between the library calls */
+  if( !PMMG_Set_iparameter( parmesh, PMMG_IPARAM_session, 1 ) ) {
+    MPI_Finalize();
+    exit(EXIT_FAILURE);
+  }
+
+  if( !PMMG_Set_iparameter( parmesh, PMMG_IPARAM_niter, 2 ) ) {
+    MPI_Finalize();
+    exit(EXIT_FAILURE);
+  }
+
+  if( !PMMG_Set_iparameter( parmesh, PMMG_IPARAM_verbose, 3 ) ) {
+    MPI_Finalize();
+    exit(EXIT_FAILURE);
+  }
+
+  /** ------------------------------ STEP II ---------------------------- */
+  /** Adaptation steps */
+  ierlib = PMMG_SUCCESS;
+  for ( istep=0; istep<NSTEP; ++istep ) {
+
+    /** 1) Get the vertices of the current mesh (input mesh at first step,
+     * mesh adapted by the previous step otherwise) */
+    if ( PMMG_Get_meshSize(parmesh,&nVertices,&nTetrahedra,NULL,&nTriangles,NULL,
+                           &nEdges) !=1 ) {
+      ierlib = PMMG_STRONGFAILURE;
+      break;
+    }
+
+    vert = (double*)calloc(3*nVertices,sizeof(double));
+    met  = (double*)calloc(nVertices,sizeof(double));
+    if ( !vert || !met ) {
+      perror("  ## Memory problem: calloc");
+      MPI_Finalize();
+      exit(EXIT_FAILURE);
+    }
+
+    if ( PMMG_Get_vertices(parmesh,vert,NULL,NULL,NULL) != 1 ) {
+      ierlib = PMMG_STRONGFAILURE;
+      free(vert);
+      free(met);
+      break;
+    }
+
+    /** 2) Set the metric of the step */
+    for ( k=0; k<nVertices; ++k ) {
+      met[k] = size_at_vertex(&vert[3*k],istep);
+    }
+
+    if ( PMMG_Set_metSize(parmesh,MMG5_Vertex,nVertices,MMG5_Scalar) != 1 ||
+         PMMG_Set_scalarMets(parmesh,met) != 1 ) {
+      ierlib = PMMG_STRONGFAILURE;
+      free(vert);
+      free(met);
+      break;
+    }
+    free(vert);
+    free(met);
+
+    /** 3) Remesh */
+    ierlib = PMMG_parmmglib_distributed( parmesh );
+
+    if ( ierlib != PMMG_SUCCESS ) {
+      fprintf(stdout,"BAD ENDING OF PARMMGLIB AT STEP %d\n",istep);
+      break;
+    }
+  }
+
+  /** ------------------------------ STEP III --------------------------- */
+  /** Save the mesh adapted by the last step */
+  if ( ierlib != PMMG_STRONGFAILURE ) {
+    if ( PMMG_saveMesh_distributed(parmesh,fileout) != 1 ) {
+      fprintf(stdout,"UNABLE TO SAVE MESH\n");
+      ierlib = PMMG_STRONGFAILURE;
+    }
+  }
+
+  /** ------------------------------ STEP  IV -------------------------- */
+  /** Free the PMMG5 structures */
+  PMMG_Free_all(PMMG_ARG_start,
+                PMMG_ARG_ppParMesh,&parmesh,
+                PMMG_ARG_end);
+
+  MPI_Finalize();
+
+  return ierlib;
+}
@@ -397,6 +397,11 @@ int PMMG_Set_outputMetName(PMMG_pParMesh parmesh, const char* metout) {
   return ier;
 }
 
+int PMMG_Set_traceName(PMMG_pParMesh parmesh, const char* tracename) {
+
+  return PMMG_Set_name ( parmesh,&parmesh->tracename,tracename,NULL );
+}
+
 void PMMG_Init_parameters(PMMG_pParMesh parmesh,MPI_Comm comm) {
   MMG5_pMesh mesh;
   size_t     mem;
@@ -416,9 +421,22 @@ void PMMG_Init_parameters(PMMG_pParMesh parmesh,MPI_Comm comm) {
   parmesh->info.grps_ratio         = PMMG_GRPS_RATIO;
   parmesh->info.nobalancing        = MMG5_OFF;
   parmesh->info.loadbalancing_mode = PMMG_LOADBALANCING_metis;
+  parmesh->info.itr_ratio          = PMMG_NUL;
   parmesh->info.contiguous_mode    = PMMG_CONTIG_DEF;
   parmesh->info.target_mesh_size   = PMMG_REMESHER_TARGET_MESH_SIZE;
   parmesh->info.metis_ratio        = PMMG_RATIO_MMG_METIS;
+  parmesh->info.nthreads           = PMMG_NTHREADS;
+  parmesh->info.work_wgt           = MMG5_OFF;
+  parmesh->info.parallel_input     = MMG5_OFF;
+  parmesh->info.adaptive_niter     = MMG5_OFF;
+  parmesh->info.niter_max          = PMMG_NITERMAX;
+  parmesh->info.conv_length        = PMMG_CONV_LENGTH;
+  parmesh->info.conv_qual          = PMMG_CONV_QUAL;
+  parmesh->info.skip_adapted       = MMG5_OFF;
+  parmesh->info.check_comm         = MMG5_OFF;
+  parmesh->info.session            = MMG5_OFF;
+  parmesh->info.auto_tune          = MMG5_OFF;
+  parmesh->info.sfc_renum          = MMG5_ON;
   parmesh->info.API_mode           = PMMG_APIDISTRIB_faces;
   parmesh->info.globalNum          = PMMG_NUL;
   parmesh->info.sethmin            = PMMG_NUL;
@@ -471,6 +489,9 @@ int PMMG_Set_meshSize(PMMG_pParMesh parmesh, int np, int ne, int nprism, int nt,
   ier = 1;
   mesh = parmesh->listgrp[0].mesh;
 
+  /* A new mesh is provided: the structures of the session are obsolete */
+  parmesh->session_open = 0;
+
   /* Check input data and set mesh->ne/na/np/nt to the suitable values */
   if ( !MMG3D_setMeshSize_initData(mesh,np,ne,nprism,nt,nquad,na) )
     return 0;
@@ -598,6 +619,74 @@ int PMMG_Set_iparameter(PMMG_pParMesh parmesh, int iparam,int val) {
   case PMMG_IPARAM_niter :
     parmesh->niter = val;
     break;
+  case PMMG_IPARAM_nthreads :
+    if ( val <= 0 ) {
+      fprintf( stdout,
+        "  ## Warning: number of threads must be strictly positive.\n");
+      fprintf(stdout,"  Reset to default value.\n");
+      val = PMMG_NTHREADS;
+    }
+#ifndef USE_OPENMP
+    if ( val > 1 ) {
+      fprintf( stdout,
+        "  ## Warning: ParMmg is compiled without OpenMP: groups will be"
+        " remeshed sequentially.\n");
+      val = PMMG_NTHREADS;
+    }
+#endif
+    parmesh->info.nthreads = val;
+    break;
+  case PMMG_IPARAM_workWgt :
+    parmesh->info.work_wgt = val;
+    break;
+  case PMMG_IPARAM_parallelInput :
+    parmesh->info.parallel_input = val;
+    break;
+  case PMMG_IPARAM_parallelOutput :
+
+    if ( val == 1 ) {
+      parmesh->info.fmtout = PMMG_FMT_ParallelMeditBinary;
+    }
+    else if ( val == 0 && parmesh->info.fmtout == PMMG_FMT_ParallelMeditBinary ) {
+      parmesh->info.fmtout = PMMG_FMT_Centralized;
+    }
+    break;
+  case PMMG_IPARAM_loadBalancingMode :
+    if ( val != PMMG_LOADBALANCING_metis &&
+#ifdef USE_PARMETIS
+         val != PMMG_LOADBALANCING_parmetis &&
+#endif
+         val != PMMG_LOADBALANCING_sfc ) {
+      fprintf(stderr,"\n  ## Error: %s: unexpected load balancing mode (%d).\n",
+              __func__,val);
+      return 0;
+    }
+    parmesh->info.loadbalancing_mode = val;
+    break;
+  case PMMG_IPARAM_adaptiveNiter :
+    parmesh->info.adaptive_niter = val;
+    break;
+  case PMMG_IPARAM_niterMax :
+    parmesh->info.niter_max = val;
+    break;
+  case PMMG_IPARAM_skipAdapted :
+    parmesh->info.skip_adapted = val;
+    break;
+  case PMMG_IPARAM_checkComm :
+    parmesh->info.check_comm = val;
+    break;
+  case PMMG_IPARAM_session :
+    parmesh->info.session = val;
+    if ( !val ) {
+      parmesh->session_open = 0;
+    }
+    break;
+  case PMMG_IPARAM_autoTune :
+    parmesh->info.auto_tune = val;
+    break;
+  case PMMG_IPARAM_sfcRenum :
+    parmesh->info.sfc_renum = val;
+    break;
 
 #ifndef PATTERN
   case PMMG_IPARAM_octree :
@@ -813,6 +902,32 @@ int PMMG_Set_dparameter(PMMG_pParMesh parmesh, int dparam,double val){
   case PMMG_DPARAM_groupsRatio :
     parmesh->info.grps_ratio = val;
     break;
+  case PMMG_DPARAM_convLength :
+    if ( val < 0. || val > 1. ) {
+      fprintf(stderr,"\n  ## Error: %s: fraction of unadapted edges must be"
+              " in [0,1].\n",__func__);
+      return 0;
+    }
+    parmesh->info.conv_length = val;
+    break;
+  case PMMG_DPARAM_convQuality :
+    parmesh->info.conv_qual = val;
+    break;
+  case PMMG_DPARAM_itrRatio :
+    if ( val < 0. ) {
+      fprintf(stderr,"\n  ## Error: %s: the adaptive repartitioning ratio must be"
+              " positive.\n",__func__);
+      return 0;
+    }
+#ifndef USE_PARMETIS
+    if ( val > 0. ) {
+      fprintf(stderr,"\n  ## Error: %s: the adaptive repartitioning needs"
+              " ParMetis (build with USE_PARMETIS).\n",__func__);
+      return 0;
+    }
+#endif
+    parmesh->info.itr_ratio = val;
+    break;
   default :
     fprintf(stderr,"  ## Error: unknown type of parameter\n");
     return 0;
@@ -850,6 +965,100 @@ int PMMG_Set_tetrahedra(PMMG_pParMesh parmesh, int *tetra, int *refs){
   return(MMG3D_Set_tetrahedra(parmesh->listgrp[0].mesh, tetra, refs));
 }
 
+/**
+ * \param verStride distance between two successive points.
+ * \param verCompStride distance between two coordinates of a point.
+ * \param tetStride distance between two successive tetra.
+ * \param tetCompStride distance between two vertices of a tetra.
+ *
+ * \return 1 if the strides of the mesh arrays are valid, 0 otherwise.
+ *
+ */
+static inline
+int PMMG_check_meshArraysStrides( int verStride,int verCompStride,
+                                  int tetStride,int tetCompStride ) {
+
+  if ( verStride < 1 || verCompStride < 1 || tetStride < 1 || tetCompStride < 1 ) {
+    fprintf(stderr,"\n  ## Error: %s: the strides of the mesh arrays must be"
+            " positive.\n",__func__);
+    return 0;
+  }
+  return 1;
+}
+
+int PMMG_Set_meshArrays(PMMG_pParMesh parmesh,
+                        double *vertices,int verStride,int verCompStride,
+                        int *verRefs,
+                        int *tetra,int tetStride,int tetCompStride,
+                        int *tetRefs){
+  MMG5_pMesh  mesh;
+  MMG5_pPoint ppt;
+  MMG5_pTetra pt;
+  double      *c,vol;
+  int         *v,ip,k,i,tmp;
+
+  assert ( parmesh->ngrp == 1 );
+
+  if ( !PMMG_check_meshArraysStrides(verStride,verCompStride,
+                                     tetStride,tetCompStride) ) return 0;
+
+  mesh = parmesh->listgrp[0].mesh;
+
+  if ( (mesh->np && !mesh->point) || (mesh->ne && !mesh->tetra) ) {
+    fprintf(stderr,"\n  ## Error: %s: the mesh size must be set before the"
+            " mesh arrays (PMMG_Set_meshSize).\n",__func__);
+    return 0;
+  }
+
+  /** Vertices (unused until a tetra references them) */
+  for ( ip=1; ip<=mesh->np; ++ip ) {
+    ppt = &mesh->point[ip];
+    c   = &vertices[(size_t)(ip-1)*verStride];
+
+    ppt->c[0] = c[0];
+    ppt->c[1] = c[verCompStride];
+    ppt->c[2] = c[2*(size_t)verCompStride];
+    ppt->ref  = verRefs ? verRefs[ip-1] : 0;
+    ppt->tag  = MG_NUL;
+    ppt->flag = 0;
+    ppt->tmp  = 0;
+  }
+
+  /** Tetrahedra (mesh->xt temporarily counts the reoriented tetra, see
+   * MMG5_warnOrientation) */
+  for ( k=1; k<=mesh->ne; ++k ) {
+    pt = &mesh->tetra[k];
+    v  = &tetra[(size_t)(k-1)*tetStride];
+
+    for ( i=0; i<4; ++i ) {
+      pt->v[i] = v[i*(size_t)tetCompStride];
+      if ( pt->v[i] < 1 || pt->v[i] > mesh->np ) {
+        fprintf(stderr,"\n  ## Error: %s: tetra %d: vertex %d out of range"
+                " [1,%d].\n",__func__,k,pt->v[i],mesh->np);
+        return 0;
+      }
+      mesh->point[pt->v[i]].tag &= ~MG_NUL;
+    }
+    pt->ref  = tetRefs ? MG_ABS(tetRefs[k-1]) : 0;
+    pt->qual = -1;
+
+    vol = MMG5_orvol(mesh->point,pt->v);
+    if ( fabs(vol) <= MMG5_EPSD2 ) {
+      fprintf(stderr,"\n  ## Error: %s: tetra %d has a null volume.\n",
+              __func__,k);
+      return 0;
+    }
+    else if ( vol < 0.0 ) {
+      tmp      = pt->v[2];
+      pt->v[2] = pt->v[3];
+      pt->v[3] = tmp;
+      mesh->xt++;
+    }
+  }
+
+  return 1;
+}
+
 int PMMG_Set_prism(PMMG_pParMesh parmesh, int v0, int v1, int v2,
                    int v3, int v4, int v5, int ref, int pos){
   assert ( parmesh->ngrp == 1 );
@@ -1054,6 +1263,47 @@ int PMMG_Get_tetrahedra(PMMG_pParMesh parmesh, int* tetra,int* refs,
   return(MMG3D_Get_tetrahedra(parmesh->listgrp[0].mesh, tetra, refs, areRequired));
 }
 
+int PMMG_Get_meshArrays(PMMG_pParMesh parmesh,
+                        double *vertices,int verStride,int verCompStride,
+                        int *verRefs,
+                        int *tetra,int tetStride,int tetCompStride,
+                        int *tetRefs){
+  MMG5_pMesh  mesh;
+  MMG5_pPoint ppt;
+  MMG5_pTetra pt;
+  double      *c;
+  int         *v,ip,k,i;
+
+  assert ( parmesh->ngrp == 1 );
+
+  if ( !PMMG_check_meshArraysStrides(verStride,verCompStride,
+                                     tetStride,tetCompStride) ) return 0;
+
+  mesh = parmesh->listgrp[0].mesh;
+
+  for ( ip=1; ip<=mesh->np; ++ip ) {
+    ppt = &mesh->point[ip];
+    c   = &vertices[(size_t)(ip-1)*verStride];
+
+    c[0]                       = ppt->c[0];
+    c[verCompStride]           = ppt->c[1];
+    c[2*(size_t)verCompStride] = ppt->c[2];
+    if ( verRefs ) verRefs[ip-1] = ppt->ref;
+  }
+
+  for ( k=1; k<=mesh->ne; ++k ) {
+    pt = &mesh->tetra[k];
+    v  = &tetra[(size_t)(k-1)*tetStride];
+
+    for ( i=0; i<4; ++i ) {
+      v[i*(size_t)tetCompStride] = pt->v[i];
+    }
+    if ( tetRefs ) tetRefs[k-1] = pt->ref;
+  }
+
+  return 1;
+}
+
 int PMMG_Get_prism(PMMG_pParMesh parmesh, int* v0, int* v1, int* v2,
                    int* v3,int* v4,int* v5,int* ref, int* isRequired){
   assert ( parmesh->ngrp == 1 );
@@ -1150,6 +1400,9 @@ int PMMG_Get_tensorMets(PMMG_pParMesh parmesh, double *mets){
 
 int PMMG_Set_numberOfNodeCommunicators(PMMG_pParMesh parmesh, int next_comm) {
 
+  /* New interfaces are provided: the structures of the session are obsolete */
+  parmesh->session_open = 0;
+
   PMMG_CALLOC(parmesh,parmesh->ext_node_comm,next_comm,PMMG_Ext_comm,
               "allocate ext_comm ",return 0);
   parmesh->next_node_comm = next_comm;
@@ -1162,6 +1415,9 @@ int PMMG_Set_numberOfNodeCommunicators(PMMG_pParMesh parmesh, int next_comm) {
 
 int PMMG_Set_numberOfFaceCommunicators(PMMG_pParMesh parmesh, int next_comm) {
 
+  /* New interfaces are provided: the structures of the session are obsolete */
+  parmesh->session_open = 0;
+
   PMMG_CALLOC(parmesh,parmesh->ext_face_comm,next_comm,PMMG_Ext_comm,
               "allocate ext_comm ",return 0);
   parmesh->next_face_comm = next_comm;
@@ -2450,6 +2706,7 @@ int PMMG_Free_names(PMMG_pParMesh parmesh)
   PMMG_DEL_MEM ( parmesh, parmesh->dispin,char,"dispin" );
   PMMG_DEL_MEM ( parmesh, parmesh->fieldin,char,"fieldin" );
   PMMG_DEL_MEM ( parmesh, parmesh->fieldout,char,"fieldout" );
+  PMMG_DEL_MEM ( parmesh, parmesh->tracename,char,"tracename" );
   return 1;
 }
 
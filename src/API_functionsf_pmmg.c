@@ -190,6 +190,23 @@ FORTRAN_NAME(PMMG_SET_OUTPUTMETNAME,pmmg_set_outputmetname,
   return;
 }
 
+/**
+ * See \ref PMMG_Set_traceName function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SET_TRACENAME,pmmg_set_tracename,
+             (PMMG_pParMesh *parmesh, char* tracename,int* strlen, int* retval),
+             (parmesh,tracename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,tracename,*strlen);
+  tmp[*strlen] = '\0';
+  *retval = PMMG_Set_traceName(*parmesh,tmp);
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
 /**
  * See \ref PMMG_Init_parameters function in \ref libparmmg.h file.
  */
@@ -303,6 +320,20 @@ FORTRAN_NAME(PMMG_SET_TETRAHEDRA,pmmg_set_tetrahedra,
   return;
 }
 
+/**
+ * See \ref PMMG_Set_meshArrays function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SET_MESHARRAYS,pmmg_set_mesharrays,
+             (PMMG_pParMesh *parmesh, double *vertices, int *verStride,
+              int *verCompStride, int *verRefs, int *tetra, int *tetStride,
+              int *tetCompStride, int *tetRefs, int* retval),
+             (parmesh,vertices,verStride,verCompStride,verRefs,tetra,tetStride,
+              tetCompStride,tetRefs,retval)){
+  *retval = PMMG_Set_meshArrays(*parmesh,vertices,*verStride,*verCompStride,
+                                verRefs,tetra,*tetStride,*tetCompStride,tetRefs);
+  return;
+}
+
 /**
  * See \ref PMMG_Set_prism function in \ref libparmmg.h file.
  */
@@ -636,6 +667,20 @@ FORTRAN_NAME(PMMG_GET_TETRAHEDRA,pmmg_get_tetrahedra,
   return;
 }
 
+/**
+ * See \ref PMMG_Get_meshArrays function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_GET_MESHARRAYS,pmmg_get_mesharrays,
+             (PMMG_pParMesh *parmesh, double *vertices, int *verStride,
+              int *verCompStride, int *verRefs, int *tetra, int *tetStride,
+              int *tetCompStride, int *tetRefs, int* retval),
+             (parmesh,vertices,verStride,verCompStride,verRefs,tetra,tetStride,
+              tetCompStride,tetRefs,retval)){
+  *retval = PMMG_Get_meshArrays(*parmesh,vertices,*verStride,*verCompStride,
+                                verRefs,tetra,*tetStride,*tetCompStride,tetRefs);
+  return;
+}
+
 /**
  * See \ref PMMG_Get_prism function in \ref libparmmg.h file.
  */
@@ -1067,6 +1112,25 @@ FORTRAN_NAME(PMMG_LOADMESH_DISTRIBUTED,pmmg_loadmesh_distributed,
   return;
 }
 
+/**
+ * See \ref PMMG_loadMesh_parallel function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_LOADMESH_PARALLEL,pmmg_loadmesh_parallel,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen, retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_loadMesh_parallel(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
 /**
  * See \ref PMMG_loadMet_centralized function in \ref libparmmg.h file.
  */
@@ -1217,6 +1281,25 @@ FORTRAN_NAME(PMMG_SAVEMESH_DISTRIBUTED,pmmg_savemesh_distributed,
   return;
 }
 
+/**
+ * See \ref PMMG_saveMesh_parallel function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SAVEMESH_PARALLEL,pmmg_savemesh_parallel,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_saveMesh_parallel(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
 /**
  * See \ref PMMG_saveMet_centralized function in \ref libparmmg.h file.
  */
@@ -1255,6 +1338,25 @@ FORTRAN_NAME(PMMG_SAVEMET_DISTRIBUTED,pmmg_savemet_distributed,
   return;
 }
 
+/**
+ * See \ref PMMG_saveMet_parallel function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SAVEMET_PARALLEL,pmmg_savemet_parallel,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_saveMet_parallel(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
 /**
  * See \ref PMMG_saveAllSols_centralized function in \ref libparmmg.h file.
  */
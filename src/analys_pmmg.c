@@ -638,14 +638,11 @@ int PMMG_hashNorver_communication_ext( PMMG_pParMesh parmesh,MMG5_pMesh mesh ) {
   PMMG_pExt_comm ext_node_comm;
   double         *rtosend,*rtorecv,*doublevalues;
   int            *itosend,*itorecv,*intvalues;
-  int            k,nitem,color,i,idx,j,pos,d;
-  MPI_Comm       comm;
-  MPI_Status     status;
+  int            k,nitem,i,idx,j,pos,d;
 
   assert( parmesh->ngrp == 1 );
   assert( grp->mesh == mesh );
 
-  comm = parmesh->comm;
   intvalues = parmesh->int_node_comm->intvalues;
   doublevalues = parmesh->int_node_comm->doublevalues;
 
@@ -654,7 +651,6 @@ int PMMG_hashNorver_communication_ext( PMMG_pParMesh parmesh,MMG5_pMesh mesh ) {
   for ( k = 0; k < parmesh->next_node_comm; ++k ) {
     ext_node_comm = &parmesh->ext_node_comm[k];
     nitem         = ext_node_comm->nitem;
-    color         = ext_node_comm->color_out;
 
     itosend = ext_node_comm->itosend;
     itorecv = ext_node_comm->itorecv;
@@ -675,22 +671,16 @@ int PMMG_hashNorver_communication_ext( PMMG_pParMesh parmesh,MMG5_pMesh mesh ) {
         }
       }
     }
-
-    /* Communication */
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,2*nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   itorecv,2*nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   comm,&status),return 0 );
-    MPI_CHECK(
-      MPI_Sendrecv(rtosend,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+3,
-                   rtorecv,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+3,
-                   comm,&status),return 0 );
   }
 
+  /* Communication */
+  if( !PMMG_extComm_halo_exchange( parmesh,parmesh->node_halo,
+                                   parmesh->next_node_comm,1 ) )
+    return 0;
+
   /* Fill internal communicator */
   for ( k = 0; k < parmesh->next_node_comm; ++k ) {
     ext_node_comm = &parmesh->ext_node_comm[k];
-    color = ext_node_comm->color_out;
 
     itorecv = ext_node_comm->itorecv;
     rtorecv = ext_node_comm->rtorecv;
@@ -741,18 +731,14 @@ int PMMG_hashNorver_communication_ext( PMMG_pParMesh parmesh,MMG5_pMesh mesh ) {
 int PMMG_hashNorver_communication( PMMG_pParMesh parmesh ){
   PMMG_pExt_comm ext_edge_comm;
   int            *itosend,*itorecv,*intvalues;
-  int            k,nitem,color,i,idx,j;
-  MPI_Comm       comm;
-  MPI_Status     status;
+  int            k,nitem,i,idx,j;
 
-  comm = parmesh->comm;
   intvalues = parmesh->int_edge_comm->intvalues;
 
   /** Exchange values on the interfaces among procs */
   for ( k = 0; k < parmesh->next_edge_comm; ++k ) {
     ext_edge_comm = &parmesh->ext_edge_comm[k];
     nitem         = ext_edge_comm->nitem;
-    color         = ext_edge_comm->color_out;
 
     itosend = ext_edge_comm->itosend;
     itorecv = ext_edge_comm->itorecv;
@@ -764,14 +750,13 @@ int PMMG_hashNorver_communication( PMMG_pParMesh parmesh ){
         itosend[2*i+j] = intvalues[2*idx+j];
        }
     }
-
-    /* Communication */
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,2*nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   itorecv,2*nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   comm,&status),return 0 );
   }
 
+  /* Communication */
+  if( !PMMG_extComm_halo_exchange( parmesh,parmesh->edge_halo,
+                                   parmesh->next_edge_comm,0 ) )
+    return 0;
+
   /* Fill internal communicator */
   for ( k = 0; k < parmesh->next_edge_comm; ++k ) {
     ext_edge_comm = &parmesh->ext_edge_comm[k];
@@ -799,11 +784,8 @@ int PMMG_hashNorver_communication( PMMG_pParMesh parmesh ){
 int PMMG_hashNorver_communication_nor( PMMG_pParMesh parmesh ) {
   PMMG_pExt_comm ext_node_comm;
   double         *rtosend,*rtorecv,*doublevalues;
-  int            *itosend,*itorecv,*intvalues,k,nitem,color,i,idx,j;
-  MPI_Comm       comm;
-  MPI_Status     status;
+  int            *itosend,*itorecv,*intvalues,k,nitem,i,idx,j;
 
-  comm = parmesh->comm;
   intvalues    = parmesh->int_node_comm->intvalues;
   doublevalues = parmesh->int_node_comm->doublevalues;
 
@@ -811,7 +793,6 @@ int PMMG_hashNorver_communication_nor( PMMG_pParMesh parmesh ) {
   for( k = 0; k < parmesh->next_node_comm; ++k ) {
     ext_node_comm = &parmesh->ext_node_comm[k];
     nitem         = ext_node_comm->nitem;
-    color         = ext_node_comm->color_out;
 
     itosend = ext_node_comm->itosend;
     itorecv = ext_node_comm->itorecv;
@@ -826,18 +807,13 @@ int PMMG_hashNorver_communication_nor( PMMG_pParMesh parmesh ) {
         rtosend[6*i+j] = doublevalues[6*idx+j];
        }
     }
-
-    /* Communication */
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,nitem,MPI_INT,color,MPI_ANALYS_TAG+1,
-                   itorecv,nitem,MPI_INT,color,MPI_ANALYS_TAG+1,
-                   comm,&status),return 0 );
-     MPI_CHECK(
-      MPI_Sendrecv(rtosend,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+2,
-                   rtorecv,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+2,
-                   comm,&status),return 0 );
   }
 
+  /* Communication */
+  if( !PMMG_extComm_halo_exchange( parmesh,parmesh->node_halo,
+                                   parmesh->next_node_comm,1 ) )
+    return 0;
+
   /* Fill internal communicator */
   for( k = 0; k < parmesh->next_node_comm; ++k ) {
     ext_node_comm = &parmesh->ext_node_comm[k];
@@ -1177,12 +1153,9 @@ int PMMG_set_edge_owners( PMMG_pParMesh parmesh,MMG5_HGeom *hpar ) {
   MMG5_pxTetra   pxt;
   MMG5_pEdge     pa;
   int            *intvalues,*itosend,*itorecv;
-  int            idx,k,nitem,color,edg,ia,ie,ifac,ip[2],i;
+  int            idx,k,nitem,edg,ia,ie,ifac,ip[2],i;
   int16_t        tag;
-  MPI_Comm       comm;
-  MPI_Status     status;
 
-  comm   = parmesh->comm;
   assert( parmesh->ngrp == 1 );
   mesh = parmesh->listgrp[0].mesh;
 
@@ -1219,7 +1192,6 @@ int PMMG_set_edge_owners( PMMG_pParMesh parmesh,MMG5_HGeom *hpar ) {
   for ( k = 0; k < parmesh->next_edge_comm; ++k ) {
     ext_edge_comm = &parmesh->ext_edge_comm[k];
     nitem         = ext_edge_comm->nitem;
-    color         = ext_edge_comm->color_out;
 
     itosend = ext_edge_comm->itosend;
     itorecv = ext_edge_comm->itorecv;
@@ -1229,14 +1201,13 @@ int PMMG_set_edge_owners( PMMG_pParMesh parmesh,MMG5_HGeom *hpar ) {
       idx  = ext_edge_comm->int_comm_index[i];
       itosend[i] = intvalues[idx];
     }
-
-    /* Communication */
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   itorecv,nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   comm,&status),return 0 );
   }
 
+  /* Communication */
+  if( !PMMG_extComm_halo_exchange( parmesh,parmesh->edge_halo,
+                                   parmesh->next_edge_comm,0 ) )
+    return 0;
+
   /* Fill internal communicator */
   for ( k = 0; k < parmesh->next_edge_comm; ++k ) {
     ext_edge_comm = &parmesh->ext_edge_comm[k];
@@ -1680,17 +1651,14 @@ int PMMG_singul(PMMG_pParMesh parmesh,MMG5_pMesh mesh,PMMG_hn_loopvar *var) {
   PMMG_pGrp      grp;
   PMMG_pInt_comm int_node_comm;
   PMMG_pExt_comm ext_node_comm;
-  MPI_Comm       comm;
-  MPI_Status     status;
   MMG5_pPoint    ppt;
   double         ux,uy,uz,vx,vy,vz,dd;
   int            nc,xp,nr,ns0,ns1,nre;
   int            ip,idx,iproc,k,i,j,d;
-  int            nitem,color;
+  int            nitem;
   int            *intvalues,*itosend,*itorecv,*iproc2comm;
   double         *doublevalues,*rtosend,*rtorecv;
 
-  comm   = parmesh->comm;
   assert( parmesh->ngrp == 1 );
   grp = &parmesh->listgrp[0];
   int_node_comm = parmesh->int_node_comm;
@@ -1770,7 +1738,6 @@ int PMMG_singul(PMMG_pParMesh parmesh,MMG5_pMesh mesh,PMMG_hn_loopvar *var) {
   for ( k = 0; k < parmesh->next_node_comm; ++k ) {
     ext_node_comm = &parmesh->ext_node_comm[k];
     nitem         = ext_node_comm->nitem;
-    color         = ext_node_comm->color_out;
 
     itosend = ext_node_comm->itosend;
     itorecv = ext_node_comm->itorecv;
@@ -1783,18 +1750,17 @@ int PMMG_singul(PMMG_pParMesh parmesh,MMG5_pMesh mesh,PMMG_hn_loopvar *var) {
       for( j = 0; j < 2; j++ )
         itosend[2*i+j] = intvalues[2*idx+j];
     }
-
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,2*nitem,MPI_INT,color,MPI_ANALYS_TAG,
-                   itorecv,2*nitem,MPI_INT,color,MPI_ANALYS_TAG,
-                   comm,&status),return 0 );
   }
 
+  /* Communication */
+  if( !PMMG_extComm_halo_exchange( parmesh,parmesh->node_halo,
+                                   parmesh->next_node_comm,0 ) )
+    return 0;
+
   /* Get tags and reset buffers and communicator */
   for ( k = 0; k < parmesh->next_node_comm; ++k ) {
     ext_node_comm = &parmesh->ext_node_comm[k];
     nitem         = ext_node_comm->nitem;
-    color         = ext_node_comm->color_out;
 
     itosend = ext_node_comm->itosend;
     itorecv = ext_node_comm->itorecv;
@@ -1829,7 +1795,6 @@ int PMMG_singul(PMMG_pParMesh parmesh,MMG5_pMesh mesh,PMMG_hn_loopvar *var) {
   for ( k = 0; k < parmesh->next_node_comm; ++k ) {
     ext_node_comm = &parmesh->ext_node_comm[k];
     nitem         = ext_node_comm->nitem;
-    color         = ext_node_comm->color_out;
 
     itosend = ext_node_comm->itosend;
     itorecv = ext_node_comm->itorecv;
@@ -1846,18 +1811,13 @@ int PMMG_singul(PMMG_pParMesh parmesh,MMG5_pMesh mesh,PMMG_hn_loopvar *var) {
           rtosend[6*i+3*j+d] = doublevalues[6*idx+3*j+d];
       }
     }
-
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,2*nitem,MPI_INT,color,MPI_ANALYS_TAG,
-                   itorecv,2*nitem,MPI_INT,color,MPI_ANALYS_TAG,
-                   comm,&status),return 0 );
-
-    MPI_CHECK(
-      MPI_Sendrecv(rtosend,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+1,
-                   rtorecv,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+1,
-                   comm,&status),return 0 );
   }
 
+  /* Communication */
+  if( !PMMG_extComm_halo_exchange( parmesh,parmesh->node_halo,
+                                   parmesh->next_node_comm,1 ) )
+    return 0;
+
   /** First pass: Sum nb. of singularities, Store received edge vectors in
    *  doublevalues if there is room for them.
    */
@@ -2005,20 +1965,17 @@ int PMMG_setdhd(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *pHash ) {
   MMG5_pTria     ptr;
   int            *intvalues,*itorecv,*itosend;
   double         *doublevalues,*rtorecv,*rtosend;
-  int            nitem,color,nt0,nt1;
+  int            nitem,nt0,nt1;
   double         n1[3],n2[3],dhd;
   int            k,ne,nr,nm,j;
   int            i,i1,i2;
   int            idx,edg,d;
   int16_t        tag;
-  MPI_Comm       comm;
-  MPI_Status     status;
 
   assert( parmesh->ngrp == 1 );
   grp = &parmesh->listgrp[0];
   assert( mesh == grp->mesh );
 
-  comm = parmesh->comm;
   int_edge_comm = parmesh->int_edge_comm;
 
   /* Allocated edge intvalues to tag non-manifold and reference edges */
@@ -2057,7 +2014,6 @@ int PMMG_setdhd(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *pHash ) {
   for ( k = 0; k < parmesh->next_edge_comm; ++k ) {
     ext_edge_comm = &parmesh->ext_edge_comm[k];
     nitem         = ext_edge_comm->nitem;
-    color         = ext_edge_comm->color_out;
 
     itosend = ext_edge_comm->itosend;
     itorecv = ext_edge_comm->itorecv;
@@ -2067,13 +2023,13 @@ int PMMG_setdhd(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *pHash ) {
       idx  = ext_edge_comm->int_comm_index[i];
       itosend[i] = intvalues[idx];
     }
-
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   itorecv,nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   comm,&status),return 0 );
   }
 
+  /* Communication */
+  if( !PMMG_extComm_halo_exchange( parmesh,parmesh->edge_halo,
+                                   parmesh->next_edge_comm,0 ) )
+    return 0;
+
   /* Update edge tags in the internal communicator */
   for ( k = 0; k < parmesh->next_edge_comm; ++k ) {
     ext_edge_comm = &parmesh->ext_edge_comm[k];
@@ -2175,7 +2131,6 @@ int PMMG_setdhd(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *pHash ) {
   for ( k = 0; k < parmesh->next_edge_comm; ++k ) {
     ext_edge_comm = &parmesh->ext_edge_comm[k];
     nitem         = ext_edge_comm->nitem;
-    color         = ext_edge_comm->color_out;
 
     itosend = ext_edge_comm->itosend;
     itorecv = ext_edge_comm->itorecv;
@@ -2192,18 +2147,13 @@ int PMMG_setdhd(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *pHash ) {
           rtosend[6*i+3*j+d] = doublevalues[6*idx+3*j+d];
       }
     }
-
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,2*nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   itorecv,2*nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   comm,&status),return 0 );
-
-    MPI_CHECK(
-      MPI_Sendrecv(rtosend,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+3,
-                   rtorecv,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+3,
-                   comm,&status),return 0 );
   }
 
+  /* Communication */
+  if( !PMMG_extComm_halo_exchange( parmesh,parmesh->edge_halo,
+                                   parmesh->next_edge_comm,1 ) )
+    return 0;
+
   /** First pass: Increment the number of seen triangles, check for reference
    *  edges and mark them with PMMG_UNSET, and store new triangles normals if
    *  there is room for them. */
@@ -2449,6 +2399,10 @@ void PMMG_analys_comm_free( PMMG_pParMesh parmesh,PMMG_pInt_comm int_comm,
  * Deallocate all node and edge communicator buffers for parallel mesh analysis.
  */
 void PMMG_analys_comms_free( PMMG_pParMesh parmesh ) {
+  /* Free the persistent requests before their buffers */
+  PMMG_extComm_halo_free( parmesh,&parmesh->node_halo,parmesh->next_node_comm );
+  PMMG_extComm_halo_free( parmesh,&parmesh->edge_halo,parmesh->next_edge_comm );
+
   /* Ask for deallocation till a depth 4*(next_comm+1), since there are 4
    * buffers for each communicator, and all communicators before (next_comm+1)
    * need to be deallocated. */
@@ -2563,6 +2517,19 @@ int PMMG_analys_comms_init( PMMG_pParMesh parmesh ) {
     return 0;
   }
 
+  /* Build the persistent requests exchanging the node and edge buffers with
+   * all the neighbours at once (the buffers stay allocated during the whole
+   * analysis). */
+  if( !PMMG_extComm_halo_init( parmesh,ext_node_comm,parmesh->next_node_comm,
+                               nint,ndouble,MPI_ANALYS_TAG,
+                               &parmesh->node_halo ) ||
+      !PMMG_extComm_halo_init( parmesh,ext_edge_comm,parmesh->next_edge_comm,
+                               nint,ndouble,MPI_ANALYS_TAG+2,
+                               &parmesh->edge_halo ) ) {
+    PMMG_analys_comms_free( parmesh );
+    return 0;
+  }
+
   return 1;
 }
 
@@ -0,0 +1,220 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file arena_pmmg.c
+ * \brief Per-parmesh scratch memory for the short-lived arrays.
+ * \copyright GNU Lesser General Public License.
+ *
+ * The arena is a stack of memory blocks that are allocated through the
+ * PMMG_MALLOC accounting: a block is counted once in the parmesh memory and is
+ * reused by the successive steps of an iteration instead of being freed and
+ * allocated again. The blocks are trimmed before the remeshing of the groups
+ * (\ref PMMG_arena_trim) and a single block is pushed at the next use. Arrays are allocated by \ref PMMG_arena_alloc and are given back all
+ * together by \ref PMMG_arena_release with the offset returned by \ref
+ * PMMG_arena_mark before their allocation.
+ *
+ * When the arena is full, a new block is pushed on the stack. At the next full
+ * release, the blocks are merged so the following iterations fit in a single
+ * block.
+ *
+ */
+#include "parmmg.h"
+
+/** Size of the block header (rounded up to preserve the data alignment) */
+#define PMMG_ARENA_HEADER \
+  ((sizeof(PMMG_ArenaBlock)+PMMG_ARENA_ALIGN-1)/PMMG_ARENA_ALIGN*PMMG_ARENA_ALIGN)
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param base arena offset of the beginning of the block data.
+ * \param size size of the block data.
+ *
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Push a new block on the arena stack.
+ *
+ */
+static
+int PMMG_arena_push( PMMG_pParMesh parmesh,size_t base,size_t size ) {
+  PMMG_Arena      *arena = parmesh->arena;
+  PMMG_ArenaBlock *block;
+  char            *ptr;
+
+  PMMG_MALLOC(parmesh,ptr,PMMG_ARENA_HEADER+size,char,"arena block",return 0);
+
+  block       = (PMMG_ArenaBlock*)ptr;
+  block->prev = arena->top;
+  block->base = base;
+  block->size = size;
+  arena->top  = block;
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * Pop the last block of the arena stack.
+ *
+ */
+static
+void PMMG_arena_pop( PMMG_pParMesh parmesh ) {
+  PMMG_Arena *arena = parmesh->arena;
+  char       *ptr;
+
+  ptr        = (char*)arena->top;
+  arena->top = arena->top->prev;
+
+  PMMG_DEL_MEM(parmesh,ptr,char,"arena block");
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * \return the current offset of the arena, to be passed to \ref
+ * PMMG_arena_release to give back the arrays allocated after this call.
+ *
+ */
+size_t PMMG_arena_mark( PMMG_pParMesh parmesh ) {
+
+  if ( !parmesh->arena ) return 0;
+
+  return parmesh->arena->used;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param nbytes number of bytes to allocate.
+ *
+ * \return a pointer toward \a nbytes bytes of scratch memory (aligned on
+ * PMMG_ARENA_ALIGN bytes), NULL if fail.
+ *
+ * Allocate scratch memory at the top of the arena.
+ *
+ */
+void *PMMG_arena_alloc( PMMG_pParMesh parmesh,size_t nbytes ) {
+  PMMG_Arena      *arena;
+  PMMG_ArenaBlock *top;
+  size_t          size;
+  void            *ptr;
+
+  if ( !nbytes ) return NULL;
+
+  if ( !parmesh->arena ) {
+    PMMG_CALLOC(parmesh,parmesh->arena,1,PMMG_Arena,"arena",return NULL);
+  }
+  arena  = parmesh->arena;
+  nbytes = (nbytes+PMMG_ARENA_ALIGN-1)/PMMG_ARENA_ALIGN*PMMG_ARENA_ALIGN;
+
+  top = arena->top;
+  if ( (!top) || (arena->used + nbytes > top->base + top->size) ) {
+    /* The arena is full: push a block at least as large as the previous one */
+    size = MG_MAX(nbytes,PMMG_ARENA_MINSIZE);
+    size = MG_MAX(size,top ? top->size : arena->hint);
+
+    if ( !PMMG_arena_push(parmesh,arena->used,size) ) return NULL;
+    top = arena->top;
+  }
+
+  ptr = (char*)top + PMMG_ARENA_HEADER + (arena->used - top->base);
+
+  arena->used += nbytes;
+  arena->peak  = MG_MAX(arena->peak,arena->used);
+
+  return ptr;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param mark offset returned by \ref PMMG_arena_mark.
+ *
+ * Give back all the scratch memory allocated after the call to \ref
+ * PMMG_arena_mark that has returned \a mark. When the arena is fully
+ * released, its blocks are merged in a block large enough for the peak usage.
+ *
+ */
+void PMMG_arena_release( PMMG_pParMesh parmesh,size_t mark ) {
+  PMMG_Arena *arena = parmesh->arena;
+
+  if ( !arena ) return;
+
+  assert ( mark <= arena->used );
+
+  /* Free the blocks above the mark (the first block is kept) */
+  while ( arena->top && arena->top->prev && arena->top->base >= mark ) {
+    PMMG_arena_pop( parmesh );
+  }
+  arena->used = mark;
+
+  if ( mark ) return;
+
+  /* Merge the blocks if the arena has overflowed */
+  if ( arena->top && arena->top->size < arena->peak ) {
+    PMMG_arena_pop( parmesh );
+    /* On failure, the arena will grow again at the next allocation */
+    PMMG_arena_push( parmesh,0,arena->peak );
+  }
+  arena->peak = 0;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * Give the blocks of a fully released arena back to the system (nothing is
+ * done if arrays are still allocated in the arena). The size of the freed
+ * block is kept so the next allocation pushes a block large enough for the
+ * previous iteration at once.
+ *
+ * \remark The arena blocks are counted in the parmesh memory: they are trimmed
+ * before the remeshing so that the memory is available to the groups.
+ *
+ */
+void PMMG_arena_trim( PMMG_pParMesh parmesh ) {
+  PMMG_Arena *arena = parmesh->arena;
+
+  if ( !arena || arena->used ) return;
+
+  while ( arena->top ) {
+    arena->hint = MG_MAX(arena->hint,arena->top->size);
+    PMMG_arena_pop( parmesh );
+  }
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * Free the scratch arena.
+ *
+ */
+void PMMG_arena_free( PMMG_pParMesh parmesh ) {
+
+  if ( !parmesh->arena ) return;
+
+  assert ( !parmesh->arena->used && "arena freed with unreleased arrays" );
+
+  while ( parmesh->arena->top ) {
+    PMMG_arena_pop( parmesh );
+  }
+  PMMG_DEL_MEM(parmesh,parmesh->arena,PMMG_Arena,"arena");
+}
@@ -0,0 +1,90 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file arena_pmmg.h
+ * \brief arena_pmmg.c header file
+ * \copyright GNU Lesser General Public License.
+ */
+
+#ifndef ARENA_PMMG_H
+
+#define ARENA_PMMG_H
+
+#include <stddef.h>
+
+/** Alignment (in bytes) of the arena allocations */
+#define PMMG_ARENA_ALIGN 8
+
+/** Minimal size (in bytes) of an arena block */
+#define PMMG_ARENA_MINSIZE 65536
+
+/**
+ * \struct PMMG_ArenaBlock
+ *
+ * \brief Block of scratch memory (the block data follow the block header).
+ *
+ */
+typedef struct PMMG_ArenaBlock {
+  struct PMMG_ArenaBlock *prev; /*!< previous block of the arena */
+  size_t base; /*!< arena offset of the beginning of the block data */
+  size_t size; /*!< size of the block data */
+} PMMG_ArenaBlock;
+
+/**
+ * \struct PMMG_Arena
+ *
+ * \brief Stack of scratch memory with mark/release semantics.
+ *
+ */
+typedef struct PMMG_Arena {
+  PMMG_ArenaBlock *top; /*!< last block of the arena */
+  size_t used; /*!< current arena offset (value returned by PMMG_arena_mark) */
+  size_t peak; /*!< maximal offset reached since the last full release */
+  size_t hint; /*!< size of the first block to push (see PMMG_arena_trim) */
+} PMMG_Arena;
+
+/**
+ * \def PMMG_ARENA_MALLOC(parmesh,ptr,size,type,msg,on_failure)
+ *
+ * Allocate \a size elements of type \a type in the scratch arena of \a
+ * parmesh. The memory is given back by \ref PMMG_arena_release, never by
+ * PMMG_DEL_MEM.
+ *
+ */
+#define PMMG_ARENA_MALLOC(parmesh,ptr,size,type,msg,on_failure) do { \
+    (ptr) = (type*)PMMG_arena_alloc( (parmesh),(size)*sizeof(type) );  \
+    if ( (size) != 0 && !(ptr) ) {                                      \
+      fprintf(stderr,"  ## Error: %s:%d: %s: arena allocation failed.\n", \
+              __func__,__LINE__,msg);                                   \
+      on_failure;                                                       \
+    }                                                                   \
+  } while(0)
+
+size_t PMMG_arena_mark( PMMG_pParMesh parmesh );
+void  *PMMG_arena_alloc( PMMG_pParMesh parmesh,size_t nbytes );
+void   PMMG_arena_release( PMMG_pParMesh parmesh,size_t mark );
+void   PMMG_arena_trim( PMMG_pParMesh parmesh );
+void   PMMG_arena_free( PMMG_pParMesh parmesh );
+
+#endif
@@ -99,6 +99,26 @@ int PMMG_barycoord_compare( const void *a,const void *b ) {
   return 0;
 }
 
+/**
+ * \param barycoord pointer to the barycentric coordinates
+ * \param n number of coordinates
+ *
+ *  Sort the barycentric coordinates in ascending order. Insertion sort, cheaper
+ *  than a qsort call on the 3 or 4 coordinates of an element.
+ *
+ */
+void PMMG_barycoord_sort( PMMG_barycoord *barycoord,int n ) {
+  PMMG_barycoord tmp;
+  int            i,j;
+
+  for( i = 1; i < n; i++ ) {
+    tmp = barycoord[i];
+    for( j = i; j > 0 && barycoord[j-1].val > tmp.val; j-- )
+      barycoord[j] = barycoord[j-1];
+    barycoord[j] = tmp;
+  }
+}
+
 int PMMG_barycoord_isInside( PMMG_barycoord *phi ) {
   if( phi[0].val > -MMG5_EPS )
     return 1;
@@ -222,11 +242,40 @@ int PMMG_barycoord2d_compute( MMG5_pMesh mesh,MMG5_pTria ptr,int k,double *coord
   return 1;
 }
 
+/**
+ * \param faceAreas SoA barycentric coefficients of the current tetrahedron
+ * \param coord pointer to the point coordinates
+ * \param phi pointer to the 4 computed barycentric coordinates
+ *
+ *  Barycentric coordinates kernel: the coordinate with respect to face \a ifac
+ *  is the affine function faceAreas[ifac]*x + faceAreas[4+ifac]*y +
+ *  faceAreas[8+ifac]*z + faceAreas[12+ifac], so the 4 faces are evaluated with
+ *  the same (vectorizable) instructions.
+ *
+ */
+static inline
+void PMMG_barycoord3d_kernel( double *faceAreas,double *coord,double *phi ) {
+  double x,y,z;
+  int    ifac;
+
+  x = coord[0];
+  y = coord[1];
+  z = coord[2];
+
+#ifdef USE_OPENMP
+#pragma omp simd
+#endif
+  for( ifac = 0; ifac < 4; ifac++ ) {
+    phi[ifac] = faceAreas[ifac]*x + faceAreas[4+ifac]*y + faceAreas[8+ifac]*z
+      + faceAreas[12+ifac];
+  }
+}
+
 /**
  * \param mesh pointer to the mesh structure
  * \param pt pointer to the current tetra
  * \param coord pointer to the point coordinates
- * \param faceAreas oriented face areas of the current tetrahedron
+ * \param faceAreas SoA barycentric coefficients of the current tetrahedron
  * \param barycoord pointer to the point barycentric coordinates in the current
  * tetra
  *
@@ -237,25 +286,42 @@ int PMMG_barycoord2d_compute( MMG5_pMesh mesh,MMG5_pTria ptr,int k,double *coord
  */
 int PMMG_barycoord3d_compute( MMG5_pMesh mesh,MMG5_pTetra pt,double *coord,
                               double *faceAreas,PMMG_barycoord *barycoord ) {
-  double *c0,*normal,vol;
+  double phi[4];
   int    ifac;
 
-  /* Retrieve tetra volume */
-  vol = pt->qual;
+  PMMG_barycoord3d_kernel( faceAreas,coord,phi );
 
-  /* Retrieve face areas and compute barycentric coordinates */
   for( ifac = 0; ifac < 4; ifac++ ) {
-    normal = &faceAreas[3*ifac];
-    c0 = mesh->point[pt->v[MMG5_idir[ifac][0]]].c;
-    barycoord[ifac].val = -( (coord[0]-c0[0])*normal[0] +
-                             (coord[1]-c0[1])*normal[1] +
-                             (coord[2]-c0[2])*normal[2] )/vol;
+    barycoord[ifac].val = phi[ifac];
     barycoord[ifac].idx = ifac;
   }
 
   return 1;
 }
 
+/**
+ * \param faceAreas SoA barycentric coefficients of all the tetrahedra
+ * \param list indices of the tetrahedra to evaluate
+ * \param nel number of tetrahedra in \a list (at most PMMG_BARYCOORD_BATCH)
+ * \param coord pointer to the point coordinates
+ * \param phi array of 4*nel doubles to store the barycentric coordinates
+ *
+ *  Compute the barycentric coordinates of a given point in a batch of
+ *  tetrahedra, 4 lanes (one per face) per tetrahedron.
+ *
+ */
+void PMMG_barycoord3d_computeBatch( double *faceAreas,int *list,int nel,
+                                    double *coord,double *phi ) {
+  int j;
+
+  assert( nel <= PMMG_BARYCOORD_BATCH );
+
+  for( j = 0; j < nel; j++ ) {
+    PMMG_barycoord3d_kernel( &faceAreas[PMMG_BARYCOORD_SOA*list[j]],coord,
+                             &phi[4*j] );
+  }
+}
+
 /**
  * \param mesh pointer to the mesh structure
  * \param ptr pointer to the current triangle
@@ -277,7 +343,7 @@ int PMMG_barycoord2d_evaluate( MMG5_pMesh mesh,MMG5_pTria ptr,int k,
 
   /* Get barycentric coordinates and sort them in ascending order */
   PMMG_barycoord2d_compute(mesh, ptr, k, coord, triaNormal, barycoord);
-  qsort(barycoord,3,sizeof(PMMG_barycoord),PMMG_barycoord_compare);
+  PMMG_barycoord_sort( barycoord,3 );
 
   /* Return inside/outside status */
   return PMMG_barycoord_isInside( barycoord );
@@ -287,7 +353,7 @@ int PMMG_barycoord2d_evaluate( MMG5_pMesh mesh,MMG5_pTria ptr,int k,
  * \param mesh pointer to the mesh structure
  * \param pt pointer to the current tetra
  * \param coord pointer to the point coordinates
- * \param faceAreas oriented face areas of the current tetrahedron
+ * \param faceAreas SoA barycentric coefficients of the current tetrahedron
  * \param barycoord pointer to the point barycentric coordinates in the current
  * tetra
  *
@@ -303,7 +369,7 @@ int PMMG_barycoord3d_evaluate( MMG5_pMesh mesh,MMG5_pTetra pt,
 
   /* Get barycentric coordinates and sort them in ascending order */
   PMMG_barycoord3d_compute(mesh, pt, coord, faceAreas, barycoord);
-  qsort(barycoord,4,sizeof(PMMG_barycoord),PMMG_barycoord_compare);
+  PMMG_barycoord_sort( barycoord,4 );
 
   /* Return inside/outside status */
   return PMMG_barycoord_isInside( barycoord );
@@ -43,6 +43,14 @@ typedef struct {
   double val; /*!< coordinate value */
 } PMMG_barycoord;
 
+/** Number of doubles stored for each tetrahedron in the SoA array of the
+ * barycentric coefficients: 4 coefficients (one per face) for x, y, z and for
+ * the constant term */
+#define PMMG_BARYCOORD_SOA   16
+
+/** Max number of tetrahedra evaluated by a call to the batched kernel */
+#define PMMG_BARYCOORD_BATCH  8
+
 
 double PMMG_quickarea(double *a,double *b,double *c,double *n);
 void PMMG_barycoord_get( double *val,PMMG_barycoord *phi,int ndim );
@@ -55,9 +63,12 @@ int PMMG_barycoord2d_project( MMG5_pMesh mesh,MMG5_pTria ptr,double *coord,
                                  double *proj,double dist,double *normal );
 int PMMG_barycoord2d_getClosest( MMG5_pMesh mesh,int k,MMG5_pPoint ppt,
                                  PMMG_barycoord *barycoord );
+void PMMG_barycoord_sort( PMMG_barycoord *barycoord,int n );
 int PMMG_barycoord_isBorder( PMMG_barycoord *phi,int *ifoundEdge,int *ifoundVertex );
 int  PMMG_barycoord3d_compute( MMG5_pMesh mesh,MMG5_pTetra pt,double *coord,
                                double *faceAreas, PMMG_barycoord *barycoord );
+void PMMG_barycoord3d_computeBatch( double *faceAreas,int *list,int nel,
+                                   double *coord,double *phi );
 int  PMMG_barycoord2d_evaluate( MMG5_pMesh mesh,MMG5_pTria ptr,int k,
                                 double *coord,double *triaNormal,
                                 PMMG_barycoord *barycoord );
@@ -186,7 +186,7 @@ int PMMG_find_intFaceCommBoundingBox(PMMG_pParMesh parmesh,double min[3],
           ppt = &mesh->point[ip];
 
           for ( j=0; j<3; ++j )
-            coor_list[3*idx].c[j] = ppt->c[j];
+            coor_list[3*idx+l].c[j] = ppt->c[j];
         }
       }
       else intvalues[idx] = 1;
@@ -194,7 +194,7 @@ int PMMG_find_intFaceCommBoundingBox(PMMG_pParMesh parmesh,double min[3],
   }
 
   /* Find the bounding box of the internal comm */
-  if ( !PMMG_find_coorCellListBoundingBox(coor_list,nitem,min,max,
+  if ( !PMMG_find_coorCellListBoundingBox(coor_list,3*nitem,min,max,
                                           delta) ) goto end;
 
   /* Success */
@@ -224,6 +224,7 @@ int PMMG_find_intFaceCommBoundingBox(PMMG_pParMesh parmesh,double min[3],
 int PMMG_check_intNodeComm( PMMG_pParMesh parmesh )
 {
   PMMG_coorCell *coor_list;
+  PMMG_coorHash coor_hash;
   PMMG_pGrp     grp;
   MMG5_pMesh    mesh;
   double        dd,bb_min[3],bb_max[3],delta,dist[3],dist_norm;
@@ -239,7 +240,9 @@ int PMMG_check_intNodeComm( PMMG_pParMesh parmesh )
 
   ier = 0;
 
-  coor_list = NULL;
+  coor_list      = NULL;
+  coor_hash.head = NULL;
+  coor_hash.next = NULL;
 
   /** Step 1: Find the internal communicator bounding box */
   if ( !PMMG_find_intNodeCommBoundingBox(parmesh,bb_min,bb_max,&delta) )
@@ -301,42 +304,43 @@ int PMMG_check_intNodeComm( PMMG_pParMesh parmesh )
   }
 
  /** Step 3: check that a point shared by 2 groups doesn't have 2 different
-   * positions in the internal communicator */
-  for ( commIdx1 = 0; commIdx1<nitem; commIdx1++ ) {
+   * positions in the internal communicator (the positions are hashed on their
+   * quantized coordinates) */
+  if ( !PMMG_coorHash_init(parmesh,&coor_hash,coor_list,nitem,PMMG_EPSCOOR) )
+    goto end;
 
-    if ( coor_list[ commIdx1 ].grp == PMMG_UNSET ) continue;
+  for ( commIdx2 = 0; commIdx2<nitem; commIdx2++ ) {
 
-    for ( commIdx2 = commIdx1+1; commIdx2<nitem; ++commIdx2 ) {
+    if ( coor_list[ commIdx2 ].grp == PMMG_UNSET ) continue;
 
-      if ( coor_list[ commIdx2 ].grp == PMMG_UNSET ) continue;
+    commIdx1 = PMMG_coorHash_findOrAdd(&coor_hash,commIdx2);
+    if ( commIdx1 != commIdx2 ) {
+      int grp1_id   = coor_list[ commIdx1 ].grp;
+      int grp2_id   = coor_list[ commIdx2 ].grp;
+      int pos1_idx  = coor_list[ commIdx1 ].idx;
+      int pos2_idx  = coor_list[ commIdx2 ].idx;
+      int pos1_idx1 = parmesh->listgrp[grp1_id].node2int_node_comm_index1[pos1_idx];
+      int pos2_idx1 = parmesh->listgrp[grp2_id].node2int_node_comm_index1[pos2_idx];
+      int pos1_idx2 = parmesh->listgrp[grp1_id].node2int_node_comm_index2[pos1_idx];
+      int pos2_idx2 = parmesh->listgrp[grp2_id].node2int_node_comm_index2[pos2_idx];
+      MMG5_pPoint ppt1 = &parmesh->listgrp[grp1_id].mesh->point[pos1_idx1];
+      MMG5_pPoint ppt2 = &parmesh->listgrp[grp2_id].mesh->point[pos2_idx1];
 
       dist_norm = 0.;
       for ( j = 0; j < 3; ++j ) {
         dist[j] = coor_list[ commIdx2 ].c[j]-coor_list[ commIdx1 ].c[j];
         dist_norm += dist[j]*dist[j];
       }
-      if ( dist_norm < PMMG_EPSCOOR2 ) {
-        int grp1_id   = coor_list[ commIdx1 ].grp;
-        int grp2_id   = coor_list[ commIdx2 ].grp;
-        int pos1_idx  = coor_list[ commIdx1 ].idx;
-        int pos2_idx  = coor_list[ commIdx2 ].idx;
-        int pos1_idx1 = parmesh->listgrp[grp1_id].node2int_node_comm_index1[pos1_idx];
-        int pos2_idx1 = parmesh->listgrp[grp2_id].node2int_node_comm_index1[pos2_idx];
-        int pos1_idx2 = parmesh->listgrp[grp1_id].node2int_node_comm_index2[pos1_idx];
-        int pos2_idx2 = parmesh->listgrp[grp2_id].node2int_node_comm_index2[pos2_idx];
-        MMG5_pPoint ppt1 = &parmesh->listgrp[grp1_id].mesh->point[pos1_idx1];
-        MMG5_pPoint ppt2 = &parmesh->listgrp[grp2_id].mesh->point[pos2_idx1];
 
-        fprintf(stderr,"  ## Error: %s: rank %d:\n"
-                "       A point shared by at least 2 groups has 2 positions "
-                " (%d and %d) in the internal communicator (dist = %g):\n"
-                "       - grp %d: point %d at position %d (%d): %e %e %e\n"
-                "       - grp %d: point %d at position %d (%d): %e %e %e\n",
-                 __func__,parmesh->myrank,commIdx1,commIdx2,dist_norm,
-                grp1_id,pos1_idx1,pos1_idx,pos1_idx2,ppt1->c[0],ppt1->c[1],ppt1->c[2],
-                grp2_id,pos2_idx1,pos2_idx,pos2_idx2,ppt2->c[0],ppt2->c[1],ppt2->c[2] );
-          goto end;
-      }
+      fprintf(stderr,"  ## Error: %s: rank %d:\n"
+              "       A point shared by at least 2 groups has 2 positions "
+              " (%d and %d) in the internal communicator (dist = %g):\n"
+              "       - grp %d: point %d at position %d (%d): %e %e %e\n"
+              "       - grp %d: point %d at position %d (%d): %e %e %e\n",
+               __func__,parmesh->myrank,commIdx1,commIdx2,dist_norm,
+              grp1_id,pos1_idx1,pos1_idx,pos1_idx2,ppt1->c[0],ppt1->c[1],ppt1->c[2],
+              grp2_id,pos2_idx1,pos2_idx,pos2_idx2,ppt2->c[0],ppt2->c[1],ppt2->c[2] );
+      goto end;
     }
   }
 
@@ -394,6 +398,7 @@ int PMMG_check_intNodeComm( PMMG_pParMesh parmesh )
   ier = 1;
 
 end:
+  PMMG_coorHash_free(parmesh,&coor_hash);
   PMMG_DEL_MEM(parmesh,coor_list,PMMG_coorCell,"coor_list array");
 
   return ier;
@@ -1273,3 +1278,30 @@ end:
 
   return ieresult;
 }
+
+/**
+ * \param parmesh pointer to current parmesh stucture
+ *
+ * \return 0 (on all procs) if fail, 1 otherwise
+ *
+ * Check the consistency of the internal and external node and face
+ * communicators. The cost of the checks is linear with respect to the size of
+ * the communicators so they can be run at each redistribution of the mesh.
+ *
+ */
+int PMMG_check_comms( PMMG_pParMesh parmesh )
+{
+  int ier,ieresult;
+
+  ier = PMMG_check_intNodeComm( parmesh );
+  if ( ier ) {
+    ier = PMMG_check_intFaceComm( parmesh );
+  }
+
+  MPI_CHECK ( MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm ),ieresult=0 );
+  if ( !ieresult ) return 0;
+
+  if ( !PMMG_check_extNodeComm( parmesh ) ) return 0;
+
+  return PMMG_check_extFaceComm( parmesh );
+}
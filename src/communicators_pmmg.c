@@ -1194,20 +1194,33 @@ int PMMG_build_faceCommFromNodes( PMMG_pParMesh parmesh ) {
 
 /**
  * \param parmesh pointer toward a parmesh structure
+ * \param keepIntComm 1 if the internal node communicator (and the group
+ * communicators) of the process are still valid and must be kept, 0 if they
+ * have to be built.
  *
  * \return 1 if success, 0 if fail.
  *
  * Build the node communicators (externals and internals) from the faces ones.
+ * The external communicators must be deleted. The internal node communicator
+ * of a process whose groups have not been modified since its last build can be
+ * reused: in this case, only the external communicators are built (the
+ * building of the internal communicator is local to each process so \a
+ * keepIntComm may differ from one process to another).
  *
  */
-int PMMG_build_nodeCommFromFaces( PMMG_pParMesh parmesh ) {
+int PMMG_build_nodeCommFromFaces( PMMG_pParMesh parmesh,int8_t keepIntComm ) {
   int ier, ier_glob;
 
   assert ( PMMG_check_extFaceComm ( parmesh ) );
   assert ( PMMG_check_intFaceComm ( parmesh ) );
 
   /** Build the internal node communicator from the faces ones */
-  ier = PMMG_build_intNodeComm(parmesh);
+  if ( keepIntComm ) {
+    ier = 1;
+  }
+  else {
+    ier = PMMG_build_intNodeComm(parmesh);
+  }
 
   if ( !ier ) {
     fprintf(stderr,"\n  ## Error: %s: unable to build the internal node"
@@ -1440,6 +1453,7 @@ end:
 int PMMG_build_intNodeComm( PMMG_pParMesh parmesh ) {
   PMMG_pGrp       grp;
   PMMG_coorCell   *coor_list;
+  PMMG_coorHash   coor_hash;
   MMG5_pMesh      mesh;
   MMG5_pTetra     pt;
   MMG5_pPoint     ppt;
@@ -1727,36 +1741,26 @@ int PMMG_build_intNodeComm( PMMG_pParMesh parmesh ) {
   if ( !PMMG_scale_coorCellList(coor_list,nitem_node,bb_min,bb_max,&delta) )
     goto end;
 
-  /* Store the point position in the internal communicator */
-  for ( i=0; i<nitem_node; ++i ) {
-    new_pos[i]       = i;
-    coor_list[i].idx = i;
-  }
-
-  /* Sort coor_list depending on its coordinates */
-  qsort(coor_list,nitem_node,sizeof(PMMG_coorCell),PMMG_compare_coorCell);
+  /* Hash the nodes on their quantized coordinates and remove the identic
+   * nodes */
+  if ( !PMMG_coorHash_init(parmesh,&coor_hash,coor_list,nitem_node,
+                           PMMG_EPSCOORCELL) ) goto end;
 
-  /* Travel the list and remove the identic nodes */
   idx = 0;
-  if ( nitem_node ) {
-    new_pos[coor_list[0].idx] = 0;
+  for ( i=0; i<nitem_node; ++i ) {
+    coor_list[i].idx = i;
 
-    for ( i=1; i<nitem_node; ++i ) {
-      if ( PMMG_compare_coorCell(&coor_list[i],&coor_list[idx]) ) {
-        ++idx;
-        if ( idx != i ) {
-          coor_list[idx].c[0] = coor_list[i].c[0];
-          coor_list[idx].c[1] = coor_list[i].c[1];
-          coor_list[idx].c[2] = coor_list[i].c[2];
-          coor_list[idx].idx  = coor_list[i].idx;
-        }
-        new_pos[coor_list[i].idx] = idx;
-      }
-      else
-        new_pos[coor_list[i].idx] = new_pos[coor_list[idx].idx];
+    pos = PMMG_coorHash_findOrAdd(&coor_hash,i);
+    if ( pos == i ) {
+      new_pos[i] = idx++;
+    }
+    else {
+      new_pos[i] = new_pos[pos];
     }
-    nitem_node = idx+1;
   }
+  nitem_node = idx;
+
+  PMMG_coorHash_free(parmesh,&coor_hash);
 
   /* Update node2int_node_comm arrays */
   for ( grpid=0; grpid<parmesh->ngrp; ++grpid ) {
@@ -2167,3 +2171,107 @@ end:
 
   return ier;
 }
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param request pointer toward the array of persistent requests
+ * \param next_comm number of external communicators
+ *
+ * Free the persistent requests of a halo exchange and deallocate the request
+ * array.
+ */
+void PMMG_extComm_halo_free( PMMG_pParMesh parmesh,MPI_Request **request,
+                             int next_comm ) {
+  int k;
+
+  if ( !(*request) ) return;
+
+  for ( k=0; k<4*next_comm; ++k ) {
+    if ( (*request)[k] != MPI_REQUEST_NULL )
+      MPI_Request_free( &(*request)[k] );
+  }
+  PMMG_DEL_MEM(parmesh,*request,MPI_Request,"halo requests");
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param ext_comm array of external communicators
+ * \param next_comm number of external communicators
+ * \param nint number of integers exchanged for each item
+ * \param ndouble number of doubles exchanged for each item
+ * \param tag MPI tag of the integer messages (\a tag+1 is used for the doubles)
+ * \param request pointer toward the array of persistent requests (allocated here)
+ * \return 0 if fail, 1 if success.
+ *
+ * Create the persistent requests of a halo exchange of the \a itosend/\a
+ * itorecv and \a rtosend/\a rtorecv buffers of the external communicators.
+ * The first 2*\a next_comm requests exchange the integer buffers and the last
+ * 2*\a next_comm requests exchange the double buffers. The buffers must not be
+ * reallocated until the requests are freed by \ref PMMG_extComm_halo_free.
+ */
+int PMMG_extComm_halo_init( PMMG_pParMesh parmesh,PMMG_pExt_comm ext_comm,
+                            int next_comm,int nint,int ndouble,int tag,
+                            MPI_Request **request ) {
+  PMMG_pExt_comm pext_comm;
+  MPI_Request    *ireq,*rreq;
+  int            k,nitem,color,ier;
+
+  *request = NULL;
+  if ( !next_comm ) return 1;
+
+  PMMG_MALLOC(parmesh,*request,4*next_comm,MPI_Request,"halo requests",
+              return 0);
+  for ( k=0; k<4*next_comm; ++k )
+    (*request)[k] = MPI_REQUEST_NULL;
+
+  ireq = *request;
+  rreq = *request + 2*next_comm;
+  ier  = 1;
+
+  for ( k=0; k<next_comm; ++k ) {
+    pext_comm = &ext_comm[k];
+    nitem     = pext_comm->nitem;
+    color     = pext_comm->color_out;
+
+    MPI_CHECK( MPI_Send_init(pext_comm->itosend,nint*nitem,MPI_INT,color,tag,
+                             parmesh->comm,&ireq[2*k]), ier = 0 );
+    MPI_CHECK( MPI_Recv_init(pext_comm->itorecv,nint*nitem,MPI_INT,color,tag,
+                             parmesh->comm,&ireq[2*k+1]), ier = 0 );
+    MPI_CHECK( MPI_Send_init(pext_comm->rtosend,ndouble*nitem,MPI_DOUBLE,color,
+                             tag+1,parmesh->comm,&rreq[2*k]), ier = 0 );
+    MPI_CHECK( MPI_Recv_init(pext_comm->rtorecv,ndouble*nitem,MPI_DOUBLE,color,
+                             tag+1,parmesh->comm,&rreq[2*k+1]), ier = 0 );
+    if ( !ier ) {
+      PMMG_extComm_halo_free( parmesh,request,next_comm );
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param request array of persistent requests built by \ref PMMG_extComm_halo_init
+ * \param next_comm number of external communicators
+ * \param withDouble 1 to exchange the double buffers too, 0 otherwise
+ * \return 0 if fail, 1 if success.
+ *
+ * Exchange the buffers of the external communicators with all the neighbours
+ * at once: start all the persistent requests and wait for their completion.
+ */
+int PMMG_extComm_halo_exchange( PMMG_pParMesh parmesh,MPI_Request *request,
+                                int next_comm,int withDouble ) {
+  int nreq;
+
+  if ( !next_comm ) return 1;
+
+  assert ( request && "halo requests not initialized" );
+
+  nreq = withDouble ? 4*next_comm : 2*next_comm;
+
+  MPI_CHECK( MPI_Startall(nreq,request), return 0 );
+  MPI_CHECK( MPI_Waitall(nreq,request,MPI_STATUSES_IGNORE), return 0 );
+
+  return 1;
+}
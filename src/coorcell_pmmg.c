@@ -162,3 +162,155 @@ int PMMG_unscale_coorCellList (PMMG_coorCell *list,int nitem,double min[3],
 
   return 1;
 }
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param hash   pointer toward the hash table to initialize.
+ * \param list   array of PMMG_coorCell with scaled coordinates (in [0,1]).
+ * \param nitem  number of items in the list
+ * \param tol    matching tolerance on each coordinate.
+ *
+ * \return 1 if success, 0 if fail;
+ *
+ * Allocate an empty hash table of the cells of \a list. The number of
+ * quantization cells per direction is of the order of the square root of the
+ * number of items as the hashed points lie mostly on surfaces.
+ *
+ */
+int PMMG_coorHash_init(PMMG_pParMesh parmesh,PMMG_coorHash *hash,
+                       PMMG_coorCell *list,int nitem,double tol) {
+  int i;
+
+  hash->list    = list;
+  hash->tol     = tol;
+  hash->nbucket = MG_MAX(nitem,1);
+  hash->ncell   = MG_MIN(MG_MAX((int)sqrt((double)nitem),1),PMMG_COORHASH_MAXCELL);
+  hash->next    = NULL;
+
+  PMMG_MALLOC(parmesh,hash->head,hash->nbucket,int,"coor hash buckets",
+              return 0);
+  PMMG_MALLOC(parmesh,hash->next,hash->nbucket,int,"coor hash items",
+              PMMG_DEL_MEM(parmesh,hash->head,int,"coor hash buckets");
+              return 0);
+
+  for ( i=0; i<hash->nbucket; ++i ) {
+    hash->head[i] = PMMG_UNSET;
+    hash->next[i] = PMMG_UNSET;
+  }
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param hash   pointer toward the hash table.
+ *
+ * Free the hash table (the hashed list is not freed).
+ *
+ */
+void PMMG_coorHash_free(PMMG_pParMesh parmesh,PMMG_coorHash *hash) {
+
+  PMMG_DEL_MEM(parmesh,hash->head,int,"coor hash buckets");
+  PMMG_DEL_MEM(parmesh,hash->next,int,"coor hash items");
+}
+
+/**
+ * \param hash pointer toward the hash table.
+ * \param x    scaled coordinate.
+ *
+ * \return the index of the quantization cell of \a x along one direction.
+ *
+ */
+static inline
+int PMMG_coorHash_quantize(PMMG_coorHash *hash,double x) {
+  int i;
+
+  i = (int)(x*hash->ncell);
+
+  return MG_MIN(MG_MAX(i,0),hash->ncell-1);
+}
+
+/**
+ * \param hash pointer toward the hash table.
+ * \param i    quantization cell along the first direction.
+ * \param j    quantization cell along the second direction.
+ * \param k    quantization cell along the third direction.
+ *
+ * \return the bucket associated to the quantization cell.
+ *
+ */
+static inline
+int PMMG_coorHash_key(PMMG_coorHash *hash,int i,int j,int k) {
+  uint64_t key;
+
+  key = (uint64_t)i*73856093 ^ (uint64_t)j*19349663 ^ (uint64_t)k*83492791;
+
+  return (int)(key % (uint64_t)hash->nbucket);
+}
+
+/**
+ * \param hash pointer toward the hash table.
+ * \param c    scaled coordinates of the point to find.
+ *
+ * \return the index in the hashed list of a cell matching \a c at the hash
+ * tolerance (on each coordinate), -1 if not found.
+ *
+ * Only the quantization cells that intersect the tolerance box of \a c are
+ * visited (one cell, except for points close to a cell boundary).
+ *
+ */
+int PMMG_coorHash_find(PMMG_coorHash *hash,double c[3]) {
+  PMMG_coorCell *cell;
+  int           lo[3],hi[3],i,j,k,l,idx;
+
+  for ( l=0; l<3; ++l ) {
+    lo[l] = PMMG_coorHash_quantize(hash,c[l]-hash->tol);
+    hi[l] = PMMG_coorHash_quantize(hash,c[l]+hash->tol);
+  }
+
+  for ( i=lo[0]; i<=hi[0]; ++i ) {
+    for ( j=lo[1]; j<=hi[1]; ++j ) {
+      for ( k=lo[2]; k<=hi[2]; ++k ) {
+        idx = hash->head[PMMG_coorHash_key(hash,i,j,k)];
+
+        while ( idx >= 0 ) {
+          cell = &hash->list[idx];
+          if ( fabs(cell->c[0]-c[0]) <= hash->tol &&
+               fabs(cell->c[1]-c[1]) <= hash->tol &&
+               fabs(cell->c[2]-c[2]) <= hash->tol ) {
+            return idx;
+          }
+          idx = hash->next[idx];
+        }
+      }
+    }
+  }
+
+  return PMMG_UNSET;
+}
+
+/**
+ * \param hash pointer toward the hash table.
+ * \param idx  index of a cell of the hashed list.
+ *
+ * \return the index of the already hashed cell that matches the cell \a idx,
+ * \a idx if no cell matches (in this case the cell \a idx is hashed).
+ *
+ */
+int PMMG_coorHash_findOrAdd(PMMG_coorHash *hash,int idx) {
+  PMMG_coorCell *cell;
+  int           found,key;
+
+  cell  = &hash->list[idx];
+  found = PMMG_coorHash_find(hash,cell->c);
+  if ( found >= 0 ) return found;
+
+  key = PMMG_coorHash_key(hash,PMMG_coorHash_quantize(hash,cell->c[0]),
+                          PMMG_coorHash_quantize(hash,cell->c[1]),
+                          PMMG_coorHash_quantize(hash,cell->c[2]));
+
+  hash->next[idx] = hash->head[key];
+  hash->head[key] = idx;
+
+  return idx;
+}
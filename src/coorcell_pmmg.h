@@ -40,6 +40,12 @@
 #define PMMG_EPSCOOR  1.e-10
 #define PMMG_EPSCOOR2 3.e-20
 
+/* tolerance used to identify 2 coor cells (see PMMG_compare_coorCell) */
+#define PMMG_EPSCOORCELL (50.*MMG5_EPSOK)
+
+/* maximal number of quantization cells per direction in the coor hash */
+#define PMMG_COORHASH_MAXCELL 1048576
+
 /**
  * \struct PMMG_coorCell
  *
@@ -52,10 +58,31 @@ typedef struct {
   int     grp;  /*!< a group to which belong the point */
 } PMMG_coorCell;
 
+/**
+ * \struct PMMG_coorHash
+ *
+ * \brief Hash table of coor cells whose (scaled) coordinates are quantized on a
+ * regular grid of the unit cube: allows to find the cells that match a point
+ * at a given tolerance in constant time.
+ *
+ */
+typedef struct {
+  PMMG_coorCell *list; /*!< hashed cells (scaled coordinates in [0,1]) */
+  int           *head; /*!< first cell of each bucket */
+  int           *next; /*!< next cell of the same bucket */
+  int           nbucket; /*!< number of buckets */
+  int           ncell; /*!< number of quantization cells per direction */
+  double        tol; /*!< matching tolerance on each coordinate */
+} PMMG_coorHash;
+
 
 int PMMG_compare_coorCell (const void * a, const void * b);
 int PMMG_find_coorCellListBoundingBox(PMMG_coorCell*,int,double*,double*,double*);
 int PMMG_scale_coorCellList (PMMG_coorCell*,int,double*,double*,double*);
 int PMMG_unscale_coorCellList (PMMG_coorCell*,int,double*,double*,double);
+int PMMG_coorHash_init(PMMG_pParMesh,PMMG_coorHash*,PMMG_coorCell*,int,double);
+void PMMG_coorHash_free(PMMG_pParMesh,PMMG_coorHash*);
+int PMMG_coorHash_find(PMMG_coorHash*,double c[3]);
+int PMMG_coorHash_findOrAdd(PMMG_coorHash*,int);
 
 #endif
@@ -946,6 +946,223 @@ end:
   return ier;
 }
 
+/**
+ * \struct PMMG_grpsTransfer
+ * \brief Packed groups of a redistribution round whose transfer is pending.
+ *
+ * The communicators are updated pair of processors by pair of processors but
+ * the sends and receptions of the packed groups are all posted without waiting
+ * for their completion. The received groups are unpacked at the end of the
+ * round, as soon as their buffer arrives.
+ */
+typedef struct {
+  int          nsend; /*!< Number of pending sends */
+  MPI_Request  *sreq; /*!< Requests of the pending sends */
+  char         **sbuf; /*!< Buffers of the pending sends */
+  int          nrecv; /*!< Number of pending receptions */
+  MPI_Request  *rreq; /*!< Requests of the pending receptions */
+  char         **rbuf; /*!< Buffers of the pending receptions */
+  int          *rngrp; /*!< Number of groups packed in each received buffer */
+  MMG5_pMesh   **rmesh; /*!< Placeholder meshes of the groups of each received buffer */
+} PMMG_grpsTransfer;
+typedef PMMG_grpsTransfer * PMMG_pGrpsTransfer;
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param transfer pointer toward the pending transfers.
+ *
+ * \return 0 if fail, 1 if success.
+ *
+ * Allocate the arrays of pending transfers (each proc sends and receives at
+ * most one buffer per other proc in a redistribution round).
+ *
+ */
+static inline
+int PMMG_grpsTransfer_init( PMMG_pParMesh parmesh,PMMG_pGrpsTransfer transfer ) {
+  const int nprocs = parmesh->nprocs;
+  int       k;
+
+  memset(transfer,0,sizeof(PMMG_grpsTransfer));
+
+  PMMG_MALLOC(parmesh,transfer->sreq,nprocs,MPI_Request,"pending sends",
+              return 0);
+  PMMG_CALLOC(parmesh,transfer->sbuf,nprocs,char*,"send buffers",
+              return 0);
+  PMMG_MALLOC(parmesh,transfer->rreq,nprocs,MPI_Request,"pending receptions",
+              return 0);
+  PMMG_CALLOC(parmesh,transfer->rbuf,nprocs,char*,"reception buffers",
+              return 0);
+  PMMG_CALLOC(parmesh,transfer->rngrp,nprocs,int,"received groups",
+              return 0);
+  PMMG_CALLOC(parmesh,transfer->rmesh,nprocs,MMG5_pMesh*,"placeholder meshes",
+              return 0);
+
+  for ( k=0; k<nprocs; ++k ) {
+    transfer->sreq[k] = MPI_REQUEST_NULL;
+    transfer->rreq[k] = MPI_REQUEST_NULL;
+  }
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param transfer pointer toward the pending transfers.
+ *
+ * Deallocate the arrays of pending transfers.
+ *
+ */
+static inline
+void PMMG_grpsTransfer_free( PMMG_pParMesh parmesh,PMMG_pGrpsTransfer transfer ) {
+  int k;
+
+  for ( k=0; k<parmesh->nprocs; ++k ) {
+    if ( transfer->sbuf && transfer->sbuf[k] )
+      PMMG_DEL_MEM(parmesh,transfer->sbuf[k],char,"grps2send");
+    if ( transfer->rbuf && transfer->rbuf[k] )
+      PMMG_DEL_MEM(parmesh,transfer->rbuf[k],char,"buffer");
+    if ( transfer->rmesh && transfer->rmesh[k] )
+      PMMG_DEL_MEM(parmesh,transfer->rmesh[k],MMG5_pMesh,"placeholder meshes");
+  }
+  PMMG_DEL_MEM(parmesh,transfer->sreq,MPI_Request,"pending sends");
+  PMMG_DEL_MEM(parmesh,transfer->sbuf,char*,"send buffers");
+  PMMG_DEL_MEM(parmesh,transfer->rreq,MPI_Request,"pending receptions");
+  PMMG_DEL_MEM(parmesh,transfer->rbuf,char*,"reception buffers");
+  PMMG_DEL_MEM(parmesh,transfer->rngrp,int,"received groups");
+  PMMG_DEL_MEM(parmesh,transfer->rmesh,MMG5_pMesh*,"placeholder meshes");
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param grp pointer toward the group to create.
+ * \param nitem number of faces in the group face communicator
+ * \param face2int indices of the group faces (\a nitem values) followed by
+ * their positions in the internal face communicator (\a nitem values).
+ *
+ * \return 0 if fail, 1 if success.
+ *
+ * Create a received group before the reception of its mesh: only the face
+ * communicator is filled (it is needed by the communicator updates of the
+ * next transfers of the round) and the mesh is an empty placeholder that
+ * identifies the group until its unpacking.
+ *
+ */
+static inline
+int PMMG_create_pendingGrp( PMMG_pParMesh parmesh,PMMG_pGrp grp,int nitem,
+                            int *face2int ) {
+  int k;
+
+  grp->flag = PMMG_UNSET;
+
+  if ( 1 != MMG3D_Init_mesh( MMG5_ARG_start,
+                             MMG5_ARG_ppMesh,&grp->mesh,
+                             MMG5_ARG_ppMet ,&grp->met,
+                             MMG5_ARG_end) ) return 0;
+
+  PMMG_MALLOC(parmesh,grp->face2int_face_comm_index1,nitem,int,
+              "face2int_face_comm_index1",return 0);
+  PMMG_MALLOC(parmesh,grp->face2int_face_comm_index2,nitem,int,
+              "face2int_face_comm_index2",
+              PMMG_DEL_MEM(parmesh,grp->face2int_face_comm_index1,int,
+                           "face2int_face_comm_index1");
+              return 0);
+  grp->nitem_int_face_comm = nitem;
+
+  for ( k=0; k<nitem; ++k ) {
+    grp->face2int_face_comm_index1[k] = face2int[k];
+    grp->face2int_face_comm_index2[k] = face2int[nitem+k];
+  }
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param placeholder placeholder mesh of the group to unpack.
+ * \param buffer pointer toward the buffer in which the group is packed.
+ *
+ * \return 0 if fail, 1 if success.
+ *
+ * Unpack a received group in place of its placeholder. The face communicator
+ * of the group may have been renumbered since the group creation, so the
+ * unpacked one is replaced by the current one.
+ *
+ */
+static inline
+int PMMG_unpack_pendingGrp( PMMG_pParMesh parmesh,MMG5_pMesh placeholder,
+                            char **buffer ) {
+  PMMG_pGrp grp;
+  int       igrp,nitem,*index1,*index2,ier;
+
+  for ( igrp=0; igrp<parmesh->ngrp; ++igrp ) {
+    if ( parmesh->listgrp[igrp].mesh == placeholder ) break;
+  }
+  if ( igrp == parmesh->ngrp ) return 0;
+
+  grp    = &parmesh->listgrp[igrp];
+  nitem  = grp->nitem_int_face_comm;
+  index1 = grp->face2int_face_comm_index1;
+  index2 = grp->face2int_face_comm_index2;
+  grp->face2int_face_comm_index1 = grp->face2int_face_comm_index2 = NULL;
+  grp->nitem_int_face_comm = 0;
+
+  MMG3D_Free_all( MMG5_ARG_start,
+                  MMG5_ARG_ppMesh,&grp->mesh,
+                  MMG5_ARG_ppMet ,&grp->met,
+                  MMG5_ARG_end );
+
+  ier = PMMG_mpiunpack_grp(parmesh,parmesh->listgrp,igrp,buffer);
+
+  assert ( grp->nitem_int_face_comm == nitem );
+  PMMG_DEL_MEM(parmesh,grp->face2int_face_comm_index1,int,
+               "face2int_face_comm_index1");
+  PMMG_DEL_MEM(parmesh,grp->face2int_face_comm_index2,int,
+               "face2int_face_comm_index2");
+  grp->nitem_int_face_comm       = nitem;
+  grp->face2int_face_comm_index1 = index1;
+  grp->face2int_face_comm_index2 = index2;
+  grp->flag                      = PMMG_UNSET;
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param transfer pointer toward the pending transfers.
+ *
+ * \return 0 if fail, 1 if success.
+ *
+ * Complete the pending transfers of a redistribution round: unpack each
+ * received buffer as soon as it arrives, then wait for the end of the sends.
+ *
+ */
+static inline
+int PMMG_grpsTransfer_complete( PMMG_pParMesh parmesh,
+                                PMMG_pGrpsTransfer transfer ) {
+  char       *ptr;
+  int        ier,err,k,i,ireq;
+
+  ier = 1;
+
+  for ( k=0; k<transfer->nrecv; ++k ) {
+    MPI_CHECK( MPI_Waitany(transfer->nrecv,transfer->rreq,&ireq,
+                           MPI_STATUS_IGNORE), ier = 0; break );
+    if ( ireq == MPI_UNDEFINED ) break;
+
+    ptr = transfer->rbuf[ireq];
+    for ( i=0; i<transfer->rngrp[ireq]; ++i ) {
+      err = PMMG_unpack_pendingGrp(parmesh,transfer->rmesh[ireq][i],&ptr);
+      ier = MG_MIN(ier,err);
+    }
+    PMMG_DEL_MEM(parmesh,transfer->rbuf[ireq],char,"buffer");
+  }
+
+  MPI_CHECK( MPI_Waitall(transfer->nsend,transfer->sreq,MPI_STATUSES_IGNORE),
+             ier = 0 );
+
+  return ier;
+}
+
 /**
  * \param parmesh pointer toward the mesh structure.
  * \param recv index of the proc that receive the groups
@@ -956,8 +1173,9 @@ end:
  * \param nitem_recv_ext_idx size of recv_ext_idx buffer
  * \param ext_recv_comm external communicator \a myrank - \a recv
  * \param irequest mpi request of the send of the integer buffer
- * \param drequest mpi request of the send of the double buffer
  * \param trequest array of mpi requests of the send of the external comm
+ * \param transfer pending transfers of the round (the send of the packed
+ * groups is appended to it)
  *
  * \return 0 if fail, 1 if we success
  *
@@ -970,9 +1188,9 @@ int PMMG_transfer_grps_fromMetoJ(PMMG_pParMesh parmesh,const int recv,
                                  int *interaction_map,int **intcomm_flag,
                                  int *nitem_intcomm_flag,int **recv_ext_idx,
                                  int *nitem_recv_ext_idx,
-                                 PMMG_pExt_comm ext_recv_comm,char **grps2send,
-                                 int *pack_size,MPI_Request *irequest,
-                                 MPI_Request *drequest,MPI_Request **trequest ) {
+                                 PMMG_pExt_comm ext_recv_comm,
+                                 MPI_Request *irequest,MPI_Request **trequest,
+                                 PMMG_pGrpsTransfer transfer ) {
 
   PMMG_pGrp      grp;
   PMMG_pInt_comm int_comm;
@@ -982,7 +1200,8 @@ int PMMG_transfer_grps_fromMetoJ(PMMG_pParMesh parmesh,const int recv,
   int            k,i,count,ier,ier0,old_nitem,idx;
   int            *send2recv_int_comm,old_offset,nitem,nextcomm;
   int            nitem_ext_recv_comm;
-  char           *ptr;
+  size_t         pack_size;
+  char           *grps2send,*ptr;
 
   const int      myrank      = parmesh->myrank;
   const int      nprocs      = parmesh->nprocs;
@@ -1299,14 +1518,11 @@ int PMMG_transfer_grps_fromMetoJ(PMMG_pParMesh parmesh,const int recv,
     }
   }
 
-  /** Step 5: send the buffer to the proc recv */
-  *irequest = MPI_REQUEST_NULL;
-  assert ( *nitem_recv_ext_idx == offset );
-  MPI_CHECK ( MPI_Isend(*recv_ext_idx,*nitem_recv_ext_idx,MPI_INT,recv,
-                        MPI_TRANSFER_GRP_TAG+3, comm,irequest), ier = 0 );
-
-  /** Step 6: send and receive the groups */
-  *pack_size = 0;
+  /** Step 5: Update the face communicators of the groups to send and append
+   * to the buffer the size of the packed groups and the face communicators of
+   * the groups (the proc recv needs them before the reception of the groups) */
+  pack_size = 0;
+  nitem     = 0;
   for ( k=0; k<ngrp; ++k ) {
     grp = &parmesh->listgrp[k];
     if ( grp->flag != recv ) continue;
@@ -1317,14 +1533,44 @@ int PMMG_transfer_grps_fromMetoJ(PMMG_pParMesh parmesh,const int recv,
       grp->face2int_face_comm_index2[i] = send2recv_int_comm ? send2recv_int_comm[idx] : 0;
     }
 
-    *pack_size += PMMG_mpisizeof_grp(grp);
+    pack_size += PMMG_mpisizeof_grp(grp);
+    nitem     += 1 + 2*grp->nitem_int_face_comm;
   }
 
-  /* Pack the groups */
-  PMMG_MALLOC ( parmesh,*grps2send,*pack_size,char,"grps2send",
+  PMMG_REALLOC ( parmesh,*recv_ext_idx,*nitem_recv_ext_idx+2+nitem,
+                 *nitem_recv_ext_idx,int,"recv_ext_idx",ier=0);
+  *nitem_recv_ext_idx += 2 + nitem;
+
+  if ( *recv_ext_idx ) {
+    /* The pack size may overflow an int: store it as a number of chunks and a
+     * remainder */
+    (*recv_ext_idx)[offset++] = (int)(pack_size / PMMG_MPI_CHUNK_SIZE);
+    (*recv_ext_idx)[offset++] = (int)(pack_size % PMMG_MPI_CHUNK_SIZE);
+
+    for ( k=0; k<ngrp; ++k ) {
+      grp = &parmesh->listgrp[k];
+      if ( grp->flag != recv ) continue;
+
+      (*recv_ext_idx)[offset++] = grp->nitem_int_face_comm;
+      for ( i=0; i<grp->nitem_int_face_comm; ++i )
+        (*recv_ext_idx)[offset++] = grp->face2int_face_comm_index1[i];
+      for ( i=0; i<grp->nitem_int_face_comm; ++i )
+        (*recv_ext_idx)[offset++] = grp->face2int_face_comm_index2[i];
+    }
+  }
+
+  /** Step 6: send the buffer to the proc recv */
+  *irequest = MPI_REQUEST_NULL;
+  assert ( *nitem_recv_ext_idx == offset );
+  MPI_CHECK ( MPI_Isend(*recv_ext_idx,*nitem_recv_ext_idx,MPI_INT,recv,
+                        MPI_TRANSFER_GRP_TAG+3, comm,irequest), ier = 0 );
+
+  /** Step 7: Pack the groups and post their send (its completion is awaited at
+   * the end of the redistribution round) */
+  PMMG_MALLOC ( parmesh,grps2send,pack_size,char,"grps2send",
                 ier = MG_MIN(ier,0) );
 
-  ptr = *grps2send;
+  ptr = grps2send;
   for ( k=0; k<ngrp; ++k ) {
     grp = &parmesh->listgrp[k];
 
@@ -1333,9 +1579,14 @@ int PMMG_transfer_grps_fromMetoJ(PMMG_pParMesh parmesh,const int recv,
   }
 
   /* Send its */
-  *drequest = MPI_REQUEST_NULL;
-  MPI_CHECK ( MPI_Isend ( *grps2send,*pack_size,MPI_CHAR,recv,MPI_SENDGRP_TAG,
-                           comm,drequest), ier = 0 );
+  assert ( transfer->nsend < nprocs );
+  transfer->sbuf[transfer->nsend] = grps2send;
+  if ( !PMMG_Isend_bigChar(grps2send,pack_size,recv,MPI_SENDGRP_TAG,comm,
+                           &transfer->sreq[transfer->nsend]) ) {
+    ier = 0;
+  }
+  ++transfer->nsend;
+  PMMG_trace_addBytes(parmesh,pack_size);
 
   /** Free the memory */
   /* Group deletion */
@@ -1360,6 +1611,9 @@ int PMMG_transfer_grps_fromMetoJ(PMMG_pParMesh parmesh,const int recv,
  * \param recv_ext_idx buffer to receive data
  * \param nitem_recv_ext_idx size of recv_ext_idx buffer
  * \param ext_send_comm external communicator \a myrank - \a sndr
+ * \param irequest mpi request of the send of the integer buffer
+ * \param transfer pending transfers of the round (the reception of the packed
+ * groups is appended to it)
  *
  * \return 0 if fail, 1 if we success
  *
@@ -1373,15 +1627,16 @@ int PMMG_transfer_grps_fromItoMe(PMMG_pParMesh parmesh,const int sndr,
                                  int *nitem_intcomm_flag,int **recv_ext_idx,
                                  int *nitem_recv_ext_idx,
                                  PMMG_pExt_comm ext_send_comm,
-                                 MPI_Request *irequest) {
+                                 MPI_Request *irequest,
+                                 PMMG_pGrpsTransfer transfer) {
 
   PMMG_pExt_comm ext_face_comm;
   MPI_Status     status;
-  int            pack_size;
+  size_t         pack_size;
   int            k,ier,ier0,recv_int_nitem,offset,old_nitem;
   int            *send2recv_int_comm,nitem,nextcomm;
   int            old_offset,grpscount,idx,color_out,n,err;
-  char           *buffer,*ptr;
+  char           *buffer;
 
   const int      myrank      = parmesh->myrank;
   const int      ngrp        = parmesh->ngrp;
@@ -1565,14 +1820,12 @@ int PMMG_transfer_grps_fromItoMe(PMMG_pParMesh parmesh,const int sndr,
   }
 
 
-  /** Step 5: Receive the new groups */
-  MPI_CHECK ( MPI_Probe(sndr,MPI_SENDGRP_TAG,comm,&status), ier = 0 );
-  MPI_CHECK ( MPI_Get_count(&status,MPI_CHAR,&pack_size), ier = 0 );
-
-  PMMG_MALLOC ( parmesh,buffer,pack_size,char,"buffer", ier = 0 );
-
-  MPI_CHECK ( MPI_Recv(buffer,pack_size,MPI_CHAR,sndr,MPI_SENDGRP_TAG,comm,&status),
-              ier = 0 );
+  /** Step 5: Create the new groups with their face communicators (needed by
+   * the communicator updates of the next transfers) and post the reception of
+   * the packed groups (they are unpacked at the end of the redistribution
+   * round) */
+  pack_size  = (size_t)(*recv_ext_idx)[offset++] * PMMG_MPI_CHUNK_SIZE;
+  pack_size += (size_t)(*recv_ext_idx)[offset++];
 
   ier0 = 1;
   if( ngrp ) {
@@ -1592,6 +1845,8 @@ int PMMG_transfer_grps_fromItoMe(PMMG_pParMesh parmesh,const int sndr,
 #ifndef NDEBUG
   for ( k=0; k<ngrp; ++k ) {
     mesh = parmesh->listgrp[k].mesh;
+    /* Skip the groups that are not yet unpacked */
+    if ( !mesh->np ) continue;
     assert ( mesh->npmax == mesh->np );
     assert ( mesh->xpmax == mesh->xp );
     assert ( mesh->nemax == mesh->ne );
@@ -1599,17 +1854,33 @@ int PMMG_transfer_grps_fromItoMe(PMMG_pParMesh parmesh,const int sndr,
   }
 #endif
 
-  ptr = buffer;
-  if ( ier0 ) {
-    for ( k=0; k<grpscount; ++k ) {
-      err = PMMG_mpiunpack_grp(parmesh,parmesh->listgrp,ngrp+k,&ptr);
+  assert ( transfer->nrecv < parmesh->nprocs );
+  if ( ier0 && grpscount ) {
+    PMMG_CALLOC ( parmesh,transfer->rmesh[transfer->nrecv],grpscount,MMG5_pMesh,
+                  "placeholder meshes",ier0 = 0;ier = 0 );
+  }
+
+  for ( k=0; k<grpscount; ++k ) {
+    n = (*recv_ext_idx)[offset++];
+    if ( ier0 ) {
+      err = PMMG_create_pendingGrp(parmesh,&parmesh->listgrp[ngrp+k],n,
+                                   &(*recv_ext_idx)[offset]);
       ier = MG_MIN(ier,err);
-      parmesh->listgrp[ngrp+k].flag = PMMG_UNSET;
+      transfer->rmesh[transfer->nrecv][k] = parmesh->listgrp[ngrp+k].mesh;
     }
+    offset += 2*n;
+  }
+  transfer->rngrp[transfer->nrecv] = ier0 ? grpscount : 0;
+
+  PMMG_MALLOC ( parmesh,buffer,pack_size,char,"buffer", ier = 0 );
+  transfer->rbuf[transfer->nrecv] = buffer;
 
+  if ( !PMMG_Irecv_bigChar(buffer,pack_size,sndr,MPI_SENDGRP_TAG,comm,
+                           &transfer->rreq[transfer->nrecv]) ) {
+    ier = 0;
   }
+  ++transfer->nrecv;
 
-  PMMG_DEL_MEM ( parmesh,buffer,char,"buffer" );
   return ier;
 }
 
@@ -1620,25 +1891,28 @@ int PMMG_transfer_grps_fromItoMe(PMMG_pParMesh parmesh,const int sndr,
  * \param interaction_map map of interactions with the other processors
  * \param called_from_distrib_mesh 1 if called for initial mesh distrib.
  * In this case do not print warnings about empty procs.
+ * \param transfer pending transfers of the packed groups of the round
  *
  * \return 0 if fail, 1 if we success
  *
  * Transfer and update the data that are modified due to the transfer of the
- * groups from the proc \a sndr toward the proc \a recv.
+ * groups from the proc \a sndr toward the proc \a recv. The transfer of the
+ * packed groups is only posted: it is completed by \ref
+ * PMMG_grpsTransfer_complete.
  *
  */
 static inline
 int PMMG_transfer_grps_fromItoJ(PMMG_pParMesh parmesh,const int sndr,
                                 const int recv,int *interaction_map,
-                                int called_from_distrib_mesh) {
+                                int called_from_distrib_mesh,
+                                PMMG_pGrpsTransfer transfer) {
 
   PMMG_pExt_comm ext_face_comm,ext_send_comm,ext_recv_comm;
   MPI_Status     status;
-  MPI_Request    irequest,drequest;
+  MPI_Request    irequest;
   MPI_Request    *trequest;
-  int            k,count,ier,ier0,*recv_ext_idx,old_nitem,idx,pack_size,err;
+  int            k,count,ier,ier0,*recv_ext_idx,old_nitem,idx,err;
   int            *intcomm_flag,nitem_intcomm_flag,nitem_recv_ext_idx;
-  char           *grps2send;
   static int8_t  pmmgWarn = 0;
 
   const int      myrank      = parmesh->myrank;
@@ -1684,15 +1958,15 @@ int PMMG_transfer_grps_fromItoJ(PMMG_pParMesh parmesh,const int sndr,
     ier = PMMG_transfer_grps_fromMetoJ(parmesh,recv,interaction_map,
                                        &intcomm_flag,&nitem_intcomm_flag,
                                        &recv_ext_idx,&nitem_recv_ext_idx,
-                                       ext_recv_comm,&grps2send,&pack_size,
-                                       &irequest,&drequest,&trequest);
+                                       ext_recv_comm,&irequest,&trequest,
+                                       transfer);
   }
   else if ( myrank == recv ) {
     /* i = sndr */
     ier = PMMG_transfer_grps_fromItoMe(parmesh,sndr,interaction_map,
                                        &intcomm_flag,&nitem_intcomm_flag,
                                        &recv_ext_idx,&nitem_recv_ext_idx,
-                                       ext_send_comm,&irequest);
+                                       ext_send_comm,&irequest,transfer);
   }
   else {
     /* Transfer the faces of external communicators between the sender and a
@@ -1790,10 +2064,6 @@ int PMMG_transfer_grps_fromItoJ(PMMG_pParMesh parmesh,const int sndr,
     PMMG_DEL_MEM ( parmesh, trequest,MPI_Request,"request_tab" );
 
     MPI_CHECK( MPI_Wait(&irequest,&status), return 0 );
-    MPI_CHECK( MPI_Wait(&drequest,&status), return 0 );
-
-    /* Free the memory */
-    PMMG_DEL_MEM ( parmesh,grps2send,char,"grps2send" );
   }
   else if ( myrank == recv ) {
     MPI_CHECK( MPI_Wait(&irequest,&status), return 0 );
@@ -1849,8 +2119,11 @@ int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_dis
   int            *next_comm2send,*ext_comms_next_idx,*nitems2send;
   int            *extComm_next_idx,*items_next_idx,*recv_array;
   int            *extComm_grpFaces2extComm,*extComm_grpFaces2face2int;
+  int            *moved_procs;
   int            max_ngrp;
   int            ier,k,i,j,err;
+  int8_t         keepIntComm;
+  PMMG_grpsTransfer transfer;
 
   myrank    = parmesh->myrank;
   nprocs    = parmesh->nprocs;
@@ -1871,6 +2144,7 @@ int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_dis
   recv_array                = NULL;
   interaction_map           = NULL;
   interactions              = NULL;
+  moved_procs               = NULL;
 
   /** Step 1: Merge all the groups that must be sended to a given proc into 1
    * group */
@@ -1901,9 +2175,49 @@ int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_dis
             " partition. Try to send it nevertheless.\n",__func__);
   }
 
-  /** Step 2: Nodal communicators deletion (unallocation to remove, at least for
+  /** Step 2: Detect the processors that send or receive groups. The internal
+   * node communicator of a processor that neither sends nor receives groups
+   * remains valid and is kept. If no group moves, the communicators remain
+   * valid and there is nothing to do. */
+  err = 1;
+  PMMG_CALLOC(parmesh,moved_procs,nprocs,int,"moved_procs",err = 0);
+  MPI_Allreduce( MPI_IN_PLACE, &err, 1, MPI_INT, MPI_MIN, comm);
+
+  if ( !err ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to allocate the list of"
+            " modified processors.\n",__func__);
+    ier = -1;
+    goto end;
+  }
+
+  for ( k=0; k<parmesh->ngrp; ++k ) {
+    if ( parmesh->listgrp[k].flag != myrank ) {
+      /* Mark the sender and the receiver of the group */
+      moved_procs[myrank] = 1;
+      moved_procs[parmesh->listgrp[k].flag] = 1;
+    }
+  }
+  MPI_Allreduce( MPI_IN_PLACE, moved_procs, nprocs, MPI_INT, MPI_MAX, comm);
+
+  for ( k=0; k<nprocs; ++k ) {
+    if ( moved_procs[k] ) break;
+  }
+  if ( k==nprocs ) {
+    /* No group transfer */
+    goto end;
+  }
+  keepIntComm = !moved_procs[myrank];
+
+  /** Nodal communicators deletion (unallocation to remove, at least for
    * the external communicators) */
-  PMMG_node_comm_free(parmesh);
+  if ( keepIntComm ) {
+    PMMG_parmesh_ext_comm_free( parmesh,parmesh->ext_node_comm,parmesh->next_node_comm);
+    PMMG_DEL_MEM(parmesh, parmesh->ext_node_comm,PMMG_Ext_comm,"ext node comm");
+    parmesh->next_node_comm = 0;
+  }
+  else {
+    PMMG_node_comm_free(parmesh);
+  }
 
   /** Step 3: Compute the map of interactions, if fail, consider that each proc
    * interacts with all the other procs (worst case)
@@ -1926,8 +2240,19 @@ int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_dis
   }
 
   /** Step 4: proc k send its data (group and/or communicators), proc j receive
-   * data */
-  ier = 1;
+   * data. The communicators are updated pair by pair but the transfers of the
+   * packed groups are all posted at once and completed at the end of the round
+   * (each buffer is unpacked as soon as it arrives). */
+  ier = PMMG_grpsTransfer_init(parmesh,&transfer);
+  MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, comm);
+
+  if ( !ier ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to allocate the pending"
+            " transfers.\n",__func__);
+    PMMG_grpsTransfer_free(parmesh,&transfer);
+    ier = -1;
+    goto end;
+  }
 
   if ( interactions ) {
     for ( k=0; k<ninteractions; ++k ) {
@@ -1936,7 +2261,8 @@ int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_dis
       if ( i==j ) {
         continue;
       }
-      err =  PMMG_transfer_grps_fromItoJ(parmesh,i,j,interaction_map,called_from_distrib_mesh);
+      err =  PMMG_transfer_grps_fromItoJ(parmesh,i,j,interaction_map,
+                                         called_from_distrib_mesh,&transfer);
       ier = MG_MIN ( ier,err );
     }
   }
@@ -1946,11 +2272,17 @@ int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_dis
         if ( j==k ) {
           continue;
         }
-        err =  PMMG_transfer_grps_fromItoJ(parmesh,k,j,interaction_map,called_from_distrib_mesh);
+        err =  PMMG_transfer_grps_fromItoJ(parmesh,k,j,interaction_map,
+                                           called_from_distrib_mesh,&transfer);
         ier = MG_MIN ( ier,err );
       }
     }
   }
+
+  err = PMMG_grpsTransfer_complete(parmesh,&transfer);
+  ier = MG_MIN ( ier,err );
+  PMMG_grpsTransfer_free(parmesh,&transfer);
+
   MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, comm);
 
   if ( ier <= 0 ) {
@@ -1960,8 +2292,9 @@ int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_dis
     goto end;
   }
 
-  /** Step 6: Node communicators reconstruction from the face ones */
-  if ( !PMMG_build_nodeCommFromFaces(parmesh) ) {
+  /** Step 6: Node communicators reconstruction from the face ones (only the
+   * external ones on the processors that have not been modified) */
+  if ( !PMMG_build_nodeCommFromFaces(parmesh,keepIntComm) ) {
     fprintf(stderr,"\n  ## Unable to build the new node communicators from"
             " the face ones.\n");
     ier = -1;
@@ -1980,6 +2313,8 @@ int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_dis
   if ( !err )  ier = 1;
 
 end:
+  if ( moved_procs )
+    PMMG_DEL_MEM(parmesh,moved_procs,int,"moved_procs");
   if ( interaction_map )
     PMMG_DEL_MEM(parmesh,interaction_map,int,"interaction_map");
   if ( interactions )
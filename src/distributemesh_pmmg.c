@@ -1023,7 +1023,7 @@ int PMMG_partBcast_mesh( PMMG_pParMesh parmesh )
   PMMG_CALLOC ( parmesh,part,ne,idx_t,"allocate metis buffer", ier=5 );
 
   if ( (!parmesh->myrank) && nprocs > 1 ) {
-    if ( !PMMG_part_meshElts2metis( parmesh, part, parmesh->nprocs ) ) {
+    if ( !PMMG_part_meshElts( parmesh, part, parmesh->nprocs ) ) {
       ier = 5;
     }
     if( !PMMG_fix_contiguity_centralized( parmesh,part ) ) ier = 5;
@@ -1136,7 +1136,7 @@ int PMMG_distribute_mesh( PMMG_pParMesh parmesh )
     /* Call metis, or recover a custom partitioning if provided (only to debug
      * the interface displacement, adaptation will be blocked) */
     if( !PMMG_PREDEF_PART ) {
-      if ( !PMMG_part_meshElts2metis( parmesh, part, parmesh->nprocs ) ) {
+      if ( !PMMG_part_meshElts( parmesh, part, parmesh->nprocs ) ) {
         ier = 5;
       }
       if( !PMMG_fix_contiguity_centralized( parmesh,part ) ) ier = 5;
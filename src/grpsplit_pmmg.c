@@ -33,6 +33,7 @@
  */
 #include "parmmg.h"
 #include "metis_pmmg.h"
+#include "sfc_pmmg.h"
 
 /**
  * \param nelem number of elements in the initial group
@@ -201,23 +202,24 @@ static int PMMG_f2ifcAppend( PMMG_pParMesh parmesh, PMMG_pGrp grp, int *max,
  *
  * Creation of a mimimal size new group for the background mesh (without
  * communication structures, info.inputMet == 1 if a metrics is provided by the
- * user).
+ * user). Only the data read by the interpolation are stored: the vertices, the
+ * tetra and their adjacency, the boundary triangles, the metrics and the
+ * fields. Arrays are allocated without spare capacity, and without boundary
+ * entities (xpoint/xtetra), level-set, displacement or file names.
  *
  */
 int PMMG_create_oldGrp( PMMG_pParMesh parmesh,int igrp ) {
   MMG5_pMesh const meshOld  = parmesh->listgrp[igrp].mesh;
   MMG5_pSol  const metOld   = parmesh->listgrp[igrp].met;
-  MMG5_pSol  const dispOld  = parmesh->listgrp[igrp].disp;
-  MMG5_pSol  const lsOld    = parmesh->listgrp[igrp].ls;
   MMG5_pSol  const fieldOld = parmesh->listgrp[igrp].field;
   PMMG_pGrp        grp;
   MMG5_pMesh       mesh;
-  MMG5_pSol        met,ls,disp,field,psl,pslOld;
+  MMG5_pSol        met,field,psl,pslOld;
   MMG5_pTetra      pt,ptCur;
   MMG5_pPoint      ppt,pptCur;
   MMG5_Hash        hash;
   int              *adja,*oldAdja;
-  int              ie,ip,is;
+  int              ie,ip,is,ismet;
 
   grp = &parmesh->old_listgrp[igrp];
   grp->mesh = NULL;
@@ -237,23 +239,6 @@ int PMMG_create_oldGrp( PMMG_pParMesh parmesh,int igrp ) {
   /* Set maximum memory */
   mesh->memMax = parmesh->memGloMax;
 
-  if ( lsOld ) {
-    PMMG_CALLOC(parmesh,grp->ls,1,MMG5_Sol,"ls",return 0);
-    ls = grp->ls;
-  }
-  else {
-    ls = NULL;
-  }
-
-  if ( dispOld ) {
-    assert ( meshOld->nsols );
-    PMMG_CALLOC(parmesh,grp->disp,1,MMG5_Sol,"disp",return 0);
-    disp = grp->disp;
-  }
-  else {
-    disp = NULL;
-  }
-
   if ( meshOld->nsols ) {
     assert ( fieldOld );
     mesh->nsols = meshOld->nsols;
@@ -266,52 +251,19 @@ int PMMG_create_oldGrp( PMMG_pParMesh parmesh,int igrp ) {
 
   /** 1) Create old group */
 
-  /* Copy the mesh and metric,ls,disp and fields filenames */
-  if ( !MMG5_Set_inputMeshName(  mesh,meshOld->namein) )      return 0;
-  if ( !MMG5_Set_inputSolName(   mesh,met,metOld->namein ) )  return 0;
-  if ( ls   && !MMG5_Set_inputSolName( mesh,ls,lsOld->namein     ) )  return 0;
-  if ( disp && !MMG5_Set_inputSolName( mesh,disp,dispOld->namein ) )  return 0;
-
-  if ( !MMG5_Set_outputMeshName( mesh,meshOld->nameout ) )    return 0;
-  if ( !MMG5_Set_outputSolName(  mesh,met,metOld->nameout ) ) return 0;
-  if ( ls   && !MMG5_Set_outputSolName( mesh,  ls,lsOld->nameout   ) ) return 0;
-  if ( disp && !MMG5_Set_outputSolName( mesh,disp,dispOld->nameout ) ) return 0;
-
-  if ( field ) {
-    for ( is=0; is<mesh->nsols; ++is ) {
-      psl    = field    + is;
-      pslOld = fieldOld + is;
-      if ( !MMG5_Set_inputSolName ( mesh,psl,pslOld->namein ) )  return 0;
-      if ( !MMG5_Set_outputSolName( mesh,psl,pslOld->nameout ) )  return 0;
-    }
-  }
-
   /* Set sizes and allocate new mesh */
   if ( !PMMG_setMeshSize( mesh,meshOld->np,meshOld->ne,0,0,0) )
     return 0;
 
   PMMG_CALLOC(mesh,mesh->adja,4*mesh->nemax+5,int,"tetra adjacency table",return 0);
 
-  /* Set metric size */
-  if ( parmesh->info.inputMet == 1 ) {
+  /* Set metric size (a constant metrics is recomputed, not interpolated) */
+  ismet = ( parmesh->info.inputMet == 1 ) && ( meshOld->info.hsiz <= 0.0 );
+  if ( ismet ) {
     if ( !MMG3D_Set_solSize(mesh,met,MMG5_Vertex,meshOld->np,metOld->type) )
       return 0;
   }
 
-  /* Set ls size */
-  if ( lsOld && lsOld->m ) {
-    assert ( lsOld->np );
-    if ( !MMG3D_Set_solSize(mesh,ls,MMG5_Vertex,lsOld->np,lsOld->type) )
-      return 0;
-  }
-
-  /* Set disp size */
-  if ( dispOld && dispOld->m ) {
-    assert ( dispOld->np );
-    if ( !MMG3D_Set_solSize(mesh,disp,MMG5_Vertex,dispOld->np,dispOld->type) )
-      return 0;
-  }
-
   /* Set fields size */
   if ( meshOld->nsols ) {
     assert ( field );
@@ -368,22 +320,10 @@ int PMMG_create_oldGrp( PMMG_pParMesh parmesh,int igrp ) {
       memcpy( pptCur, ppt, sizeof(MMG5_Point) );
 
       /* Copy metrics */
-      if ( parmesh->info.inputMet == 1 ) {
+      if ( ismet ) {
         memcpy( &met->m[ ip*met->size ], &metOld->m[ip*met->size], met->size*sizeof(double) );
       }
 
-      /* Copy ls */
-      if ( ls && ls->m ) {
-        assert ( lsOld && lsOld->m );
-        memcpy( &ls->m[ ip*ls->size ], &lsOld->m[ip*ls->size], ls->size*sizeof(double) );
-      }
-
-      /* Copy disp */
-      if ( disp && disp->m ) {
-        assert ( dispOld && dispOld->m );
-        memcpy( &disp->m[ ip*disp->size ], &dispOld->m[ip*dispOld->size], disp->size*sizeof(double) );
-      }
-
       /* Copy fields */
       for ( is=0; is<mesh->nsols; ++is ) {
         psl    = field + is;
@@ -1213,21 +1153,60 @@ int PMMG_splitGrps_cleanMesh( PMMG_pParMesh parmesh,PMMG_pGrp grp,int np )
   return 1;
 }
 
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * \return 1 if the background groups are needed, 0 otherwise.
+ *
+ * The background groups are only read to interpolate a non-constant user
+ * metrics or solution fields.
+ *
+ */
+int PMMG_oldGrps_needed( PMMG_pParMesh parmesh ) {
+  MMG5_pMesh mesh;
+
+  if ( !parmesh->ngrp ) return 0;
+
+  mesh = parmesh->listgrp[0].mesh;
+
+  if ( mesh->nsols ) return 1;
+
+  return ( (parmesh->info.inputMet == 1) && (mesh->info.hsiz <= 0.0) );
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * Free the background groups (once the interpolation is done). The number of
+ * old groups is kept as it is used by the repartitioning.
+ *
+ */
+void PMMG_free_oldGrps( PMMG_pParMesh parmesh ) {
+
+  if ( !parmesh->old_listgrp ) return;
+
+  PMMG_listgrp_free(parmesh, &parmesh->old_listgrp, parmesh->nold_grp);
+}
+
 /**
  * \param parmesh pointer toward the parmesh structure.
  *
  * \return 0 if fail, 1 if success
  *
- * Copy all groups from the current to the background list.
+ * Copy all groups from the current to the background list. Nothing is copied if
+ * there is nothing to interpolate.
  *
  */
 int PMMG_update_oldGrps( PMMG_pParMesh parmesh ) {
   int grpId;
 
-  PMMG_listgrp_free(parmesh, &parmesh->old_listgrp, parmesh->nold_grp);
+  PMMG_free_oldGrps( parmesh );
 
-  /* Allocate list of subgroups struct and allocate memory */
   parmesh->nold_grp = parmesh->ngrp;
+
+  if ( !PMMG_oldGrps_needed( parmesh ) ) return 1;
+
+  /* Allocate list of subgroups struct and allocate memory */
   PMMG_CALLOC(parmesh,parmesh->old_listgrp,parmesh->nold_grp,PMMG_Grp,
               "old group list ",return 0);
 
@@ -1531,6 +1510,37 @@ int PMMG_check_allComm(PMMG_pParMesh parmesh,int ier) {
   return ier;
 }
 
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param target software for which the groups have been split
+ * \param ier result of the splitting
+ *
+ * Renumber the groups to remesh along a space filling curve (after the initial
+ * splitting and after each redistribution) for a better memory locality. A
+ * failure only keeps the current numbering.
+ *
+ * emark Skipped if the groups are renumbered by Scotch before their
+ * remeshing (see PMMG_remesh_grp): that numbering would override this one.
+ *
+ */
+static
+void PMMG_renumber_splitGrps( PMMG_pParMesh parmesh,int target,int ier ) {
+
+  if ( ier <= 0 || target != PMMG_GRPSPL_MMG_TARGET || !parmesh->info.sfc_renum )
+    return;
+
+#ifdef USE_SCOTCH
+  if ( parmesh->ngrp && parmesh->listgrp[0].mesh &&
+       parmesh->listgrp[0].mesh->info.renum )
+    return;
+#endif
+
+  if ( !PMMG_sfc_renumber_grps( parmesh ) ) {
+    fprintf(stderr,"\n  ## Warning: %s: rank %d: unable to renumber the groups.\n",
+            __func__,parmesh->myrank);
+  }
+}
+
 /**
  * \param parmesh pointer toward the parmesh structure.
  * \param target software for which we split the groups
@@ -1643,6 +1653,7 @@ int PMMG_splitPart_grps( PMMG_pParMesh parmesh,int target,int fitMesh,int redist
                "[%d-%d]: %d group is enough, no need to create sub groups.\n",
                parmesh->myrank+1, parmesh->nprocs, ngrp );
     }
+    PMMG_renumber_splitGrps( parmesh,target,ret_val );
     return PMMG_check_allComm(parmesh,ret_val);
   } else {
     if ( parmesh->ddebug )
@@ -1695,7 +1706,7 @@ int PMMG_splitPart_grps( PMMG_pParMesh parmesh,int target,int fitMesh,int redist
     if ( (redistrMode == PMMG_REDISTRIBUTION_ifc_displacement) &&
          (parmesh->info.imprim > PMMG_VERB_ITWAVES) )
       fprintf(stdout,"\n         calling Metis on proc%d\n\n",parmesh->myrank);
-    if ( !PMMG_part_meshElts2metis(parmesh, part, ngrp) ) {
+    if ( !PMMG_part_meshElts(parmesh, part, ngrp) ) {
       ret_val = 0;
       goto fail_part;
     }
@@ -1713,6 +1724,8 @@ int PMMG_splitPart_grps( PMMG_pParMesh parmesh,int target,int fitMesh,int redist
 fail_part:
   PMMG_DEL_MEM(parmesh,part,idx_t,"free metis buffer ");
 
+  PMMG_renumber_splitGrps( parmesh,target,ret_val );
+
   /* Check the communicators */
   assert ( PMMG_check_intNodeComm(parmesh) && "Wrong internal node comm" );
   assert ( PMMG_check_intFaceComm(parmesh) && "Wrong internal face comm" );
@@ -0,0 +1,2686 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file inoutmpi_pmmg.c
+ * \brief Collective (MPI-IO) reading and writing of centralized binary Medit
+ * files.
+ * \copyright GNU Lesser General Public License.
+ *
+ * Reading: each process reads a contiguous slice of each section of a
+ * centralized .meshb file. The tetrahedra are then redistributed along a space
+ * filling curve (Hilbert ordering of their barycenters) and each process fetches
+ * the vertices, boundary entities and parallel interfaces of its elements from
+ * the processes that have read them.
+ *
+ * Writing: each process writes the entities that it owns at the position given
+ * by the global numbering of the entities. In both cases, no process ever
+ * stores the whole mesh.
+ *
+ */
+
+#include "parmmg.h"
+#include "sfc_pmmg.h"
+#include <inttypes.h>
+
+/** Maximal size of a collective read (bytes) */
+#define PMMG_MPIIO_CHUNK (1<<30)
+
+/** Number of curve keys sampled per process to compute the splitters */
+#define PMMG_MPIIO_NSAMPLE 32
+
+/** Entity flags read from the lists of required/geometric entities */
+#define PMMG_MPIIO_REQ 1
+#define PMMG_MPIIO_GEO 2
+
+/** Number of values stored per vertex before its metric: coordinates, ref
+ * and flags */
+#define PMMG_MPIIO_VSTRIDE 5
+
+/** Number of int64 stored per tetra: vertices, ref and flags */
+#define PMMG_MPIIO_TSTRIDE 6
+
+/**
+ * \enum PMMG_meshbKwd
+ * \brief Keywords of binary Medit files handled by the collective reader.
+ */
+enum PMMG_meshbKwd {
+  PMMG_MESHB_Vertices,
+  PMMG_MESHB_Edges,
+  PMMG_MESHB_Triangles,
+  PMMG_MESHB_Tetrahedra,
+  PMMG_MESHB_Corners,
+  PMMG_MESHB_Ridges,
+  PMMG_MESHB_RequiredVertices,
+  PMMG_MESHB_RequiredEdges,
+  PMMG_MESHB_RequiredTriangles,
+  PMMG_MESHB_RequiredTetrahedra,
+  PMMG_MESHB_SolAtVertices,
+  PMMG_MESHB_NKWD
+};
+
+/** Codes of the handled keywords (RequiredTetrahedra as written by Mmg) */
+static const int PMMG_meshb_code[PMMG_MESHB_NKWD] = {
+  4,5,6,8,13,14,15,16,17,12,62
+};
+
+/**
+ * \struct PMMG_meshbHeader
+ * \brief Position and size of the sections of a binary Medit file.
+ */
+typedef struct {
+  int     ver;    /*!< file version */
+  int     iswp;   /*!< 1 if the bytes have to be swapped */
+  int     isiz;   /*!< size of the integers of the file */
+  int     rsiz;   /*!< size of the reals of the file */
+  int     dim;    /*!< mesh dimension */
+  int     nsol;   /*!< number of solutions at vertices */
+  int     typsol; /*!< type of the first solution at vertices */
+  int64_t nitem[PMMG_MESHB_NKWD]; /*!< number of items of each section */
+  int64_t pos[PMMG_MESHB_NKWD];   /*!< position of the first item */
+} PMMG_meshbHeader;
+
+/**
+ * \struct PMMG_mpiioSharers
+ * \brief Processes requesting each vertex read by the current process
+ * (compressed storage).
+ */
+typedef struct {
+  int *off;  /*!< offset of the requesting processes of each read vertex */
+  int *rank; /*!< requesting processes */
+} PMMG_mpiioSharers;
+
+/**
+ * \param buf pointer toward the value to swap.
+ * \param size size of the value.
+ *
+ * Reverse the bytes of a value.
+ *
+ */
+static inline
+void PMMG_meshb_swap( void *buf,int size ) {
+  unsigned char *c = (unsigned char*)buf;
+  unsigned char tmp;
+  int           i;
+
+  for ( i=0; i<size/2; ++i ) {
+    tmp           = c[i];
+    c[i]          = c[size-1-i];
+    c[size-1-i]   = tmp;
+  }
+}
+
+/**
+ * \param ptr pointer toward a raw integer of the file.
+ * \param size size of the integer.
+ * \param iswp 1 if bytes have to be swapped.
+ *
+ * \return the decoded integer.
+ *
+ */
+static inline
+int64_t PMMG_meshb_getInt( const char *ptr,int size,int iswp ) {
+  int32_t i4;
+  int64_t i8;
+
+  if ( size == 4 ) {
+    memcpy(&i4,ptr,4);
+    if ( iswp ) PMMG_meshb_swap(&i4,4);
+    return i4;
+  }
+  memcpy(&i8,ptr,8);
+  if ( iswp ) PMMG_meshb_swap(&i8,8);
+  return i8;
+}
+
+/**
+ * \param ptr pointer toward a raw real of the file.
+ * \param size size of the real.
+ * \param iswp 1 if bytes have to be swapped.
+ *
+ * \return the decoded real.
+ *
+ */
+static inline
+double PMMG_meshb_getReal( const char *ptr,int size,int iswp ) {
+  float  f;
+  double d;
+
+  if ( size == 4 ) {
+    memcpy(&f,ptr,4);
+    if ( iswp ) PMMG_meshb_swap(&f,4);
+    return f;
+  }
+  memcpy(&d,ptr,8);
+  if ( iswp ) PMMG_meshb_swap(&d,8);
+  return d;
+}
+
+/**
+ * \param inm pointer toward the file.
+ * \param size size of the integer to read.
+ * \param iswp 1 if bytes have to be swapped.
+ * \param val pointer toward the read value.
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ */
+static inline
+int PMMG_meshb_readInt( FILE *inm,int size,int iswp,int64_t *val ) {
+  char buf[8];
+
+  if ( fread(buf,size,1,inm) != 1 ) return 0;
+  *val = PMMG_meshb_getInt(buf,size,iswp);
+
+  return 1;
+}
+
+/**
+ * \param filename name of the binary Medit file.
+ * \param hdr pointer toward the header to fill.
+ *
+ * \return 1 if success, 0 if the file can't be opened, -1 if its content is
+ * invalid or not supported.
+ *
+ * Walk through the keywords of a binary Medit file (versions 1 to 4) and store
+ * the position and size of the sections that can be read collectively.
+ *
+ */
+static
+int PMMG_meshb_scan( const char *filename,PMMG_meshbHeader *hdr ) {
+  FILE    *inm;
+  int64_t nextpos,n;
+  int     code,kwd,psiz,k,ier;
+
+  memset(hdr,0,sizeof(PMMG_meshbHeader));
+
+  inm = fopen(filename,"rb");
+  if ( !inm ) return 0;
+
+  ier = -1;
+
+  if ( fread(&code,sizeof(int),1,inm) != 1 ) goto end;
+  if ( code == 16777216 ) {
+    hdr->iswp = 1;
+  }
+  else if ( code != 1 ) {
+    fprintf(stderr,"  ## Error: %s: %s: bad binary file encoding.\n",
+            __func__,filename);
+    goto end;
+  }
+
+  if ( fread(&hdr->ver,sizeof(int),1,inm) != 1 ) goto end;
+  if ( hdr->iswp ) PMMG_meshb_swap(&hdr->ver,sizeof(int));
+  if ( hdr->ver < 1 || hdr->ver > 4 ) {
+    fprintf(stderr,"  ## Error: %s: %s: unsupported file version %d.\n",
+            __func__,filename,hdr->ver);
+    goto end;
+  }
+
+  /* Version 1: 32 bits reals, version 3: 64 bits positions, version 4: 64 bits
+   * integers */
+  hdr->isiz = ( hdr->ver == 4 ) ? 8 : 4;
+  hdr->rsiz = ( hdr->ver == 1 ) ? 4 : 8;
+  psiz      = ( hdr->ver >= 3 ) ? 8 : 4;
+
+  while ( fread(&kwd,sizeof(int),1,inm) == 1 ) {
+    if ( hdr->iswp ) PMMG_meshb_swap(&kwd,sizeof(int));
+    if ( kwd == 54 ) break; /* End */
+
+    if ( !PMMG_meshb_readInt(inm,psiz,hdr->iswp,&nextpos) ) goto end;
+
+    if ( kwd == 3 ) {
+      /* Dimension */
+      if ( !PMMG_meshb_readInt(inm,4,hdr->iswp,&n) ) goto end;
+      hdr->dim = (int)n;
+    }
+    else if ( kwd == 7 || kwd == 9 || kwd == 10 ) {
+      /* Quadrilaterals, prisms, hexahedra */
+      if ( !PMMG_meshb_readInt(inm,hdr->isiz,hdr->iswp,&n) ) goto end;
+      if ( n ) {
+        fprintf(stderr,"  ## Error: %s: %s: quadrilaterals, prisms and"
+                " hexahedra are not supported by the parallel reading.\n",
+                __func__,filename);
+        goto end;
+      }
+    }
+    else {
+      for ( k=0; k<PMMG_MESHB_NKWD; ++k ) {
+        if ( kwd == PMMG_meshb_code[k] ) break;
+      }
+      if ( k < PMMG_MESHB_NKWD ) {
+        if ( !PMMG_meshb_readInt(inm,hdr->isiz,hdr->iswp,&hdr->nitem[k]) ) goto end;
+
+        if ( k == PMMG_MESHB_SolAtVertices ) {
+          if ( !PMMG_meshb_readInt(inm,4,hdr->iswp,&n) ) goto end;
+          hdr->nsol = (int)n;
+          if ( !PMMG_meshb_readInt(inm,4,hdr->iswp,&n) ) goto end;
+          hdr->typsol = (int)n;
+          if ( hdr->nsol > 1 && fseek(inm,4*(hdr->nsol-1),SEEK_CUR) ) goto end;
+        }
+        hdr->pos[k] = ftell(inm);
+      }
+    }
+
+    if ( !nextpos ) break;
+    if ( fseek(inm,nextpos,SEEK_SET) ) goto end;
+  }
+
+  if ( hdr->dim != 3 ) {
+    fprintf(stderr,"  ## Error: %s: %s: wrong dimension (%d).\n",
+            __func__,filename,hdr->dim);
+    goto end;
+  }
+
+  ier = 1;
+
+end:
+  fclose(inm);
+
+  return ier;
+}
+
+/**
+ * \param n number of items.
+ * \param nprocs number of processes.
+ * \param rank process rank.
+ * \param beg first item of the process (0-based).
+ * \param end item following the last item of the process.
+ *
+ * Block decomposition of \a n items.
+ *
+ */
+static inline
+void PMMG_mpiio_block( int64_t n,int nprocs,int rank,int64_t *beg,int64_t *end ) {
+  *beg = n*rank/nprocs;
+  *end = n*(rank+1)/nprocs;
+}
+
+/**
+ * \param i item index (0-based).
+ * \param n number of items.
+ * \param nprocs number of processes.
+ *
+ * \return the process that reads the item \a i in the block decomposition of
+ * \a n items.
+ *
+ */
+static inline
+int PMMG_mpiio_blockOwner( int64_t i,int64_t n,int nprocs ) {
+  int64_t r;
+
+  r = ((i+1)*nprocs + n - 1)/n - 1;
+
+  return (int)MG_MAX(0,MG_MIN(r,nprocs-1));
+}
+
+/**
+ * \param a pointer toward an int64.
+ * \param b pointer toward an int64.
+ *
+ * \return -1, 0 or 1 depending on the order of \a a and \a b.
+ *
+ */
+static
+int PMMG_mpiio_cmpInt64( const void *a,const void *b ) {
+  int64_t ia = *(const int64_t*)a;
+  int64_t ib = *(const int64_t*)b;
+
+  return ( ia > ib ) - ( ia < ib );
+}
+
+/**
+ * \param a pointer toward a (curve key,global index) pair.
+ * \param b pointer toward a (curve key,global index) pair.
+ *
+ * \return -1, 0 or 1 depending on the order of the curve keys then of the
+ * global indices of \a a and \a b.
+ *
+ */
+static
+int PMMG_mpiio_cmpKey( const void *a,const void *b ) {
+  const uint64_t *pa = (const uint64_t*)a;
+  const uint64_t *pb = (const uint64_t*)b;
+
+  if ( pa[0] != pb[0] ) return ( pa[0] > pb[0] ) - ( pa[0] < pb[0] );
+  return ( pa[1] > pb[1] ) - ( pa[1] < pb[1] );
+}
+
+/**
+ * \param a pointer toward a (vertex,process) pair.
+ * \param b pointer toward a (vertex,process) pair.
+ *
+ * \return -1, 0 or 1 depending on the order of the processes then of the
+ * vertices of \a a and \a b.
+ *
+ */
+static
+int PMMG_mpiio_cmpPair( const void *a,const void *b ) {
+  const int64_t *pa = (const int64_t*)a;
+  const int64_t *pb = (const int64_t*)b;
+
+  if ( pa[1] != pb[1] ) return ( pa[1] > pb[1] ) - ( pa[1] < pb[1] );
+  return ( pa[0] > pb[0] ) - ( pa[0] < pb[0] );
+}
+
+/**
+ * \param list sorted array.
+ * \param n size of the array.
+ * \param val value to search.
+ *
+ * \return the position of \a val in \a list, -1 if not found.
+ *
+ */
+static inline
+int PMMG_mpiio_search( const int64_t *list,int n,int64_t val ) {
+  int lo,hi,mid;
+
+  lo = 0;
+  hi = n-1;
+  while ( lo <= hi ) {
+    mid = lo + (hi-lo)/2;
+    if ( list[mid] == val ) return mid;
+    if ( list[mid] < val ) lo = mid+1;
+    else hi = mid-1;
+  }
+  return -1;
+}
+
+/**
+ * \param list array to sort.
+ * \param n size of the array.
+ *
+ * \return the number of unique values (stored at the beginning of \a list).
+ *
+ */
+static
+int PMMG_mpiio_sortUnique( int64_t *list,int n ) {
+  int i,nu;
+
+  if ( !n ) return 0;
+
+  qsort(list,n,sizeof(int64_t),PMMG_mpiio_cmpInt64);
+
+  nu = 1;
+  for ( i=1; i<n; ++i ) {
+    if ( list[i] != list[nu-1] ) list[nu++] = list[i];
+  }
+  return nu;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param dtype MPI datatype of the values of the exchanged records.
+ * \param dsize size of the values.
+ * \param nval number of values per record.
+ * \param scount number of records to send to each process.
+ * \param sbuf records to send (sorted by destination).
+ * \param rcount number of records received from each process (to fill).
+ * \param rbuf pointer toward the received records (allocated).
+ * \param nrecv number of received records.
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Collective all-to-all exchange of records with allocation of the receive
+ * buffer. The records are exchanged through a contiguous datatype so the
+ * counts and displacements of MPI are numbers of records and not of values.
+ *
+ */
+static
+int PMMG_mpiio_alltoallv( PMMG_pParMesh parmesh,MPI_Datatype dtype,size_t dsize,
+                          int nval,int *scount,void *sbuf,int *rcount,
+                          void **rbuf,int *nrecv ) {
+  MPI_Datatype rtype;
+  int64_t      stot,rtot;
+  int          *sdispl,*rdispl;
+  int          k,ier,ieresult,nprocs;
+
+  nprocs = parmesh->nprocs;
+  *rbuf  = NULL;
+  *nrecv = 0;
+  sdispl = rdispl = NULL;
+
+  MPI_CHECK( MPI_Alltoall(scount,1,MPI_INT,rcount,1,MPI_INT,parmesh->comm),
+             return 0 );
+
+  stot = rtot = 0;
+  for ( k=0; k<nprocs; ++k ) {
+    stot += scount[k];
+    rtot += rcount[k];
+  }
+  ier = ( stot <= INT_MAX && rtot <= INT_MAX );
+
+  PMMG_MALLOC(parmesh,sdispl,nprocs,int,"sdispl",ier = 0);
+  PMMG_MALLOC(parmesh,rdispl,nprocs,int,"rdispl",ier = 0);
+  if ( ier ) {
+    PMMG_MALLOC(parmesh,*rbuf,(size_t)rtot*nval*dsize,char,"mpiio rbuf",ier = 0);
+  }
+
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) {
+    PMMG_DEL_MEM(parmesh,*rbuf,char,"mpiio rbuf");
+    PMMG_DEL_MEM(parmesh,rdispl,int,"rdispl");
+    PMMG_DEL_MEM(parmesh,sdispl,int,"sdispl");
+    return 0;
+  }
+
+  sdispl[0] = rdispl[0] = 0;
+  for ( k=1; k<nprocs; ++k ) {
+    sdispl[k] = sdispl[k-1] + scount[k-1];
+    rdispl[k] = rdispl[k-1] + rcount[k-1];
+  }
+  *nrecv = (int)rtot;
+
+  rtype = dtype;
+  if ( nval > 1 ) {
+    MPI_CHECK( MPI_Type_contiguous(nval,dtype,&rtype), ier = 0 );
+    MPI_CHECK( MPI_Type_commit(&rtype), ier = 0 );
+  }
+
+  if ( ier ) {
+    MPI_CHECK( MPI_Alltoallv(sbuf,scount,sdispl,rtype,*rbuf,rcount,rdispl,rtype,
+                             parmesh->comm), ier = 0 );
+  }
+
+  if ( nval > 1 ) {
+    MPI_Type_free(&rtype);
+  }
+
+  PMMG_DEL_MEM(parmesh,rdispl,int,"rdispl");
+  PMMG_DEL_MEM(parmesh,sdispl,int,"sdispl");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handler.
+ * \param pos position of the first record of the section.
+ * \param recsiz size of a record.
+ * \param nrec number of records of the section.
+ * \param beg first record read by the process (to fill).
+ * \param nloc number of records read by the process (to fill).
+ * \param buf pointer toward the read records (allocated).
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Collective reading of the block of records of a section that is attributed
+ * to the current process.
+ *
+ */
+static
+int PMMG_mpiio_readBlock( PMMG_pParMesh parmesh,MPI_File fh,int64_t pos,
+                          size_t recsiz,int64_t nrec,int64_t *beg,
+                          int64_t *nloc,char **buf ) {
+  MPI_Status status;
+  int64_t    end;
+  size_t     size,done,chunk;
+  int        nchunk,nchunk_max,k,ier,ieresult;
+
+  PMMG_mpiio_block(nrec,parmesh->nprocs,parmesh->myrank,beg,&end);
+  *nloc = end - *beg;
+  size  = (size_t)(*nloc)*recsiz;
+
+  ier = 1;
+  PMMG_MALLOC(parmesh,*buf,size,char,"mpiio block",ier = 0);
+
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) {
+    PMMG_DEL_MEM(parmesh,*buf,char,"mpiio block");
+    return 0;
+  }
+
+  /* Each collective read has to be called the same number of times on all the
+   * processes */
+  nchunk = (int)((size + PMMG_MPIIO_CHUNK - 1)/PMMG_MPIIO_CHUNK);
+  MPI_Allreduce( &nchunk, &nchunk_max, 1, MPI_INT, MPI_MAX, parmesh->comm );
+
+  done = 0;
+  for ( k=0; k<nchunk_max; ++k ) {
+    chunk = MG_MIN(size-done,(size_t)PMMG_MPIIO_CHUNK);
+    MPI_CHECK( MPI_File_read_at_all(fh,(MPI_Offset)pos+(MPI_Offset)(*beg)*
+                                    (MPI_Offset)recsiz+(MPI_Offset)done,
+                                    chunk ? *buf+done : NULL,(int)chunk,
+                                    MPI_BYTE,&status), ier = 0 );
+    done += chunk;
+  }
+
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) {
+    PMMG_DEL_MEM(parmesh,*buf,char,"mpiio block");
+    return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handler.
+ * \param hdr pointer toward the file header.
+ * \param kwd keyword of the list of entities to read.
+ * \param nent number of entities of the listed type.
+ * \param ebeg first entity read by the process.
+ * \param flags flags of the entities read by the process.
+ * \param bit flag to set to the listed entities.
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Collective reading of a list of entity indices (corners, ridges, required
+ * entities): the flag \a bit is set to the listed entities in the \a flags
+ * array of the process that has read them.
+ *
+ */
+static
+int PMMG_mpiio_readFlags( PMMG_pParMesh parmesh,MPI_File fh,PMMG_meshbHeader *hdr,
+                          int kwd,int64_t nent,int64_t ebeg,int *flags,int bit ) {
+  int64_t beg,nloc,idx,*sbuf,*rbuf;
+  int     *scount,*rcount,*shift;
+  int     k,nrecv,dest,ier;
+  char    *buf;
+
+  if ( !hdr->nitem[kwd] ) return 1;
+
+  if ( !PMMG_mpiio_readBlock(parmesh,fh,hdr->pos[kwd],hdr->isiz,hdr->nitem[kwd],
+                             &beg,&nloc,&buf) ) return 0;
+
+  ier  = 1;
+  sbuf = rbuf = NULL;
+  scount = rcount = shift = NULL;
+  PMMG_CALLOC(parmesh,scount,parmesh->nprocs,int,"scount",ier = 0);
+  PMMG_CALLOC(parmesh,rcount,parmesh->nprocs,int,"rcount",ier = 0);
+  PMMG_CALLOC(parmesh,shift,parmesh->nprocs,int,"shift",ier = 0);
+  PMMG_MALLOC(parmesh,sbuf,nloc,int64_t,"sbuf",ier = 0);
+
+  if ( ier ) {
+    /* Send the indices to the processes that have read the entities */
+    for ( k=0; k<nloc; ++k ) {
+      idx = PMMG_meshb_getInt(buf+k*hdr->isiz,hdr->isiz,hdr->iswp);
+      if ( idx < 1 || idx > nent ) continue;
+      ++scount[PMMG_mpiio_blockOwner(idx-1,nent,parmesh->nprocs)];
+    }
+    for ( k=1; k<parmesh->nprocs; ++k ) {
+      shift[k] = shift[k-1] + scount[k-1];
+    }
+    for ( k=0; k<nloc; ++k ) {
+      idx = PMMG_meshb_getInt(buf+k*hdr->isiz,hdr->isiz,hdr->iswp);
+      if ( idx < 1 || idx > nent ) continue;
+      dest = PMMG_mpiio_blockOwner(idx-1,nent,parmesh->nprocs);
+      sbuf[shift[dest]++] = idx;
+    }
+  }
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio block");
+
+  if ( !PMMG_mpiio_alltoallv(parmesh,MPI_INT64_T,sizeof(int64_t),1,scount,sbuf,
+                             rcount,(void**)&rbuf,&nrecv) ) {
+    ier = 0;
+  }
+  else {
+    for ( k=0; k<nrecv; ++k ) {
+      flags[rbuf[k]-1-ebeg] |= bit;
+    }
+  }
+
+  PMMG_DEL_MEM(parmesh,rbuf,char,"mpiio rbuf");
+  PMMG_DEL_MEM(parmesh,sbuf,int64_t,"sbuf");
+  PMMG_DEL_MEM(parmesh,shift,int,"shift");
+  PMMG_DEL_MEM(parmesh,rcount,int,"rcount");
+  PMMG_DEL_MEM(parmesh,scount,int,"scount");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param nv number of vertices of the file.
+ * \param vbeg first vertex read by the process.
+ * \param nvloc number of vertices read by the process.
+ * \param stride number of values stored per read vertex.
+ * \param vdata values of the vertices read by the process.
+ * \param nreq number of requested vertices.
+ * \param req sorted global indices (1-based) of the requested vertices.
+ * \param ncomp number of values to fetch per vertex (the first ones).
+ * \param out fetched values (\a ncomp per requested vertex).
+ * \param sharers if not NULL, processes requesting each read vertex (to
+ * allocate and fill).
+ * \param shared if not NULL, pointer toward the (vertex,process) pairs of the
+ * requested vertices that are requested by other processes too (allocated).
+ * \param nshared number of shared pairs.
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Collective fetching of vertex data from the processes that have read the
+ * vertices. Optionally, the processes that have read the vertices store which
+ * processes need them and tell each requesting process with which processes
+ * its vertices are shared.
+ *
+ */
+static
+int PMMG_mpiio_fetchVertices( PMMG_pParMesh parmesh,int64_t nv,int64_t vbeg,
+                              int64_t nvloc,int stride,double *vdata,int nreq,
+                              int64_t *req,int ncomp,double *out,
+                              PMMG_mpiioSharers *sharers,int64_t **shared,
+                              int *nshared ) {
+  double  *sval,*rval;
+  int64_t *rreq,*spair,*rpair,v,iv;
+  int     *scount,*rcount,*count2,*rcount2,*off,*fill;
+  int     nprocs,nrecv,nrecv2,k,i,j,src,t,ier,ieresult,npair;
+
+  nprocs = parmesh->nprocs;
+  ier    = 1;
+  rreq   = spair = rpair = NULL;
+  sval   = rval  = NULL;
+  scount = rcount = count2 = rcount2 = off = fill = NULL;
+
+  PMMG_CALLOC(parmesh,scount,nprocs,int,"scount",ier = 0);
+  PMMG_CALLOC(parmesh,rcount,nprocs,int,"rcount",ier = 0);
+
+  /** Step 1: send the requests (sorted, so grouped by reading process) */
+  if ( ier ) {
+    for ( k=0; k<nreq; ++k ) {
+      ++scount[PMMG_mpiio_blockOwner(req[k]-1,nv,nprocs)];
+    }
+  }
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  if ( !PMMG_mpiio_alltoallv(parmesh,MPI_INT64_T,sizeof(int64_t),1,scount,req,
+                             rcount,(void**)&rreq,&nrecv) ) {
+    ier = 0;
+    goto end;
+  }
+
+  /** Step 2: answer with the values of the requested vertices */
+  PMMG_MALLOC(parmesh,sval,(size_t)nrecv*ncomp,double,"sval",ier = 0);
+  if ( ier ) {
+    for ( k=0; k<nrecv; ++k ) {
+      iv = rreq[k]-1-vbeg;
+      assert ( iv >= 0 && iv < nvloc );
+      memcpy(&sval[(size_t)ncomp*k],&vdata[(size_t)stride*iv],ncomp*sizeof(double));
+    }
+  }
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  if ( !PMMG_mpiio_alltoallv(parmesh,MPI_DOUBLE,sizeof(double),ncomp,rcount,sval,
+                             scount,(void**)&rval,&i) ) {
+    ier = 0;
+    goto end;
+  }
+  memcpy(out,rval,(size_t)nreq*ncomp*sizeof(double));
+
+  if ( !sharers ) goto end;
+
+  /** Step 3: store the processes requesting each read vertex */
+  PMMG_CALLOC(parmesh,off,nvloc+1,int,"sharers off",ier = 0);
+  PMMG_CALLOC(parmesh,fill,nvloc,int,"fill",ier = 0);
+  PMMG_MALLOC(parmesh,sharers->rank,nrecv,int,"sharers rank",ier = 0);
+  PMMG_CALLOC(parmesh,count2,nprocs,int,"count2",ier = 0);
+  PMMG_CALLOC(parmesh,rcount2,nprocs,int,"rcount2",ier = 0);
+
+  if ( ier ) {
+    for ( k=0; k<nrecv; ++k ) {
+      ++off[rreq[k]-vbeg];
+    }
+    for ( iv=0; iv<nvloc; ++iv ) {
+      off[iv+1] += off[iv];
+    }
+    k = 0;
+    for ( src=0; src<nprocs; ++src ) {
+      for ( j=0; j<rcount[src]; ++j,++k ) {
+        iv = rreq[k]-1-vbeg;
+        sharers->rank[off[iv]+fill[iv]++] = src;
+      }
+    }
+
+    /** Step 4: for each requesting process, list the other processes that
+     * share its vertices */
+    npair = 0;
+    k = 0;
+    for ( src=0; src<nprocs; ++src ) {
+      for ( j=0; j<rcount[src]; ++j,++k ) {
+        iv = rreq[k]-1-vbeg;
+        if ( off[iv+1]-off[iv] > 1 ) {
+          count2[src] += off[iv+1]-off[iv]-1;
+          npair       += off[iv+1]-off[iv]-1;
+        }
+      }
+    }
+    PMMG_MALLOC(parmesh,spair,2*npair,int64_t,"spair",ier = 0);
+  }
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  npair = 0;
+  k = 0;
+  for ( src=0; src<nprocs; ++src ) {
+    for ( j=0; j<rcount[src]; ++j,++k ) {
+      v = rreq[k];
+      iv = v-1-vbeg;
+      if ( off[iv+1]-off[iv] < 2 ) continue;
+      for ( t=off[iv]; t<off[iv+1]; ++t ) {
+        if ( sharers->rank[t] == src ) continue;
+        spair[2*npair]   = v;
+        spair[2*npair+1] = sharers->rank[t];
+        ++npair;
+      }
+    }
+  }
+
+  if ( !PMMG_mpiio_alltoallv(parmesh,MPI_INT64_T,sizeof(int64_t),2,count2,spair,
+                             rcount2,(void**)&rpair,&nrecv2) ) {
+    ier = 0;
+    goto end;
+  }
+
+  sharers->off = off;
+  off          = NULL;
+  *shared      = rpair;
+  rpair        = NULL;
+  *nshared     = nrecv2;
+
+end:
+  PMMG_DEL_MEM(parmesh,rpair,char,"mpiio rbuf");
+  PMMG_DEL_MEM(parmesh,spair,int64_t,"spair");
+  PMMG_DEL_MEM(parmesh,rcount2,int,"rcount2");
+  PMMG_DEL_MEM(parmesh,count2,int,"count2");
+  PMMG_DEL_MEM(parmesh,fill,int,"fill");
+  PMMG_DEL_MEM(parmesh,off,int,"sharers off");
+  PMMG_DEL_MEM(parmesh,rval,char,"mpiio rbuf");
+  PMMG_DEL_MEM(parmesh,sval,double,"sval");
+  PMMG_DEL_MEM(parmesh,rreq,char,"mpiio rbuf");
+  PMMG_DEL_MEM(parmesh,rcount,int,"rcount");
+  PMMG_DEL_MEM(parmesh,scount,int,"scount");
+
+  if ( sharers && !ier ) {
+    PMMG_DEL_MEM(parmesh,sharers->rank,int,"sharers rank");
+  }
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handler.
+ * \param hdr pointer toward the file header.
+ * \param kwd keyword of the entities (edges or triangles).
+ * \param nver number of vertices per entity.
+ * \param kwdFlag1 keyword of the first list of flagged entities.
+ * \param flag1 flag of the entities of the first list.
+ * \param kwdFlag2 keyword of the second list of flagged entities (or -1).
+ * \param flag2 flag of the entities of the second list.
+ * \param vbeg first vertex read by the process.
+ * \param nvloc number of vertices read by the process.
+ * \param sharers processes requesting each vertex read by the process.
+ * \param nploc number of vertices of the process.
+ * \param lglob sorted global indices of the vertices of the process.
+ * \param ent pointer toward the received entities (allocated, \a nver local
+ * vertex indices, ref and flags per entity).
+ * \param nent number of received entities.
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Collective reading of boundary entities: each entity is sent to the process
+ * that has read its smallest vertex, that forwards it to the processes that
+ * use this vertex. The entities whose vertices are not all used by the
+ * receiving process are discarded.
+ *
+ */
+static
+int PMMG_mpiio_readBdyEntities( PMMG_pParMesh parmesh,MPI_File fh,
+                                PMMG_meshbHeader *hdr,int kwd,int nver,
+                                int kwdFlag1,int flag1,int kwdFlag2,int flag2,
+                                int64_t vbeg,int64_t nvloc,
+                                PMMG_mpiioSharers *sharers,int nploc,
+                                int64_t *lglob,int64_t **ent,int *nent ) {
+  int64_t beg,nloc,vmin,iv,*sbuf,*rbuf,*sbuf2,*rbuf2,*ptr;
+  int64_t nv;
+  size_t  recsiz;
+  int     *flags,*scount,*rcount,*shift;
+  int     nprocs,stride,k,j,dest,nrecv,nrecv2,ier,ieresult,idx,keep;
+  char    *buf;
+
+  *ent   = NULL;
+  *nent  = 0;
+
+  if ( !hdr->nitem[kwd] ) return 1;
+
+  nprocs = parmesh->nprocs;
+  nv     = hdr->nitem[PMMG_MESHB_Vertices];
+  stride = nver + 2;
+  recsiz = (size_t)(nver+1)*hdr->isiz;
+
+  if ( !PMMG_mpiio_readBlock(parmesh,fh,hdr->pos[kwd],recsiz,hdr->nitem[kwd],
+                             &beg,&nloc,&buf) ) return 0;
+
+  ier   = 1;
+  flags = scount = rcount = shift = NULL;
+  sbuf  = rbuf = sbuf2 = rbuf2 = NULL;
+
+  PMMG_CALLOC(parmesh,flags,nloc,int,"flags",ier = 0);
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  if ( !PMMG_mpiio_readFlags(parmesh,fh,hdr,kwdFlag1,hdr->nitem[kwd],beg,
+                             flags,flag1) ) {
+    ier = 0;
+    goto end;
+  }
+  if ( kwdFlag2 >= 0 && !PMMG_mpiio_readFlags(parmesh,fh,hdr,kwdFlag2,
+                                               hdr->nitem[kwd],beg,flags,flag2) ) {
+    ier = 0;
+    goto end;
+  }
+
+  /** Step 1: send each entity to the process that has read its smallest vertex */
+  PMMG_CALLOC(parmesh,scount,nprocs,int,"scount",ier = 0);
+  PMMG_CALLOC(parmesh,rcount,nprocs,int,"rcount",ier = 0);
+  PMMG_CALLOC(parmesh,shift,nprocs,int,"shift",ier = 0);
+  PMMG_MALLOC(parmesh,sbuf,(size_t)stride*nloc,int64_t,"sbuf",ier = 0);
+
+  if ( ier ) {
+    for ( k=0; k<nloc; ++k ) {
+      ptr = &sbuf[(size_t)stride*k];
+      for ( j=0; j<=nver; ++j ) {
+        ptr[j] = PMMG_meshb_getInt(buf+k*recsiz+j*hdr->isiz,hdr->isiz,hdr->iswp);
+      }
+      ptr[nver+1] = flags[k];
+    }
+  }
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio block");
+  PMMG_DEL_MEM(parmesh,flags,int,"flags");
+
+  if ( ier ) {
+    /* Sort the entities by destination (in place, through a counting sort on a
+     * copy of the buffer) */
+    for ( k=0; k<nloc; ++k ) {
+      ptr  = &sbuf[(size_t)stride*k];
+      vmin = ptr[0];
+      for ( j=1; j<nver; ++j ) vmin = MG_MIN(vmin,ptr[j]);
+      if ( vmin < 1 || vmin > nv ) continue;
+      ++scount[PMMG_mpiio_blockOwner(vmin-1,nv,nprocs)];
+    }
+    for ( k=1; k<nprocs; ++k ) {
+      shift[k] = shift[k-1] + scount[k-1];
+    }
+    PMMG_MALLOC(parmesh,sbuf2,(size_t)stride*nloc,int64_t,"sbuf2",ier = 0);
+  }
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  for ( k=0; k<nloc; ++k ) {
+    ptr  = &sbuf[(size_t)stride*k];
+    vmin = ptr[0];
+    for ( j=1; j<nver; ++j ) vmin = MG_MIN(vmin,ptr[j]);
+    if ( vmin < 1 || vmin > nv ) continue;
+    dest = PMMG_mpiio_blockOwner(vmin-1,nv,nprocs);
+    memcpy(&sbuf2[(size_t)stride*shift[dest]++],ptr,stride*sizeof(int64_t));
+  }
+  PMMG_DEL_MEM(parmesh,sbuf,int64_t,"sbuf");
+
+  if ( !PMMG_mpiio_alltoallv(parmesh,MPI_INT64_T,sizeof(int64_t),stride,scount,
+                             sbuf2,rcount,(void**)&rbuf,&nrecv) ) {
+    ier = 0;
+    goto end;
+  }
+  PMMG_DEL_MEM(parmesh,sbuf2,int64_t,"sbuf2");
+
+  /** Step 2: forward the entities to the processes using their smallest vertex */
+  memset(scount,0,nprocs*sizeof(int));
+  for ( k=0; k<nrecv; ++k ) {
+    ptr  = &rbuf[(size_t)stride*k];
+    vmin = ptr[0];
+    for ( j=1; j<nver; ++j ) vmin = MG_MIN(vmin,ptr[j]);
+    iv = vmin-1-vbeg;
+    assert ( iv >= 0 && iv < nvloc );
+    for ( j=sharers->off[iv]; j<sharers->off[iv+1]; ++j ) {
+      ++scount[sharers->rank[j]];
+    }
+  }
+  shift[0] = 0;
+  for ( k=1; k<nprocs; ++k ) {
+    shift[k] = shift[k-1] + scount[k-1];
+  }
+  PMMG_MALLOC(parmesh,sbuf2,(size_t)stride*(shift[nprocs-1]+scount[nprocs-1]),
+              int64_t,"sbuf2",ier = 0);
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  for ( k=0; k<nrecv; ++k ) {
+    ptr  = &rbuf[(size_t)stride*k];
+    vmin = ptr[0];
+    for ( j=1; j<nver; ++j ) vmin = MG_MIN(vmin,ptr[j]);
+    iv = vmin-1-vbeg;
+    for ( j=sharers->off[iv]; j<sharers->off[iv+1]; ++j ) {
+      dest = sharers->rank[j];
+      memcpy(&sbuf2[(size_t)stride*shift[dest]++],ptr,stride*sizeof(int64_t));
+    }
+  }
+  PMMG_DEL_MEM(parmesh,rbuf,char,"mpiio rbuf");
+
+  if ( !PMMG_mpiio_alltoallv(parmesh,MPI_INT64_T,sizeof(int64_t),stride,scount,
+                             sbuf2,rcount,(void**)&rbuf2,&nrecv2) ) {
+    ier = 0;
+    goto end;
+  }
+
+  /** Step 3: keep the entities whose vertices are all used by the process and
+   * convert their vertices into local indices */
+  *nent = 0;
+  for ( k=0; k<nrecv2; ++k ) {
+    ptr  = &rbuf2[(size_t)stride*k];
+    keep = 1;
+    for ( j=0; j<nver; ++j ) {
+      idx = PMMG_mpiio_search(lglob,nploc,ptr[j]);
+      if ( idx < 0 ) {
+        keep = 0;
+        break;
+      }
+      ptr[j] = idx+1;
+    }
+    if ( !keep ) continue;
+    memmove(&rbuf2[(size_t)stride*(*nent)],ptr,stride*sizeof(int64_t));
+    ++(*nent);
+  }
+  *ent  = rbuf2;
+  rbuf2 = NULL;
+
+end:
+  PMMG_DEL_MEM(parmesh,rbuf2,char,"mpiio rbuf");
+  PMMG_DEL_MEM(parmesh,rbuf,char,"mpiio rbuf");
+  PMMG_DEL_MEM(parmesh,sbuf2,int64_t,"sbuf2");
+  PMMG_DEL_MEM(parmesh,sbuf,int64_t,"sbuf");
+  PMMG_DEL_MEM(parmesh,shift,int,"shift");
+  PMMG_DEL_MEM(parmesh,rcount,int,"rcount");
+  PMMG_DEL_MEM(parmesh,scount,int,"scount");
+  PMMG_DEL_MEM(parmesh,flags,int,"flags");
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio block");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param tet local tetrahedra (local vertex indices, ref and flags).
+ * \param ne number of local tetrahedra.
+ * \param ent received boundary entities (local vertex indices, ref, flags).
+ * \param nent pointer toward the number of received entities (updated).
+ * \param nver number of vertices per entity (2 for edges, 3 for triangles).
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Remove the entities that are not an edge or a face of a local tetrahedron.
+ *
+ */
+static
+int PMMG_mpiio_filterBdyEntities( PMMG_pParMesh parmesh,int64_t *tet,int ne,
+                                  int64_t *ent,int *nent,int nver ) {
+  MMG5_pMesh mesh;
+  MMG5_Hash  hash;
+  int64_t    *pt;
+  int        *found,stride,k,i,kt,n;
+
+  if ( !*nent ) return 1;
+
+  mesh   = parmesh->listgrp[0].mesh;
+  stride = nver + 2;
+
+  PMMG_CALLOC(parmesh,found,*nent+1,int,"found",return 0);
+
+  if ( !MMG5_hashNew(mesh,&hash,0.51*(*nent),1.51*(*nent)) ) {
+    PMMG_DEL_MEM(parmesh,found,int,"found");
+    return 0;
+  }
+
+  for ( k=0; k<*nent; ++k ) {
+    pt = &ent[(size_t)stride*k];
+    if ( nver == 3 ) {
+      kt = MMG5_hashFace(mesh,&hash,(int)pt[0],(int)pt[1],(int)pt[2],k+1);
+    }
+    else {
+      kt = MMG5_hashEdge(mesh,&hash,(int)pt[0],(int)pt[1],k+1);
+    }
+    if ( !kt ) {
+      MMG5_DEL_MEM(mesh,hash.item);
+      PMMG_DEL_MEM(parmesh,found,int,"found");
+      return 0;
+    }
+  }
+
+  for ( k=0; k<ne; ++k ) {
+    pt = &tet[(size_t)PMMG_MPIIO_TSTRIDE*k];
+    if ( nver == 3 ) {
+      for ( i=0; i<4; ++i ) {
+        kt = MMG5_hashGetFace(&hash,(int)pt[MMG5_idir[i][0]],
+                              (int)pt[MMG5_idir[i][1]],(int)pt[MMG5_idir[i][2]]);
+        found[kt] = 1;
+      }
+    }
+    else {
+      for ( i=0; i<6; ++i ) {
+        kt = MMG5_hashGet(&hash,(int)pt[MMG5_iare[i][0]],(int)pt[MMG5_iare[i][1]]);
+        found[kt] = 1;
+      }
+    }
+  }
+  MMG5_DEL_MEM(mesh,hash.item);
+
+  n = 0;
+  for ( k=0; k<*nent; ++k ) {
+    if ( !found[k+1] ) continue;
+    memmove(&ent[(size_t)stride*n],&ent[(size_t)stride*k],stride*sizeof(int64_t));
+    ++n;
+  }
+  *nent = n;
+
+  PMMG_DEL_MEM(parmesh,found,int,"found");
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param shared (vertex,process) pairs of the shared vertices.
+ * \param nshared number of pairs.
+ * \param nploc number of vertices of the process.
+ * \param lglob sorted global indices of the vertices of the process.
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Set the node communicators of the process from the list of its shared
+ * vertices (the file indices of the vertices are used as global indices).
+ *
+ */
+static
+int PMMG_mpiio_setNodeComms( PMMG_pParMesh parmesh,int64_t *shared,int nshared,
+                             int nploc,int64_t *lglob ) {
+  int *loc,*glo;
+  int ncomm,icomm,k,i,beg,nitem,ier;
+
+  if ( !nshared ) return 1;
+
+  qsort(shared,nshared,2*sizeof(int64_t),PMMG_mpiio_cmpPair);
+
+  ncomm = 1;
+  for ( k=1; k<nshared; ++k ) {
+    if ( shared[2*k+1] != shared[2*k-1] ) ++ncomm;
+  }
+
+  if ( !PMMG_Set_numberOfNodeCommunicators(parmesh,ncomm) ) return 0;
+
+  PMMG_MALLOC(parmesh,loc,nshared,int,"loc",return 0);
+  PMMG_MALLOC(parmesh,glo,nshared,int,"glo",
+              PMMG_DEL_MEM(parmesh,loc,int,"loc");return 0);
+
+  ier   = 1;
+  icomm = 0;
+  beg   = 0;
+  for ( k=1; k<=nshared && ier; ++k ) {
+    if ( k < nshared && shared[2*k+1] == shared[2*beg+1] ) continue;
+
+    /* Pairs of the communicator with process shared[2*beg+1] */
+    nitem = k - beg;
+    ier = PMMG_Set_ithNodeCommunicatorSize(parmesh,icomm,(int)shared[2*beg+1],nitem);
+    if ( ier ) {
+      for ( i=0; i<nitem; ++i ) {
+        /* Global indices fit in an int (checked when the file is scanned) */
+        assert ( shared[2*(beg+i)] <= INT_MAX );
+        glo[i] = (int)shared[2*(beg+i)];
+        loc[i] = PMMG_mpiio_search(lglob,nploc,shared[2*(beg+i)]) + 1;
+        assert ( loc[i] > 0 );
+      }
+      /* Pairs are sorted by global index */
+      ier = PMMG_Set_ithNodeCommunicator_nodes(parmesh,icomm,loc,glo,0);
+    }
+    ++icomm;
+    beg = k;
+  }
+
+  PMMG_DEL_MEM(parmesh,glo,int,"glo");
+  PMMG_DEL_MEM(parmesh,loc,int,"loc");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param nu number of vertices with fetched coordinates.
+ * \param ucoor fetched coordinates.
+ * \param uglob sorted global indices of the vertices with fetched coordinates.
+ * \param tet pointer toward the tetrahedra of the process (updated).
+ * \param ne pointer toward the number of tetrahedra of the process (updated).
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Redistribute the tetrahedra along the Hilbert curve of their barycenters:
+ * the splitters of the curve are computed from a sampling of the keys of each
+ * process. The ties between equal curve keys are broken by the global index of
+ * the tetra, so all the keys are distinct and each process receives at least
+ * the tetra of its splitter.
+ *
+ */
+static
+int PMMG_mpiio_sfcRedistribute( PMMG_pParMesh parmesh,int nu,double *ucoor,
+                                int64_t *uglob,int64_t **tet,int *ne ) {
+  double   min[3],max[3],gmin[3],gmax[3],c[3],scale;
+  uint64_t *key,*sorted,*samples,*all,*split;
+  int64_t  *sbuf,*rbuf,*pt,nloc,gbeg;
+  int      *scount,*rcount,*shift,*dest,*nsample,*displ;
+  int      nprocs,ns,nall,k,i,d,idx,lo,hi,mid,nrecv,ier,ieresult;
+
+  nprocs = parmesh->nprocs;
+  ier    = 1;
+  key    = sorted = samples = all = split = NULL;
+  sbuf   = rbuf = NULL;
+  scount = rcount = shift = dest = nsample = displ = NULL;
+
+  /** Step 1: bounding box */
+  for ( d=0; d<3; ++d ) {
+    min[d] =  DBL_MAX;
+    max[d] = -DBL_MAX;
+  }
+  for ( k=0; k<nu; ++k ) {
+    for ( d=0; d<3; ++d ) {
+      min[d] = MG_MIN(min[d],ucoor[3*k+d]);
+      max[d] = MG_MAX(max[d],ucoor[3*k+d]);
+    }
+  }
+  MPI_CHECK( MPI_Allreduce(min,gmin,3,MPI_DOUBLE,MPI_MIN,parmesh->comm), return 0 );
+  MPI_CHECK( MPI_Allreduce(max,gmax,3,MPI_DOUBLE,MPI_MAX,parmesh->comm), return 0 );
+
+  scale = PMMG_sfc_scale(gmin,gmax);
+
+  /* Global index of the first tetra of the process (read order) */
+  nloc = *ne;
+  gbeg = 0;
+  MPI_CHECK( MPI_Exscan(&nloc,&gbeg,1,MPI_INT64_T,MPI_SUM,parmesh->comm),
+             return 0 );
+  if ( !parmesh->myrank ) gbeg = 0;
+
+  /** Step 2: (key,global index) pairs of the barycenters */
+  PMMG_MALLOC(parmesh,key,2*(size_t)(*ne),uint64_t,"key",ier = 0);
+  PMMG_MALLOC(parmesh,sorted,2*(size_t)(*ne),uint64_t,"sorted keys",ier = 0);
+  PMMG_CALLOC(parmesh,nsample,nprocs,int,"nsample",ier = 0);
+  PMMG_CALLOC(parmesh,displ,nprocs,int,"displ",ier = 0);
+  PMMG_MALLOC(parmesh,samples,2*PMMG_MPIIO_NSAMPLE,uint64_t,"samples",ier = 0);
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  for ( k=0; k<*ne; ++k ) {
+    pt = &(*tet)[(size_t)PMMG_MPIIO_TSTRIDE*k];
+    c[0] = c[1] = c[2] = 0.;
+    for ( i=0; i<4; ++i ) {
+      idx = PMMG_mpiio_search(uglob,nu,pt[i]);
+      assert ( idx >= 0 );
+      for ( d=0; d<3; ++d ) {
+        c[d] += 0.25*ucoor[3*idx+d];
+      }
+    }
+    key[2*(size_t)k]   = PMMG_sfc_hilbertKey(c,gmin,scale);
+    key[2*(size_t)k+1] = (uint64_t)(gbeg+k);
+  }
+  memcpy(sorted,key,2*(size_t)(*ne)*sizeof(uint64_t));
+  qsort(sorted,*ne,2*sizeof(uint64_t),PMMG_mpiio_cmpKey);
+
+  /** Step 3: splitters from the regular samples of the sorted keys */
+  ns = MG_MIN(PMMG_MPIIO_NSAMPLE,*ne);
+  for ( k=0; k<ns; ++k ) {
+    i = (int)(((2*(int64_t)k+1)*(*ne))/(2*ns));
+    samples[2*k]   = sorted[2*(size_t)i];
+    samples[2*k+1] = sorted[2*(size_t)i+1];
+  }
+  PMMG_DEL_MEM(parmesh,sorted,uint64_t,"sorted keys");
+
+  MPI_CHECK( MPI_Allgather(&ns,1,MPI_INT,nsample,1,MPI_INT,parmesh->comm),
+             ier = 0 );
+  nall = 0;
+  for ( k=0; k<nprocs; ++k ) {
+    displ[k]    = 2*nall;
+    nall       += nsample[k];
+    nsample[k] *= 2;
+  }
+  PMMG_MALLOC(parmesh,all,2*(size_t)nall,uint64_t,"all samples",ier = 0);
+  PMMG_MALLOC(parmesh,split,2*(size_t)nprocs,uint64_t,"splitters",ier = 0);
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  MPI_CHECK( MPI_Allgatherv(samples,2*ns,MPI_UINT64_T,all,nsample,displ,
+                            MPI_UINT64_T,parmesh->comm), ier = 0 );
+  qsort(all,nall,2*sizeof(uint64_t),PMMG_mpiio_cmpKey);
+  for ( k=1; k<nprocs; ++k ) {
+    i = (int)(((int64_t)k*nall)/nprocs);
+    split[2*(k-1)]   = all[2*(size_t)i];
+    split[2*(k-1)+1] = all[2*(size_t)i+1];
+  }
+
+  /** Step 4: send each tetra to the process of its key interval */
+  PMMG_CALLOC(parmesh,scount,nprocs,int,"scount",ier = 0);
+  PMMG_CALLOC(parmesh,rcount,nprocs,int,"rcount",ier = 0);
+  PMMG_CALLOC(parmesh,shift,nprocs,int,"shift",ier = 0);
+  PMMG_MALLOC(parmesh,dest,*ne,int,"dest",ier = 0);
+  PMMG_MALLOC(parmesh,sbuf,(size_t)PMMG_MPIIO_TSTRIDE*(*ne),int64_t,"sbuf",ier = 0);
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  for ( k=0; k<*ne; ++k ) {
+    /* Number of splitters lower or equal to the key */
+    lo = 0;
+    hi = nprocs-1;
+    while ( lo < hi ) {
+      mid = (lo+hi)/2;
+      if ( PMMG_mpiio_cmpKey(&split[2*mid],&key[2*(size_t)k]) <= 0 ) lo = mid+1;
+      else hi = mid;
+    }
+    dest[k] = lo;
+    ++scount[lo];
+  }
+  for ( k=1; k<nprocs; ++k ) {
+    shift[k] = shift[k-1] + scount[k-1];
+  }
+  for ( k=0; k<*ne; ++k ) {
+    memcpy(&sbuf[(size_t)PMMG_MPIIO_TSTRIDE*shift[dest[k]]++],
+           &(*tet)[(size_t)PMMG_MPIIO_TSTRIDE*k],PMMG_MPIIO_TSTRIDE*sizeof(int64_t));
+  }
+  PMMG_DEL_MEM(parmesh,*tet,int64_t,"tetra");
+
+  if ( !PMMG_mpiio_alltoallv(parmesh,MPI_INT64_T,sizeof(int64_t),
+                             PMMG_MPIIO_TSTRIDE,scount,sbuf,
+                             rcount,(void**)&rbuf,&nrecv) ) {
+    ier = 0;
+    goto end;
+  }
+  *tet = rbuf;
+  *ne  = nrecv;
+
+end:
+  PMMG_DEL_MEM(parmesh,sbuf,int64_t,"sbuf");
+  PMMG_DEL_MEM(parmesh,dest,int,"dest");
+  PMMG_DEL_MEM(parmesh,shift,int,"shift");
+  PMMG_DEL_MEM(parmesh,rcount,int,"rcount");
+  PMMG_DEL_MEM(parmesh,scount,int,"scount");
+  PMMG_DEL_MEM(parmesh,split,uint64_t,"splitters");
+  PMMG_DEL_MEM(parmesh,all,uint64_t,"all samples");
+  PMMG_DEL_MEM(parmesh,samples,uint64_t,"samples");
+  PMMG_DEL_MEM(parmesh,displ,int,"displ");
+  PMMG_DEL_MEM(parmesh,nsample,int,"nsample");
+  PMMG_DEL_MEM(parmesh,sorted,uint64_t,"sorted keys");
+  PMMG_DEL_MEM(parmesh,key,uint64_t,"key");
+
+  return ier;
+}
+
+/**
+ * \param filename name of the file.
+ *
+ * \return 1 if the file exists, 0 otherwise.
+ *
+ */
+static inline
+int PMMG_mpiio_fileExists( const char *filename ) {
+  FILE *fid;
+
+  fid = fopen(filename,"rb");
+  if ( !fid ) return 0;
+
+  fclose(fid);
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param hdr pointer toward the mesh file header.
+ * \param solhdr pointer toward the metric file header (to fill).
+ * \param msize pointer toward the size of the metric (0 if no metric).
+ *
+ * \return 1 if the metric can be read collectively or if there is no metric
+ * file, PMMG_MPIIO_CENTRALIZED if the metric file must be read by the
+ * centralized reading (ASCII or unsupported binary file).
+ *
+ * Scan the metric file on the root process. As for the centralized reading, a
+ * missing metric file is not an error (the default metric name is always
+ * set). An ASCII ".sol" file or its ".solb" variant is read by Mmg.
+ *
+ */
+static
+int PMMG_mpiio_scanMet( PMMG_pParMesh parmesh,PMMG_meshbHeader *hdr,
+                        PMMG_meshbHeader *solhdr,int *msize ) {
+  const char *ptr;
+  char       *solb;
+  size_t     len;
+  int        ier;
+
+  *msize = 0;
+
+  ptr = MMG5_Get_filenameExt(parmesh->metin);
+
+  if ( !ptr || strcmp(ptr,".solb") ) {
+    if ( PMMG_mpiio_fileExists(parmesh->metin) ) return PMMG_MPIIO_CENTRALIZED;
+
+    /* Mmg looks for the binary file if the ASCII one is missing */
+    ier = 1;
+    len = strlen(parmesh->metin)+2;
+    PMMG_MALLOC(parmesh,solb,len,char,"metric name",return 1);
+    snprintf(solb,len,"%sb",parmesh->metin);
+    if ( ptr && !strcmp(ptr,".sol") && PMMG_mpiio_fileExists(solb) ) {
+      ier = PMMG_MPIIO_CENTRALIZED;
+    }
+    PMMG_DEL_MEM(parmesh,solb,char,"metric name");
+    return ier;
+  }
+
+  ier = PMMG_meshb_scan(parmesh->metin,solhdr);
+  if ( !ier ) {
+    /* No metric */
+    return 1;
+  }
+
+  if ( ier < 0 || solhdr->nsol != 1 ||
+       ( solhdr->typsol != 1 && solhdr->typsol != 3 ) ||
+       solhdr->nitem[PMMG_MESHB_SolAtVertices] != hdr->nitem[PMMG_MESHB_Vertices] ) {
+    if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
+      fprintf(stdout,"  ## Warning: %s: %s can't be read in parallel:"
+              " centralized reading.\n",__func__,parmesh->metin);
+    }
+    return PMMG_MPIIO_CENTRALIZED;
+  }
+
+  *msize = ( solhdr->typsol == 1 ) ? 1 : 6;
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the binary Medit mesh file.
+ * \param hdr pointer toward the mesh file header (to fill).
+ * \param solhdr pointer toward the metric file header (to fill).
+ * \param msize pointer toward the size of the metric (0 if no metric).
+ *
+ * \return 1 if success, 0 if the mesh file can't be opened, -1 if the data are
+ * invalid, PMMG_MPIIO_CENTRALIZED if the metric must be read by the
+ * centralized reading.
+ *
+ * Scan the mesh (and metric) files on the root process and broadcast their
+ * headers.
+ *
+ */
+static
+int PMMG_mpiio_scanFiles( PMMG_pParMesh parmesh,const char *filename,
+                          PMMG_meshbHeader *hdr,PMMG_meshbHeader *solhdr,
+                          int *msize ) {
+  const int root = parmesh->info.root;
+  int       ier;
+
+  ier    = 1;
+  *msize = 0;
+
+  if ( parmesh->myrank == root ) {
+    ier = PMMG_meshb_scan(filename,hdr);
+
+    if ( ier == 1 ) {
+      if ( hdr->nitem[PMMG_MESHB_Vertices] > INT_MAX ||
+           hdr->nitem[PMMG_MESHB_Tetrahedra] > INT_MAX ||
+           hdr->nitem[PMMG_MESHB_Tetrahedra] < parmesh->nprocs ) {
+        fprintf(stderr,"  ## Error: %s: %s: unsupported number of vertices or"
+                " tetrahedra for %d processes.\n",__func__,filename,
+                parmesh->nprocs);
+        ier = -1;
+      }
+    }
+
+    if ( ier == 1 && parmesh->metin ) {
+      ier = PMMG_mpiio_scanMet(parmesh,hdr,solhdr,msize);
+    }
+  }
+
+  MPI_CHECK( MPI_Bcast(&ier,1,MPI_INT,root,parmesh->comm), return 0 );
+  if ( ier < 1 ) return ier;
+
+  MPI_CHECK( MPI_Bcast(hdr,sizeof(PMMG_meshbHeader),MPI_BYTE,root,parmesh->comm),
+             return 0 );
+  MPI_CHECK( MPI_Bcast(solhdr,sizeof(PMMG_meshbHeader),MPI_BYTE,root,parmesh->comm),
+             return 0 );
+  MPI_CHECK( MPI_Bcast(msize,1,MPI_INT,root,parmesh->comm), return 0 );
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI handler of the mesh file.
+ * \param hdr pointer toward the mesh file header.
+ * \param solhdr pointer toward the metric file header.
+ * \param msize size of the metric (0 if no metric).
+ * \param vbeg first vertex read by the process (to fill).
+ * \param nvloc number of vertices read by the process (to fill).
+ * \param vdata pointer toward the values of the read vertices (allocated).
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Collective reading of the block of vertices of the process: coordinates,
+ * reference, corner/required flags and metric.
+ *
+ */
+static
+int PMMG_mpiio_readVertices( PMMG_pParMesh parmesh,MPI_File fh,
+                             PMMG_meshbHeader *hdr,PMMG_meshbHeader *solhdr,
+                             int msize,int64_t *vbeg,int64_t *nvloc,
+                             double **vdata ) {
+  MPI_File fhsol;
+  double   *pv,m[6];
+  int64_t  nv,beg,nloc;
+  size_t   recsiz;
+  int      *flags,stride,k,d,ier,ieresult;
+  char     *buf,*ptr;
+
+  nv     = hdr->nitem[PMMG_MESHB_Vertices];
+  stride = PMMG_MPIIO_VSTRIDE + msize;
+  recsiz = 3*hdr->rsiz + hdr->isiz;
+  flags  = NULL;
+  *vdata = NULL;
+
+  if ( !PMMG_mpiio_readBlock(parmesh,fh,hdr->pos[PMMG_MESHB_Vertices],recsiz,nv,
+                             vbeg,nvloc,&buf) ) return 0;
+
+  ier = 1;
+  PMMG_MALLOC(parmesh,*vdata,(size_t)stride*(*nvloc),double,"vdata",ier = 0);
+  PMMG_CALLOC(parmesh,flags,*nvloc,int,"flags",ier = 0);
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto fail;
+
+  for ( k=0; k<*nvloc; ++k ) {
+    ptr = buf + k*recsiz;
+    pv  = &(*vdata)[(size_t)stride*k];
+    for ( d=0; d<3; ++d ) {
+      pv[d] = PMMG_meshb_getReal(ptr+d*hdr->rsiz,hdr->rsiz,hdr->iswp);
+    }
+    pv[3] = (double)PMMG_meshb_getInt(ptr+3*hdr->rsiz,hdr->isiz,hdr->iswp);
+  }
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio block");
+
+  /* Corners and required vertices */
+  if ( !PMMG_mpiio_readFlags(parmesh,fh,hdr,PMMG_MESHB_Corners,nv,*vbeg,
+                             flags,PMMG_MPIIO_GEO) ) goto fail;
+  if ( !PMMG_mpiio_readFlags(parmesh,fh,hdr,PMMG_MESHB_RequiredVertices,nv,*vbeg,
+                             flags,PMMG_MPIIO_REQ) ) goto fail;
+  for ( k=0; k<*nvloc; ++k ) {
+    (*vdata)[(size_t)stride*k+4] = flags[k];
+  }
+  PMMG_DEL_MEM(parmesh,flags,int,"flags");
+
+  if ( !msize ) return 1;
+
+  /* Metric (same block decomposition as the vertices) */
+  ier = 1;
+  MPI_CHECK( MPI_File_open(parmesh->comm,parmesh->metin,MPI_MODE_RDONLY,
+                           MPI_INFO_NULL,&fhsol), ier = 0 );
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto fail;
+
+  recsiz = msize*solhdr->rsiz;
+  ier = PMMG_mpiio_readBlock(parmesh,fhsol,solhdr->pos[PMMG_MESHB_SolAtVertices],
+                             recsiz,nv,&beg,&nloc,&buf);
+  MPI_File_close(&fhsol);
+  if ( !ier ) goto fail;
+  assert ( beg == *vbeg && nloc == *nvloc );
+
+  for ( k=0; k<*nvloc; ++k ) {
+    ptr = buf + k*recsiz;
+    pv  = &(*vdata)[(size_t)stride*k+PMMG_MPIIO_VSTRIDE];
+    for ( d=0; d<msize; ++d ) {
+      m[d] = PMMG_meshb_getReal(ptr+d*solhdr->rsiz,solhdr->rsiz,solhdr->iswp);
+    }
+    if ( msize == 1 ) {
+      pv[0] = m[0];
+    }
+    else {
+      /* Medit stores m11 m12 m22 m13 m23 m33 */
+      pv[0] = m[0];
+      pv[1] = m[1];
+      pv[2] = m[3];
+      pv[3] = m[2];
+      pv[4] = m[4];
+      pv[5] = m[5];
+    }
+  }
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio block");
+
+  return 1;
+
+fail:
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio block");
+  PMMG_DEL_MEM(parmesh,flags,int,"flags");
+  PMMG_DEL_MEM(parmesh,*vdata,double,"vdata");
+  return 0;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI handler of the mesh file.
+ * \param hdr pointer toward the mesh file header.
+ * \param tet pointer toward the tetrahedra read by the process (allocated).
+ * \param ne number of tetrahedra read by the process.
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Collective reading of the block of tetrahedra of the process (vertices,
+ * reference and required flag).
+ *
+ */
+static
+int PMMG_mpiio_readTetra( PMMG_pParMesh parmesh,MPI_File fh,
+                          PMMG_meshbHeader *hdr,int64_t **tet,int *ne ) {
+  int64_t beg,nloc,*pt;
+  size_t  recsiz;
+  int     *flags,k,j,ier,ieresult;
+  char    *buf;
+
+  recsiz = 5*hdr->isiz;
+  flags  = NULL;
+  *tet   = NULL;
+
+  if ( !PMMG_mpiio_readBlock(parmesh,fh,hdr->pos[PMMG_MESHB_Tetrahedra],recsiz,
+                             hdr->nitem[PMMG_MESHB_Tetrahedra],
+                             &beg,&nloc,&buf) ) return 0;
+  *ne = (int)nloc;
+
+  ier = 1;
+  PMMG_MALLOC(parmesh,*tet,(size_t)PMMG_MPIIO_TSTRIDE*nloc,int64_t,"tetra",ier = 0);
+  PMMG_CALLOC(parmesh,flags,nloc,int,"flags",ier = 0);
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto fail;
+
+  if ( !PMMG_mpiio_readFlags(parmesh,fh,hdr,PMMG_MESHB_RequiredTetrahedra,
+                             hdr->nitem[PMMG_MESHB_Tetrahedra],beg,flags,
+                             PMMG_MPIIO_REQ) ) goto fail;
+
+  for ( k=0; k<nloc; ++k ) {
+    pt = &(*tet)[(size_t)PMMG_MPIIO_TSTRIDE*k];
+    for ( j=0; j<5; ++j ) {
+      pt[j] = PMMG_meshb_getInt(buf+k*recsiz+j*hdr->isiz,hdr->isiz,hdr->iswp);
+    }
+    pt[5] = flags[k];
+  }
+
+  PMMG_DEL_MEM(parmesh,flags,int,"flags");
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio block");
+
+  return 1;
+
+fail:
+  PMMG_DEL_MEM(parmesh,flags,int,"flags");
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio block");
+  PMMG_DEL_MEM(parmesh,*tet,int64_t,"tetra");
+  return 0;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param np number of vertices of the process.
+ * \param vdata values of the vertices of the process.
+ * \param msize size of the metric (0 if no metric).
+ * \param tet tetrahedra of the process (local vertex indices).
+ * \param ne number of tetrahedra.
+ * \param tria triangles of the process (local vertex indices).
+ * \param nt number of triangles.
+ * \param edge edges of the process (local vertex indices).
+ * \param na number of edges.
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Fill the mesh and metric of the process through the API functions.
+ *
+ */
+static
+int PMMG_mpiio_setMesh( PMMG_pParMesh parmesh,int np,double *vdata,int msize,
+                        int64_t *tet,int ne,int64_t *tria,int nt,
+                        int64_t *edge,int na ) {
+  double  *pv;
+  int64_t *pt;
+  int     stride,k,flag;
+
+  stride = PMMG_MPIIO_VSTRIDE + msize;
+
+  if ( !PMMG_Set_meshSize(parmesh,np,ne,0,nt,0,na) ) return 0;
+
+  if ( msize ) {
+    if ( !PMMG_Set_metSize(parmesh,MMG5_Vertex,np,
+                           msize == 1 ? MMG5_Scalar : MMG5_Tensor) ) return 0;
+  }
+
+  for ( k=0; k<np; ++k ) {
+    pv = &vdata[(size_t)stride*k];
+    if ( !PMMG_Set_vertex(parmesh,pv[0],pv[1],pv[2],(int)pv[3],k+1) ) return 0;
+
+    flag = (int)pv[4];
+    if ( (flag & PMMG_MPIIO_GEO) && !PMMG_Set_corner(parmesh,k+1) ) return 0;
+    if ( (flag & PMMG_MPIIO_REQ) && !PMMG_Set_requiredVertex(parmesh,k+1) ) return 0;
+
+    pv += PMMG_MPIIO_VSTRIDE;
+    if ( msize == 1 ) {
+      if ( !PMMG_Set_scalarMet(parmesh,pv[0],k+1) ) return 0;
+    }
+    else if ( msize == 6 ) {
+      if ( !PMMG_Set_tensorMet(parmesh,pv[0],pv[1],pv[2],pv[3],pv[4],pv[5],k+1) )
+        return 0;
+    }
+  }
+
+  for ( k=0; k<ne; ++k ) {
+    pt = &tet[(size_t)PMMG_MPIIO_TSTRIDE*k];
+    if ( !PMMG_Set_tetrahedron(parmesh,(int)pt[0],(int)pt[1],(int)pt[2],(int)pt[3],
+                               (int)pt[4],k+1) ) return 0;
+    if ( (pt[5] & PMMG_MPIIO_REQ) && !PMMG_Set_requiredTetrahedron(parmesh,k+1) )
+      return 0;
+  }
+
+  for ( k=0; k<nt; ++k ) {
+    pt = &tria[5*(size_t)k];
+    if ( !PMMG_Set_triangle(parmesh,(int)pt[0],(int)pt[1],(int)pt[2],(int)pt[3],
+                            k+1) ) return 0;
+    if ( (pt[4] & PMMG_MPIIO_REQ) && !PMMG_Set_requiredTriangle(parmesh,k+1) )
+      return 0;
+  }
+
+  for ( k=0; k<na; ++k ) {
+    pt = &edge[4*(size_t)k];
+    if ( !PMMG_Set_edge(parmesh,(int)pt[0],(int)pt[1],(int)pt[2],k+1) ) return 0;
+    if ( (pt[3] & PMMG_MPIIO_GEO) && !PMMG_Set_ridge(parmesh,k+1) ) return 0;
+    if ( (pt[3] & PMMG_MPIIO_REQ) && !PMMG_Set_requiredEdge(parmesh,k+1) ) return 0;
+  }
+
+  return 1;
+}
+
+int PMMG_loadMesh_parallel( PMMG_pParMesh parmesh,const char *filename ) {
+  PMMG_meshbHeader  hdr,solhdr;
+  PMMG_mpiioSharers sharers;
+  MPI_File          fh;
+  MMG5_pMesh        mesh;
+  const char        *data;
+  double            *vdata,*ucoor,*ldata;
+  int64_t           vbeg,nvloc,*tet,*uglob,*lglob,*shared,*tria,*edge,*pt;
+  int               msize,ne,nu,nploc,nshared,nt,na,k,j,ier,ieresult;
+  mytime            ctim[1];
+  char              stim[32];
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.",
+            __func__);
+    return 0;
+  }
+  mesh = parmesh->listgrp[0].mesh;
+
+  tminit(ctim,1);
+  chrono(ON,&(ctim[0]));
+
+  if ( filename ) {
+    data = filename;
+  }
+  else if ( parmesh->meshin ) {
+    data = parmesh->meshin;
+  }
+  else if ( mesh->namein ) {
+    data = mesh->namein;
+  }
+  else {
+    return 0;
+  }
+
+  /** Step 1: scan the file keywords on root */
+  ier = PMMG_mpiio_scanFiles(parmesh,data,&hdr,&solhdr,&msize);
+  if ( ier < 1 ) return ier;
+
+  if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
+    fprintf(stdout,"  %%%% %s OPENED ON %d PROCESSES\n",data,parmesh->nprocs);
+  }
+
+  ier = 1;
+  MPI_CHECK( MPI_File_open(parmesh->comm,data,MPI_MODE_RDONLY,MPI_INFO_NULL,&fh),
+             ier = 0 );
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) return 0;
+
+  vdata = ucoor = ldata = NULL;
+  tet   = uglob = lglob = shared = tria = edge = NULL;
+  sharers.off = sharers.rank = NULL;
+  nshared = nt = na = 0;
+  ier = 0;
+
+  /** Step 2: read the blocks of vertices and tetrahedra */
+  if ( !PMMG_mpiio_readVertices(parmesh,fh,&hdr,&solhdr,msize,&vbeg,&nvloc,
+                                &vdata) ) goto end;
+  if ( !PMMG_mpiio_readTetra(parmesh,fh,&hdr,&tet,&ne) ) goto end;
+
+  /** Step 3: redistribute the tetrahedra along the Hilbert curve */
+  ieresult = 1;
+  PMMG_MALLOC(parmesh,uglob,4*(size_t)ne,int64_t,"uglob",ieresult = 0);
+  if ( ieresult ) {
+    for ( k=0; k<ne; ++k ) {
+      for ( j=0; j<4; ++j ) {
+        uglob[4*k+j] = tet[(size_t)PMMG_MPIIO_TSTRIDE*k+j];
+      }
+    }
+    nu = PMMG_mpiio_sortUnique(uglob,4*ne);
+    PMMG_MALLOC(parmesh,ucoor,3*(size_t)nu,double,"ucoor",ieresult = 0);
+  }
+  MPI_Allreduce( MPI_IN_PLACE, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  if ( !PMMG_mpiio_fetchVertices(parmesh,hdr.nitem[PMMG_MESHB_Vertices],vbeg,
+                                 nvloc,PMMG_MPIIO_VSTRIDE+msize,vdata,nu,uglob,
+                                 3,ucoor,NULL,NULL,NULL) ) goto end;
+
+  if ( !PMMG_mpiio_sfcRedistribute(parmesh,nu,ucoor,uglob,&tet,&ne) ) goto end;
+  PMMG_DEL_MEM(parmesh,ucoor,double,"ucoor");
+  PMMG_DEL_MEM(parmesh,uglob,int64_t,"uglob");
+
+  ieresult = ( ne > 0 );
+  MPI_Allreduce( MPI_IN_PLACE, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) {
+    if ( parmesh->myrank == parmesh->info.root ) {
+      fprintf(stderr,"  ## Error: %s: empty partition: too few elements for"
+              " %d processes.\n",__func__,parmesh->nprocs);
+    }
+    goto end;
+  }
+
+  /** Step 4: fetch the vertices of the local tetrahedra and the list of
+   * processes sharing them */
+  ieresult = 1;
+  PMMG_MALLOC(parmesh,lglob,4*(size_t)ne,int64_t,"lglob",ieresult = 0);
+  if ( ieresult ) {
+    for ( k=0; k<ne; ++k ) {
+      for ( j=0; j<4; ++j ) {
+        lglob[4*k+j] = tet[(size_t)PMMG_MPIIO_TSTRIDE*k+j];
+      }
+    }
+    nploc = PMMG_mpiio_sortUnique(lglob,4*ne);
+    PMMG_MALLOC(parmesh,ldata,(size_t)(PMMG_MPIIO_VSTRIDE+msize)*nploc,double,
+                "ldata",ieresult = 0);
+  }
+  MPI_Allreduce( MPI_IN_PLACE, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  if ( !PMMG_mpiio_fetchVertices(parmesh,hdr.nitem[PMMG_MESHB_Vertices],vbeg,
+                                 nvloc,PMMG_MPIIO_VSTRIDE+msize,vdata,nploc,lglob,
+                                 PMMG_MPIIO_VSTRIDE+msize,ldata,&sharers,&shared,
+                                 &nshared) ) goto end;
+  PMMG_DEL_MEM(parmesh,vdata,double,"vdata");
+
+  /* Local vertex indices of the tetrahedra */
+  for ( k=0; k<ne; ++k ) {
+    pt = &tet[(size_t)PMMG_MPIIO_TSTRIDE*k];
+    for ( j=0; j<4; ++j ) {
+      pt[j] = PMMG_mpiio_search(lglob,nploc,pt[j]) + 1;
+    }
+  }
+
+  /** Step 5: boundary triangles and edges */
+  if ( !PMMG_mpiio_readBdyEntities(parmesh,fh,&hdr,PMMG_MESHB_Triangles,3,
+                                   PMMG_MESHB_RequiredTriangles,PMMG_MPIIO_REQ,
+                                   -1,0,vbeg,nvloc,&sharers,nploc,lglob,
+                                   &tria,&nt) ) goto end;
+  if ( !PMMG_mpiio_readBdyEntities(parmesh,fh,&hdr,PMMG_MESHB_Edges,2,
+                                   PMMG_MESHB_Ridges,PMMG_MPIIO_GEO,
+                                   PMMG_MESHB_RequiredEdges,PMMG_MPIIO_REQ,
+                                   vbeg,nvloc,&sharers,nploc,lglob,
+                                   &edge,&na) ) goto end;
+
+  ieresult = PMMG_mpiio_filterBdyEntities(parmesh,tet,ne,tria,&nt,3) &&
+    PMMG_mpiio_filterBdyEntities(parmesh,tet,ne,edge,&na,2);
+
+  /** Step 6: fill the mesh and the node communicators */
+  if ( ieresult ) {
+    ieresult = PMMG_mpiio_setMesh(parmesh,nploc,ldata,msize,tet,ne,tria,nt,
+                                  edge,na);
+  }
+  if ( ieresult ) {
+    ieresult = PMMG_Set_iparameter(parmesh,PMMG_IPARAM_APImode,
+                                   PMMG_APIDISTRIB_nodes);
+  }
+  if ( ieresult ) {
+    ieresult = PMMG_mpiio_setNodeComms(parmesh,shared,nshared,nploc,lglob);
+  }
+  MPI_Allreduce( MPI_IN_PLACE, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  ier = ieresult;
+
+  if ( ier && msize ) {
+    parmesh->info.inputMet = 1;
+  }
+
+end:
+  MPI_File_close(&fh);
+
+  PMMG_DEL_MEM(parmesh,edge,char,"mpiio rbuf");
+  PMMG_DEL_MEM(parmesh,tria,char,"mpiio rbuf");
+  PMMG_DEL_MEM(parmesh,shared,char,"mpiio rbuf");
+  PMMG_DEL_MEM(parmesh,sharers.rank,int,"sharers rank");
+  PMMG_DEL_MEM(parmesh,sharers.off,int,"sharers off");
+  PMMG_DEL_MEM(parmesh,ldata,double,"ldata");
+  PMMG_DEL_MEM(parmesh,lglob,int64_t,"lglob");
+  PMMG_DEL_MEM(parmesh,ucoor,double,"ucoor");
+  PMMG_DEL_MEM(parmesh,uglob,int64_t,"uglob");
+  PMMG_DEL_MEM(parmesh,tet,int64_t,"tetra");
+  PMMG_DEL_MEM(parmesh,vdata,double,"vdata");
+
+  if ( !ier ) {
+    if ( parmesh->myrank == parmesh->info.root ) {
+      fprintf(stderr,"  ## Error: %s: unable to read %s in parallel.\n",
+              __func__,data);
+    }
+    return -1;
+  }
+
+  chrono(OFF,&(ctim[0]));
+  if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
+    printim(ctim[0].gdif,stim);
+    fprintf(stdout,"     NUMBER OF VERTICES   %" PRId64 "\n",
+            hdr.nitem[PMMG_MESHB_Vertices]);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA %" PRId64 "\n",
+            hdr.nitem[PMMG_MESHB_Tetrahedra]);
+    fprintf(stdout,"     PARALLEL READING     %s\n",stim);
+  }
+
+  return 1;
+}
+
+/**
+ * \param ptr pointer toward the buffer to fill.
+ * \param val value to encode.
+ * \param size size of the integer in the file.
+ *
+ * Encode an integer of the file.
+ *
+ */
+static inline
+void PMMG_meshb_putInt( char *ptr,int64_t val,int size ) {
+  int32_t i4;
+
+  if ( size == 4 ) {
+    i4 = (int32_t)val;
+    memcpy(ptr,&i4,4);
+  }
+  else {
+    memcpy(ptr,&val,8);
+  }
+}
+
+/**
+ * \param tag tag of a point or an edge of the distributed mesh.
+ *
+ * \return the tag of the entity in the centralized mesh.
+ *
+ * Remove the tags of the parallel interfaces the same way as \ref
+ * PMMG_untag_par_node and \ref PMMG_untag_par_edge.
+ *
+ */
+static inline
+int PMMG_mpiio_centralizedTag( int tag ) {
+
+  if ( tag & MG_PARBDY ) {
+    tag &= ~(MG_PARBDY | MG_BDY | MG_PARBDYBDY);
+    if ( tag & MG_NOSURF ) {
+      tag &= ~(MG_NOSURF | MG_REQ);
+    }
+  }
+  return tag;
+}
+
+/**
+ * \param a pointer toward an edge record.
+ * \param b pointer toward an edge record.
+ *
+ * \return -1, 0 or 1 depending on the order of the extremities of \a a and \a
+ * b.
+ *
+ */
+static
+int PMMG_mpiio_cmpEdge( const void *a,const void *b ) {
+  const int64_t *pa = (const int64_t*)a;
+  const int64_t *pb = (const int64_t*)b;
+
+  if ( pa[0] != pb[0] ) return ( pa[0] > pb[0] ) - ( pa[0] < pb[0] );
+  return ( pa[1] > pb[1] ) - ( pa[1] < pb[1] );
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param n number of counters.
+ * \param nloc counters of the process.
+ * \param offset sums of the counters of the previous processes (to fill).
+ * \param ntot sums of the counters of all the processes (to fill).
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ */
+static
+int PMMG_mpiio_offsets( PMMG_pParMesh parmesh,int n,int64_t *nloc,
+                        int64_t *offset,int64_t *ntot ) {
+  int k;
+
+  MPI_CHECK( MPI_Exscan(nloc,offset,n,MPI_INT64_T,MPI_SUM,parmesh->comm),
+             return 0 );
+  if ( !parmesh->myrank ) {
+    for ( k=0; k<n; ++k ) offset[k] = 0;
+  }
+  MPI_CHECK( MPI_Allreduce(nloc,ntot,n,MPI_INT64_T,MPI_SUM,parmesh->comm),
+             return 0 );
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handler.
+ * \param pos position of the data of the process.
+ * \param buf data to write.
+ * \param size size of the data.
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Collective writing of the data of each process.
+ *
+ */
+static
+int PMMG_mpiio_writeBlock( PMMG_pParMesh parmesh,MPI_File fh,int64_t pos,
+                           const char *buf,size_t size ) {
+  MPI_Status status;
+  size_t     done,chunk;
+  int        nchunk,nchunk_max,k,ier,ieresult;
+
+  nchunk = (int)((size + PMMG_MPIIO_CHUNK - 1)/PMMG_MPIIO_CHUNK);
+  MPI_Allreduce( &nchunk, &nchunk_max, 1, MPI_INT, MPI_MAX, parmesh->comm );
+
+  ier  = 1;
+  done = 0;
+  for ( k=0; k<nchunk_max; ++k ) {
+    chunk = MG_MIN(size-done,(size_t)PMMG_MPIIO_CHUNK);
+    MPI_CHECK( MPI_File_write_at_all(fh,(MPI_Offset)(pos+done),
+                                     chunk ? (void*)(buf+done) : NULL,(int)chunk,
+                                     MPI_BYTE,&status), ier = 0 );
+    done += chunk;
+  }
+
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+  return ieresult;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handler.
+ * \param psiz size of the file positions.
+ * \param kwd keyword code.
+ * \param nitem number of items of the section (or value of the keyword).
+ * \param nextra number of integers to write after \a nitem.
+ * \param extra integers to write after \a nitem.
+ * \param datsiz size of the data of the section.
+ * \param pos pointer toward the position of the keyword (updated to the
+ * position of the next keyword).
+ * \param dpos pointer toward the position of the section data (to fill).
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Write the header of a section (root process only): keyword, position of
+ * the next keyword, number of items and extra integers.
+ *
+ */
+static
+int PMMG_mpiio_writeKwd( PMMG_pParMesh parmesh,MPI_File fh,int psiz,int kwd,
+                         int64_t nitem,int nextra,const int *extra,
+                         int64_t datsiz,int64_t *pos,int64_t *dpos ) {
+  MPI_Status status;
+  char       hbuf[64];
+  int64_t    next;
+  int        hsiz,k,ier;
+
+  hsiz  = 4 + psiz + 4 + 4*nextra;
+  assert ( hsiz <= 64 );
+  *dpos = *pos + hsiz;
+  next  = *dpos + datsiz;
+
+  ier = 1;
+  if ( parmesh->myrank == parmesh->info.root ) {
+    PMMG_meshb_putInt(hbuf,kwd,4);
+    PMMG_meshb_putInt(hbuf+4,next,psiz);
+    PMMG_meshb_putInt(hbuf+4+psiz,nitem,4);
+    for ( k=0; k<nextra; ++k ) {
+      PMMG_meshb_putInt(hbuf+8+psiz+4*k,extra[k],4);
+    }
+    MPI_CHECK( MPI_File_write_at(fh,(MPI_Offset)(*pos),hbuf,hsiz,MPI_BYTE,&status),
+               ier = 0 );
+  }
+  *pos = next;
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handler.
+ * \param psiz size of the file positions.
+ * \param pos pointer toward the position of the section (updated).
+ * \param kwd keyword code of the section.
+ * \param ntot number of items of the section.
+ * \param offset number of items written by the previous processes.
+ * \param recsiz size of an item.
+ * \param buf items of the process.
+ * \param nloc number of items of the process.
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Collective writing of a section (nothing is written for empty sections).
+ *
+ */
+static
+int PMMG_mpiio_writeSection( PMMG_pParMesh parmesh,MPI_File fh,int psiz,
+                             int64_t *pos,int kwd,int64_t ntot,int64_t offset,
+                             size_t recsiz,const char *buf,int64_t nloc ) {
+  int64_t dpos;
+  int     ier;
+
+  if ( !ntot ) return 1;
+
+  ier = PMMG_mpiio_writeKwd(parmesh,fh,psiz,kwd,ntot,0,NULL,ntot*recsiz,pos,&dpos);
+
+  if ( !PMMG_mpiio_writeBlock(parmesh,fh,dpos+offset*recsiz,buf,nloc*recsiz) ) {
+    ier = 0;
+  }
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param edge pointer toward the unique edges owned by the process (allocated,
+ * extremities global indices, ref and centralized tag per edge).
+ * \param na pointer toward the number of owned edges.
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Send each boundary edge to the owner of its extremity of lowest global index
+ * and remove the duplicated edges of the parallel interfaces.
+ *
+ */
+static
+int PMMG_mpiio_ownedEdges( PMMG_pParMesh parmesh,int64_t **edge,int *na ) {
+  MMG5_pMesh mesh;
+  MMG5_pEdge pa;
+  int64_t    *sbuf,*rbuf,*ptr,ga,gb,nowned;
+  int64_t    *vtxdist;
+  int        *scount,*rcount,*shift,*dest;
+  int        nprocs,k,n,lo,hi,mid,tag,nrecv,ier,ieresult;
+
+  mesh   = parmesh->listgrp[0].mesh;
+  nprocs = parmesh->nprocs;
+  *edge  = NULL;
+  *na    = 0;
+
+  ier     = 1;
+  sbuf    = rbuf = vtxdist = NULL;
+  scount  = rcount = shift = dest = NULL;
+
+  PMMG_CALLOC(parmesh,vtxdist,nprocs+1,int64_t,"vtxdist",ier = 0);
+  PMMG_CALLOC(parmesh,scount,nprocs,int,"scount",ier = 0);
+  PMMG_CALLOC(parmesh,rcount,nprocs,int,"rcount",ier = 0);
+  PMMG_CALLOC(parmesh,shift,nprocs,int,"shift",ier = 0);
+  PMMG_MALLOC(parmesh,dest,mesh->na,int,"dest",ier = 0);
+  PMMG_MALLOC(parmesh,sbuf,4*(size_t)mesh->na,int64_t,"sbuf",ier = 0);
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  /* Range of the global indices of the vertices owned by each process */
+  nowned = 0;
+  for ( k=1; k<=mesh->np; ++k ) {
+    if ( mesh->point[k].flag == parmesh->myrank ) ++nowned;
+  }
+  MPI_CHECK( MPI_Allgather(&nowned,1,MPI_INT64_T,&vtxdist[1],1,MPI_INT64_T,
+                           parmesh->comm), ier = 0 );
+  for ( k=0; k<nprocs; ++k ) {
+    vtxdist[k+1] += vtxdist[k];
+  }
+
+  /* Send the edges that exist in the centralized mesh */
+  n = 0;
+  for ( k=1; k<=mesh->na; ++k ) {
+    pa  = &mesh->edge[k];
+    tag = PMMG_mpiio_centralizedTag(pa->tag);
+    if ( !(tag & (MG_GEO | MG_REQ | MG_NOM | MG_REF)) ) continue;
+
+    ga = mesh->point[pa->a].tmp;
+    gb = mesh->point[pa->b].tmp;
+
+    ptr    = &sbuf[4*(size_t)n];
+    ptr[0] = MG_MIN(ga,gb);
+    ptr[1] = MG_MAX(ga,gb);
+    ptr[2] = pa->ref;
+    ptr[3] = tag;
+
+    /* Owner of the first extremity */
+    lo = 0;
+    hi = nprocs-1;
+    while ( lo < hi ) {
+      mid = (lo+hi)/2;
+      if ( vtxdist[mid+1] < ptr[0] ) lo = mid+1;
+      else hi = mid;
+    }
+    dest[n] = lo;
+    ++scount[lo];
+    ++n;
+  }
+
+  /* Sort the records by destination (the records are moved backward only) */
+  for ( k=1; k<nprocs; ++k ) {
+    shift[k] = shift[k-1] + scount[k-1];
+  }
+  PMMG_MALLOC(parmesh,rbuf,4*(size_t)n,int64_t,"sorted edges",ier = 0);
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  for ( k=0; k<n; ++k ) {
+    memcpy(&rbuf[4*(size_t)shift[dest[k]]++],&sbuf[4*(size_t)k],4*sizeof(int64_t));
+  }
+  PMMG_DEL_MEM(parmesh,sbuf,int64_t,"sbuf");
+  sbuf = rbuf;
+  rbuf = NULL;
+
+  if ( !PMMG_mpiio_alltoallv(parmesh,MPI_INT64_T,sizeof(int64_t),4,scount,sbuf,
+                             rcount,(void**)&rbuf,&nrecv) ) {
+    ier = 0;
+    goto end;
+  }
+
+  /* Remove duplicated edges */
+  qsort(rbuf,nrecv,4*sizeof(int64_t),PMMG_mpiio_cmpEdge);
+  n = 0;
+  for ( k=0; k<nrecv; ++k ) {
+    ptr = &rbuf[4*(size_t)k];
+    if ( n && !PMMG_mpiio_cmpEdge(ptr,&rbuf[4*(size_t)(n-1)]) ) {
+      rbuf[4*(size_t)(n-1)+3] |= ptr[3];
+      continue;
+    }
+    memmove(&rbuf[4*(size_t)n],ptr,4*sizeof(int64_t));
+    ++n;
+  }
+
+  *edge = rbuf;
+  *na   = n;
+  rbuf  = NULL;
+
+end:
+  PMMG_DEL_MEM(parmesh,rbuf,char,"mpiio rbuf");
+  PMMG_DEL_MEM(parmesh,sbuf,int64_t,"sbuf");
+  PMMG_DEL_MEM(parmesh,dest,int,"dest");
+  PMMG_DEL_MEM(parmesh,shift,int,"shift");
+  PMMG_DEL_MEM(parmesh,rcount,int,"rcount");
+  PMMG_DEL_MEM(parmesh,scount,int,"scount");
+  PMMG_DEL_MEM(parmesh,vtxdist,int64_t,"vtxdist");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the file.
+ * \param fh pointer toward the MPI file handler (to fill).
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Collective opening and truncation of an output file.
+ *
+ */
+static
+int PMMG_mpiio_create( PMMG_pParMesh parmesh,const char *filename,MPI_File *fh ) {
+  int ier,ieresult;
+
+  ier = 1;
+  MPI_CHECK( MPI_File_open(parmesh->comm,filename,MPI_MODE_WRONLY|MPI_MODE_CREATE,
+                           MPI_INFO_NULL,fh), ier = 0 );
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) {
+    if ( parmesh->myrank == parmesh->info.root ) {
+      fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",filename);
+    }
+    if ( ier ) MPI_File_close(fh);
+    return 0;
+  }
+
+  MPI_CHECK( MPI_File_set_size(*fh,0), ier = 0 );
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) {
+    MPI_File_close(fh);
+    return 0;
+  }
+
+  if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
+    fprintf(stdout,"  %%%% %s OPENED ON %d PROCESSES\n",filename,parmesh->nprocs);
+  }
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handler.
+ * \param ver file version.
+ * \param pos pointer toward the position of the next keyword (to fill).
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Write the file code, the version and the dimension (root process only).
+ *
+ */
+static
+int PMMG_mpiio_writeFileHeader( PMMG_pParMesh parmesh,MPI_File fh,int ver,
+                                int64_t *pos ) {
+  MPI_Status status;
+  int64_t    dpos;
+  int        head[2],ier;
+
+  ier = 1;
+  if ( parmesh->myrank == parmesh->info.root ) {
+    head[0] = 1;
+    head[1] = ver;
+    MPI_CHECK( MPI_File_write_at(fh,0,head,2,MPI_INT,&status), ier = 0 );
+  }
+  *pos = 8;
+
+  if ( !PMMG_mpiio_writeKwd(parmesh,fh,(ver >= 3) ? 8 : 4,3,3,0,NULL,0,pos,&dpos) ) {
+    ier = 0;
+  }
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handler.
+ * \param pos position of the end keyword.
+ *
+ * \return 1 if success, 0 otherwise.
+ *
+ * Write the end keyword (root process only).
+ *
+ */
+static
+int PMMG_mpiio_writeEnd( PMMG_pParMesh parmesh,MPI_File fh,int64_t pos ) {
+  MPI_Status status;
+  int        kwd,ier;
+
+  ier = 1;
+  if ( parmesh->myrank == parmesh->info.root ) {
+    kwd = 54;
+    MPI_CHECK( MPI_File_write_at(fh,(MPI_Offset)pos,&kwd,1,MPI_INT,&status),
+               ier = 0 );
+  }
+  return ier;
+}
+
+/** Counters of the entities written by each process */
+enum PMMG_mpiioCount {
+  PMMG_MPIIO_nv,
+  PMMG_MPIIO_ncrn,
+  PMMG_MPIIO_nreqv,
+  PMMG_MPIIO_nt,
+  PMMG_MPIIO_nreqt,
+  PMMG_MPIIO_na,
+  PMMG_MPIIO_nridg,
+  PMMG_MPIIO_nreqa,
+  PMMG_MPIIO_ne,
+  PMMG_MPIIO_nreqe,
+  PMMG_MPIIO_NCOUNT
+};
+
+int PMMG_saveMesh_parallel( PMMG_pParMesh parmesh,const char *filename ) {
+  MMG5_pMesh   mesh;
+  MMG5_pPoint  ppt;
+  MMG5_pTria   ptt;
+  MMG5_pTetra  pt;
+  MPI_File     fh;
+  const char   *data;
+  int64_t      nloc[PMMG_MPIIO_NCOUNT],off[PMMG_MPIIO_NCOUNT];
+  int64_t      ntot[PMMG_MPIIO_NCOUNT],*edge,pos,fsize;
+  size_t       size;
+  int          *list,na,ver,psiz,k,i,n,ier,ieresult;
+  char         *buf,*ptr;
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.",
+            __func__);
+    return 0;
+  }
+  mesh = parmesh->listgrp[0].mesh;
+
+  if ( filename && *filename ) {
+    data = filename;
+  }
+  else if ( parmesh->meshout ) {
+    data = parmesh->meshout;
+  }
+  else {
+    data = mesh->nameout;
+  }
+  if ( !data ) return 0;
+
+  edge = NULL;
+  buf  = NULL;
+  list = NULL;
+
+  /** Step 1: count the entities owned by the process (the global numbering of
+   * vertices and triangles is stored in the tmp and flag fields, the owner in
+   * the flag and base fields) */
+  memset(nloc,0,PMMG_MPIIO_NCOUNT*sizeof(int64_t));
+
+  for ( k=1; k<=mesh->np; ++k ) {
+    ppt = &mesh->point[k];
+    if ( ppt->flag != parmesh->myrank ) continue;
+    ++nloc[PMMG_MPIIO_nv];
+    if ( PMMG_mpiio_centralizedTag(ppt->tag) & MG_CRN ) ++nloc[PMMG_MPIIO_ncrn];
+    if ( PMMG_mpiio_centralizedTag(ppt->tag) & MG_REQ ) ++nloc[PMMG_MPIIO_nreqv];
+  }
+  for ( k=1; k<=mesh->nt; ++k ) {
+    ptt = &mesh->tria[k];
+    if ( ptt->base != parmesh->myrank ) continue;
+    ++nloc[PMMG_MPIIO_nt];
+    if ( (PMMG_mpiio_centralizedTag(ptt->tag[0]) & MG_REQ) &&
+         (PMMG_mpiio_centralizedTag(ptt->tag[1]) & MG_REQ) &&
+         (PMMG_mpiio_centralizedTag(ptt->tag[2]) & MG_REQ) ) ++nloc[PMMG_MPIIO_nreqt];
+  }
+  nloc[PMMG_MPIIO_ne] = mesh->ne;
+  for ( k=1; k<=mesh->ne; ++k ) {
+    if ( mesh->tetra[k].tag & MG_REQ ) ++nloc[PMMG_MPIIO_nreqe];
+  }
+
+  if ( !PMMG_mpiio_ownedEdges(parmesh,&edge,&na) ) return 0;
+  nloc[PMMG_MPIIO_na] = na;
+  for ( k=0; k<na; ++k ) {
+    if ( edge[4*k+3] & MG_GEO ) ++nloc[PMMG_MPIIO_nridg];
+    if ( edge[4*k+3] & MG_REQ ) ++nloc[PMMG_MPIIO_nreqa];
+  }
+
+  if ( !PMMG_mpiio_offsets(parmesh,PMMG_MPIIO_NCOUNT,nloc,off,ntot) ) {
+    PMMG_DEL_MEM(parmesh,edge,char,"mpiio rbuf");
+    return 0;
+  }
+
+  /** Step 2: use 64 bits positions if the file is larger than 2GB */
+  fsize = 28*ntot[PMMG_MPIIO_nv] + 16*ntot[PMMG_MPIIO_nt] + 12*ntot[PMMG_MPIIO_na]
+    + 20*ntot[PMMG_MPIIO_ne] + 4*(ntot[PMMG_MPIIO_ncrn] + ntot[PMMG_MPIIO_nreqv]
+                                  + ntot[PMMG_MPIIO_nreqt] + ntot[PMMG_MPIIO_nridg]
+                                  + ntot[PMMG_MPIIO_nreqa] + ntot[PMMG_MPIIO_nreqe])
+    + 1024;
+  ver  = ( fsize > INT_MAX ) ? 3 : 2;
+  psiz = ( ver >= 3 ) ? 8 : 4;
+
+  if ( !PMMG_mpiio_create(parmesh,data,&fh) ) {
+    PMMG_DEL_MEM(parmesh,edge,char,"mpiio rbuf");
+    return 0;
+  }
+
+  ier = PMMG_mpiio_writeFileHeader(parmesh,fh,ver,&pos);
+
+  /** Step 3: vertices, corners and required vertices */
+  size = MG_MAX(28*(size_t)nloc[PMMG_MPIIO_nv],
+                MG_MAX(20*(size_t)mesh->ne,16*(size_t)nloc[PMMG_MPIIO_nt]));
+  size = MG_MAX(size,12*(size_t)na);
+  ieresult = 1;
+  PMMG_MALLOC(parmesh,buf,size,char,"mpiio wbuf",ieresult = 0);
+  n = MG_MAX(MG_MAX(nloc[PMMG_MPIIO_ncrn],nloc[PMMG_MPIIO_nreqv]),
+             MG_MAX(nloc[PMMG_MPIIO_nreqt],nloc[PMMG_MPIIO_nreqe]));
+  n = MG_MAX(n,MG_MAX(nloc[PMMG_MPIIO_nridg],nloc[PMMG_MPIIO_nreqa]));
+  PMMG_MALLOC(parmesh,list,n,int,"mpiio list",ieresult = 0);
+  MPI_Allreduce( MPI_IN_PLACE, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) {
+    ier = 0;
+    goto end;
+  }
+
+  ptr = buf;
+  for ( k=1; k<=mesh->np; ++k ) {
+    ppt = &mesh->point[k];
+    if ( ppt->flag != parmesh->myrank ) continue;
+    memcpy(ptr,ppt->c,3*sizeof(double));
+    PMMG_meshb_putInt(ptr+24,ppt->ref,4);
+    ptr += 28;
+  }
+  ier &= PMMG_mpiio_writeSection(parmesh,fh,psiz,&pos,4,ntot[PMMG_MPIIO_nv],
+                                 off[PMMG_MPIIO_nv],28,buf,nloc[PMMG_MPIIO_nv]);
+
+  for ( i=0; i<2; ++i ) {
+    n = 0;
+    for ( k=1; k<=mesh->np; ++k ) {
+      ppt = &mesh->point[k];
+      if ( ppt->flag != parmesh->myrank ) continue;
+      if ( PMMG_mpiio_centralizedTag(ppt->tag) & (i ? MG_REQ : MG_CRN) ) {
+        list[n++] = ppt->tmp;
+      }
+    }
+    ier &= PMMG_mpiio_writeSection(parmesh,fh,psiz,&pos,i ? 15 : 13,
+                                   ntot[i ? PMMG_MPIIO_nreqv : PMMG_MPIIO_ncrn],
+                                   off[i ? PMMG_MPIIO_nreqv : PMMG_MPIIO_ncrn],
+                                   4,(char*)list,n);
+  }
+
+  /** Step 4: triangles (owned triangles are numbered first, with contiguous
+   * indices on each process) */
+  ptr = buf;
+  n   = 0;
+  for ( k=1; k<=mesh->nt; ++k ) {
+    ptt = &mesh->tria[k];
+    if ( ptt->base != parmesh->myrank ) continue;
+    for ( i=0; i<3; ++i ) {
+      PMMG_meshb_putInt(ptr+4*i,mesh->point[ptt->v[i]].tmp,4);
+    }
+    PMMG_meshb_putInt(ptr+12,ptt->ref,4);
+    ptr += 16;
+    if ( (PMMG_mpiio_centralizedTag(ptt->tag[0]) & MG_REQ) &&
+         (PMMG_mpiio_centralizedTag(ptt->tag[1]) & MG_REQ) &&
+         (PMMG_mpiio_centralizedTag(ptt->tag[2]) & MG_REQ) ) {
+      list[n++] = ptt->flag;
+    }
+  }
+  ier &= PMMG_mpiio_writeSection(parmesh,fh,psiz,&pos,6,ntot[PMMG_MPIIO_nt],
+                                 off[PMMG_MPIIO_nt],16,buf,nloc[PMMG_MPIIO_nt]);
+  ier &= PMMG_mpiio_writeSection(parmesh,fh,psiz,&pos,17,ntot[PMMG_MPIIO_nreqt],
+                                 off[PMMG_MPIIO_nreqt],4,(char*)list,n);
+
+  /** Step 5: edges, ridges and required edges */
+  ptr = buf;
+  for ( k=0; k<na; ++k ) {
+    PMMG_meshb_putInt(ptr,edge[4*k],4);
+    PMMG_meshb_putInt(ptr+4,edge[4*k+1],4);
+    PMMG_meshb_putInt(ptr+8,edge[4*k+2],4);
+    ptr += 12;
+  }
+  ier &= PMMG_mpiio_writeSection(parmesh,fh,psiz,&pos,5,ntot[PMMG_MPIIO_na],
+                                 off[PMMG_MPIIO_na],12,buf,na);
+
+  for ( i=0; i<2; ++i ) {
+    n = 0;
+    for ( k=0; k<na; ++k ) {
+      if ( edge[4*k+3] & (i ? MG_REQ : MG_GEO) ) {
+        list[n++] = off[PMMG_MPIIO_na] + k + 1;
+      }
+    }
+    ier &= PMMG_mpiio_writeSection(parmesh,fh,psiz,&pos,i ? 16 : 14,
+                                   ntot[i ? PMMG_MPIIO_nreqa : PMMG_MPIIO_nridg],
+                                   off[i ? PMMG_MPIIO_nreqa : PMMG_MPIIO_nridg],
+                                   4,(char*)list,n);
+  }
+
+  /** Step 6: tetrahedra and required tetrahedra */
+  ptr = buf;
+  n   = 0;
+  for ( k=1; k<=mesh->ne; ++k ) {
+    pt = &mesh->tetra[k];
+    for ( i=0; i<4; ++i ) {
+      PMMG_meshb_putInt(ptr+4*i,mesh->point[pt->v[i]].tmp,4);
+    }
+    PMMG_meshb_putInt(ptr+16,pt->ref,4);
+    ptr += 20;
+    if ( pt->tag & MG_REQ ) {
+      list[n++] = off[PMMG_MPIIO_ne] + k;
+    }
+  }
+  ier &= PMMG_mpiio_writeSection(parmesh,fh,psiz,&pos,8,ntot[PMMG_MPIIO_ne],
+                                 off[PMMG_MPIIO_ne],20,buf,mesh->ne);
+  ier &= PMMG_mpiio_writeSection(parmesh,fh,psiz,&pos,12,ntot[PMMG_MPIIO_nreqe],
+                                 off[PMMG_MPIIO_nreqe],4,(char*)list,n);
+
+  ier &= PMMG_mpiio_writeEnd(parmesh,fh,pos);
+
+end:
+  MPI_File_close(&fh);
+
+  PMMG_DEL_MEM(parmesh,list,int,"mpiio list");
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio wbuf");
+  PMMG_DEL_MEM(parmesh,edge,char,"mpiio rbuf");
+
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+  if ( ieresult && parmesh->info.imprim > PMMG_VERB_VERSION ) {
+    fprintf(stdout,"     NUMBER OF VERTICES   %" PRId64 "\n",ntot[PMMG_MPIIO_nv]);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA %" PRId64 "\n",ntot[PMMG_MPIIO_ne]);
+    fprintf(stdout,"     NUMBER OF TRIANGLES  %" PRId64 "\n",ntot[PMMG_MPIIO_nt]);
+  }
+
+  return ieresult;
+}
+
+int PMMG_saveMet_parallel( PMMG_pParMesh parmesh,const char *filename ) {
+  MMG5_pMesh   mesh;
+  MMG5_pSol    met;
+  MPI_File     fh;
+  const char   *data;
+  double       *m,*pm;
+  int64_t      nloc,off,ntot,pos,dpos;
+  int          extra[2],typ,k,ver,ier,ieresult;
+  char         *name,*ptr;
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.",
+            __func__);
+    return 0;
+  }
+  mesh = parmesh->listgrp[0].mesh;
+  met  = parmesh->listgrp[0].met;
+
+  if ( !met || !met->m ) return 1;
+
+  if ( met->size == 1 ) {
+    typ = 1;
+  }
+  else if ( met->size == 6 ) {
+    typ = 3;
+  }
+  else {
+    fprintf(stderr,"  ## Error: %s: unexpected metric size (%d).\n",
+            __func__,met->size);
+    return 0;
+  }
+
+  if ( filename && *filename ) {
+    data = filename;
+  }
+  else if ( parmesh->metout ) {
+    data = parmesh->metout;
+  }
+  else {
+    data = met->nameout;
+  }
+  if ( !data ) return 0;
+
+  /* The metric is always written at binary format: replace the .sol extension
+   * of the default metric name by .solb */
+  name = NULL;
+  ptr  = MMG5_Get_filenameExt((char*)data);
+  if ( ptr && !strcmp(ptr,".sol") ) {
+    PMMG_CALLOC(parmesh,name,strlen(data)+2,char,"solb name",return 0);
+    strcpy(name,data);
+    strcat(name,"b");
+    data = name;
+  }
+
+  nloc = 0;
+  for ( k=1; k<=mesh->np; ++k ) {
+    if ( mesh->point[k].flag == parmesh->myrank ) ++nloc;
+  }
+  ieresult = PMMG_mpiio_offsets(parmesh,1,&nloc,&off,&ntot);
+
+  m = NULL;
+  if ( ieresult ) {
+    PMMG_MALLOC(parmesh,m,met->size*(size_t)nloc,double,"mpiio met",ieresult = 0);
+  }
+  MPI_Allreduce( MPI_IN_PLACE, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) {
+    PMMG_DEL_MEM(parmesh,m,double,"mpiio met");
+    PMMG_DEL_MEM(parmesh,name,char,"solb name");
+    return 0;
+  }
+
+  pm = m;
+  for ( k=1; k<=mesh->np; ++k ) {
+    if ( mesh->point[k].flag != parmesh->myrank ) continue;
+    if ( met->size == 1 ) {
+      pm[0] = met->m[k];
+    }
+    else {
+      /* Medit stores m11 m12 m22 m13 m23 m33 */
+      pm[0] = met->m[6*k];
+      pm[1] = met->m[6*k+1];
+      pm[2] = met->m[6*k+3];
+      pm[3] = met->m[6*k+2];
+      pm[4] = met->m[6*k+4];
+      pm[5] = met->m[6*k+5];
+    }
+    pm += met->size;
+  }
+
+  ver = ( 8*met->size*ntot + 1024 > INT_MAX ) ? 3 : 2;
+
+  if ( !PMMG_mpiio_create(parmesh,data,&fh) ) {
+    PMMG_DEL_MEM(parmesh,m,double,"mpiio met");
+    PMMG_DEL_MEM(parmesh,name,char,"solb name");
+    return 0;
+  }
+
+  ier  = PMMG_mpiio_writeFileHeader(parmesh,fh,ver,&pos);
+
+  /* One solution of type typ */
+  extra[0] = 1;
+  extra[1] = typ;
+  ier &= PMMG_mpiio_writeKwd(parmesh,fh,(ver >= 3) ? 8 : 4,62,ntot,2,extra,
+                             8*met->size*ntot,&pos,&dpos);
+  ier &= PMMG_mpiio_writeBlock(parmesh,fh,dpos+8*met->size*off,(char*)m,
+                               8*met->size*(size_t)nloc);
+  ier &= PMMG_mpiio_writeEnd(parmesh,fh,pos);
+
+  MPI_File_close(&fh);
+  PMMG_DEL_MEM(parmesh,m,double,"mpiio met");
+  PMMG_DEL_MEM(parmesh,name,char,"solb name");
+
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+  return ieresult;
+}
@@ -33,6 +33,9 @@
  */
 #include "parmmg.h"
 #include "interpmesh_pmmg.h"
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
 
 /**
  * \param mesh pointer to the current mesh
@@ -450,13 +453,169 @@ int PMMG_copyMetricsAndFields_point( MMG5_pMesh mesh ,MMG5_pMesh oldMesh,
  * \param oldMesh pointer to the background mesh structure.
  * \param met pointer to the current metrics structure.
  * \param oldMet pointer to the background metrics structure.
- * \param faceAreas pointer to the array of oriented face areas.
+ * \param field pointer to the current solution fields.
+ * \param oldField pointer to the background solution fields.
+ * \param faceAreas pointer to the array of barycentric coefficients.
+ * \param triaNormals pointer to the array of non-normalized triangle normals.
+ * \param nodeTrias pointer to the node triangles graph.
+ * \param grid pointer to the localization grid of the background mesh.
+ * \param marks pointer to the marks of the visited background entities.
+ * \param ismet 1 if the metrics has to be interpolated.
+ * \param ip index of the point to interpolate.
+ * \param ifoundTetra pointer to the starting (then found) background tetra.
+ * \param ifoundTria pointer to the starting (then found) background triangle.
+ * \param myrank process rank.
+ * \param igrp current mesh group.
+ *
+ * \return 1 if the point has not been found by the walk (exhaustive search
+ * needed), 0 otherwise.
+ *
+ * Locate a point of the current mesh in the background mesh and interpolate
+ * its metrics and solution fields. The background mesh is only read, so
+ * different points can be treated concurrently provided that each thread owns
+ * its \a marks and its starting elements.
+ *
+ */
+static inline
+int PMMG_interpMetricsAndFields_point( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
+                                        MMG5_pSol met,MMG5_pSol oldMet,
+                                        MMG5_pSol field,MMG5_pSol oldField,
+                                        double *faceAreas,double *triaNormals,
+                                        int *nodeTrias,PMMG_pLocateGrid grid,
+                                        PMMG_pLocateMarks marks,int ismet,int ip,
+                                        int *ifoundTetra,int *ifoundTria,
+                                        int myrank,int igrp ) {
+  MMG5_pPoint    ppt;
+  MMG5_pSol      psl,oldPsl;
+  PMMG_barycoord barycoord[4];
+  int            ifoundEdge,ifoundVertex;
+  int            ier,j,exhaust;
+
+  ppt = &mesh->point[ip];
+
+  if( ppt->tag & MG_REQ ) {
+    /* Flag point as interpolated */
+    ppt->flag = mesh->base;
+    return 0; // treated by copyMetric_points
+  } else if ( ppt->tag & MG_BDY ) {
+
+#ifdef USE_POINTMAP
+    *ifoundTria = ppt->s;
+#endif
+    /** Locate point in the old mesh */
+    ier = PMMG_locatePointBdy( oldMesh, marks, ppt,
+                               triaNormals, nodeTrias, grid, barycoord,
+                               ifoundTria,&ifoundEdge, &ifoundVertex );
+    exhaust = ( ier != 1 );
+
+    if( mesh->info.imprim > PMMG_VERB_ITWAVES )
+      PMMG_locatePoint_errorCheck( mesh,ip,ier,myrank,igrp );
+
+    /** Interpolate point metrics */
+    if( ismet ) {
+      if( ifoundVertex != PMMG_UNSET ) {
+        ier = PMMG_copyMetrics( mesh,met,oldMesh,oldMet,ip,
+                                oldMesh->tria[*ifoundTria].v[ifoundVertex] );
+      } else if( ifoundEdge != PMMG_UNSET ) {
+        ier = PMMG_interp2bar( mesh,met,oldMet,&oldMesh->tria[*ifoundTria],
+                               ip,ifoundEdge,barycoord );
+      } else {
+        ier = PMMG_interp3bar(mesh,met,oldMet,&oldMesh->tria[*ifoundTria],ip,
+                              barycoord);
+      }
+    }
+
+    /** Field interpolation */
+    if ( mesh->nsols ) {
+      for ( j=0; j<mesh->nsols; ++j ) {
+        psl    = field + j;
+        oldPsl = oldField + j;
+        if ( oldPsl->size == 6 ) {
+          /* Tensor field */
+          ier = PMMG_interp3bar_ani(mesh,psl,oldPsl,
+                                    &oldMesh->tria[*ifoundTria],
+                                    ip,barycoord);
+        }
+        else {
+          /* Scalar or vector field */
+          ier = PMMG_interp3bar_iso(mesh,psl,oldPsl,
+                                    &oldMesh->tria[*ifoundTria],
+                                    ip,barycoord);
+        }
+      }
+    }
+
+    /* Flag point as interpolated */
+    ppt->flag = mesh->base;
+
+  } else {
+
+#ifdef USE_POINTMAP
+    *ifoundTetra = ppt->s;
+#endif
+    /** Locate point in the old volume mesh */
+    ier = PMMG_locatePointVol( oldMesh, marks, ppt,
+                               faceAreas, grid, barycoord, ifoundTetra );
+    exhaust = ( ier != 1 );
+
+    if( mesh->info.imprim > PMMG_VERB_ITWAVES )
+      PMMG_locatePoint_errorCheck( mesh,ip,ier,myrank,igrp );
+
+    /** Interpolate volume point metrics */
+    if( ismet ) {
+      ier = PMMG_interp4bar(mesh,met,oldMet,&oldMesh->tetra[*ifoundTetra],ip,
+                            barycoord);
+    }
+
+    /** Field interpolation */
+    if ( mesh->nsols ) {
+      for ( j=0; j<mesh->nsols; ++j ) {
+        psl    = field + j;
+        oldPsl = oldField + j;
+        if ( oldPsl->size == 6 ) {
+          /* Tensor field */
+          ier = PMMG_interp4bar_ani(mesh,psl,oldPsl,
+                                    &oldMesh->tetra[*ifoundTetra],
+                                    ip,barycoord);
+        }
+        else {
+          /* Scalar or vector field */
+          ier = PMMG_interp4bar_iso(mesh,psl,oldPsl,
+                                    &oldMesh->tetra[*ifoundTetra],
+                                    ip,barycoord);
+        }
+      }
+    }
+
+    /* Flag point as interpolated */
+    ppt->flag = mesh->base;
+
+  }
+
+  return exhaust;
+}
+
+/**
+ * \param mesh pointer to the current mesh structure.
+ * \param oldMesh pointer to the background mesh structure.
+ * \param met pointer to the current metrics structure.
+ * \param oldMet pointer to the background metrics structure.
+ * \param field pointer to the current solution fields.
+ * \param oldField pointer to the background solution fields.
+ * \param faceAreas pointer to the array of barycentric coefficients.
  * \param triaNormals pointer to the array of non-normalized triangle normals.
+ * \param nodeTrias pointer to the node triangles graph.
+ * \param grid pointer to the localization grid of the background mesh.
+ * \param marks array of the marks of the visited background entities (one per
+ * thread).
+ * \param nthreads number of threads used for the interpolation.
  * \param permNodGlob permutation array of nodes.
  * \param inputMet 1 if user provided metric.
  * \param myrank process rank.
  * \param igrp current mesh group.
  * \param locStats pointer to the localization statistics structure.
+ * \param nexhaust pointer to the number of points that needed an exhaustive
+ * localization (incremented).
  *
  * \return 0 if fail, 1 if success
  *
@@ -473,24 +632,24 @@ int PMMG_copyMetricsAndFields_point( MMG5_pMesh mesh ,MMG5_pMesh oldMesh,
  *  Oriented face areas are pre-computed in this function before proceeding
  *  with the localization.
  *
+ *  If ParMmg is compiled with OpenMP, the points are split into \a nthreads
+ *  contiguous chunks that are interpolated concurrently, each thread walking
+ *  from its own starting elements.
+ *
  */
 static
 int PMMG_interpMetricsAndFields_mesh( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
                                       MMG5_pSol met,MMG5_pSol oldMet,
                                       MMG5_pSol field,MMG5_pSol oldField,
                                       double *faceAreas,double *triaNormals,int *nodeTrias,
-                                      int *permNodGlob,uint8_t inputMet,
-                                      int myrank,int igrp,PMMG_locateStats *locStats ) {
-  MMG5_pTetra pt;
-  MMG5_pPoint ppt;
-  MMG5_pSol   psl,oldPsl;
-  PMMG_barycoord barycoord[4];
-  double      *normal,dd;
-  int         istartTetra,istartTria,ifoundTetra,ifoundTria;
-  int         ifoundEdge,ifoundVertex;
-  int         ip,ie,ifac,k,ia,ib,ic,iloc,nsols;
-  int         ismet,ier,j;
-  static int  mmgWarn=0;
+                                      PMMG_pLocateGrid grid,PMMG_pLocateMarks marks,
+                                      int nthreads,int *permNodGlob,uint8_t inputMet,
+                                      int myrank,int igrp,PMMG_locateStats *locStats,
+                                      int *nexhaust ) {
+  PMMG_pLocateMarks mymarks;
+  int               ifoundTetra,ifoundTria;
+  int               ip,nsols,nex;
+  int               ismet,ier;
 
   nsols = mesh->nsols;
 
@@ -518,129 +677,42 @@ int PMMG_interpMetricsAndFields_mesh( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
   ier = PMMG_precompute_triaNormals( oldMesh,triaNormals );
 
   /** Interpolate metrics */
-  oldMesh->base = 0;
-  for ( ie = 1; ie < oldMesh->ne+1; ie++ ) {
-    pt = &oldMesh->tetra[ie];
-    if ( !MG_EOK(pt) ) continue;
-    pt->flag = oldMesh->base;
-  }
-
-#ifndef USE_POINTMAP
-  ifoundTetra = ifoundTria = 1;
-#else
+#ifdef USE_POINTMAP
   PMMG_locate_setStart( mesh,oldMesh );
 #endif
-  /* Loop on new tetrahedra, and localize their vertices in the old mesh */
-  mesh->base++;
-  for( ie = 1; ie <= mesh->ne; ie++ ) {
-    pt = &mesh->tetra[ie];
-    if( !MG_EOK(pt) ) continue;
-    for( iloc = 0; iloc < 4; iloc++ ) {
-      ip = pt->v[iloc];
-      ppt = &mesh->point[ip];
-      if( !MG_VOK(ppt) ) continue;
-
-      /* Skip already interpolated points */
-      if( ppt->flag == mesh->base ) continue;
 
-      if( ppt->tag & MG_REQ ) {
-        /* Flag point as interpolated */
-        ppt->flag = mesh->base;
-        continue; // treated by copyMetric_points
-      } else if ( ppt->tag & MG_BDY ) {
+  /* Loop on new points, and localize them in the old mesh */
+  mesh->base++;
+  nex = 0;
 
-#ifdef USE_POINTMAP
-        ifoundTria = ppt->s;
+#ifdef USE_OPENMP
+#pragma omp parallel private(mymarks,ifoundTetra,ifoundTria) reduction(+:nex) num_threads(nthreads) if(nthreads>1)
 #endif
-        /** Locate point in the old mesh */
-        ier = PMMG_locatePointBdy( oldMesh, ppt,
-                                   triaNormals, nodeTrias, barycoord,
-                                   &ifoundTria,&ifoundEdge, &ifoundVertex );
-
-        if( mesh->info.imprim > PMMG_VERB_ITWAVES )
-          PMMG_locatePoint_errorCheck( mesh,ip,ier,myrank,igrp );
-
-        /** Interpolate point metrics */
-        if( ismet ) {
-          if( ifoundVertex != PMMG_UNSET ) {
-            ier = PMMG_copyMetrics( mesh,met,oldMesh,oldMet,ip,
-                                    oldMesh->tria[ifoundTria].v[ifoundVertex] );
-          } else if( ifoundEdge != PMMG_UNSET ) {
-            ier = PMMG_interp2bar( mesh,met,oldMet,&oldMesh->tria[ifoundTria],
-                                   ip,ifoundEdge,barycoord );
-          } else {
-            ier = PMMG_interp3bar(mesh,met,oldMet,&oldMesh->tria[ifoundTria],ip,
-                                  barycoord);
-          }
-        }
-
-        /** Field interpolation */
-        if ( mesh->nsols ) {
-          for ( j=0; j<mesh->nsols; ++j ) {
-            psl    = field + j;
-            oldPsl = oldField + j;
-            if ( oldPsl->size == 6 ) {
-              /* Tensor field */
-              ier = PMMG_interp3bar_ani(mesh,psl,oldPsl,
-                                        &oldMesh->tria[ifoundTria],
-                                        ip,barycoord);
-            }
-            else {
-              /* Scalar or vector field */
-              ier = PMMG_interp3bar_iso(mesh,psl,oldPsl,
-                                        &oldMesh->tria[ifoundTria],
-                                        ip,barycoord);
-            }
-          }
-        }
-
-        /* Flag point as interpolated */
-        ppt->flag = mesh->base;
-
-      } else {
-
-#ifdef USE_POINTMAP
-        ifoundTetra = ppt->s;
+  {
+#ifdef USE_OPENMP
+    mymarks = &marks[omp_get_thread_num()];
+#else
+    mymarks = marks;
 #endif
-        /** Locate point in the old volume mesh */
-        ier = PMMG_locatePointVol( oldMesh, ppt,
-                                   faceAreas, barycoord, &ifoundTetra );
-
-        if( mesh->info.imprim > PMMG_VERB_ITWAVES )
-          PMMG_locatePoint_errorCheck( mesh,ip,ier,myrank,igrp );
-
-        /** Interpolate volume point metrics */
-        if( ismet ) {
-          ier = PMMG_interp4bar(mesh,met,oldMet,&oldMesh->tetra[ifoundTetra],ip,
-                                barycoord);
-        }
-
-        /** Field interpolation */
-        if ( mesh->nsols ) {
-          for ( j=0; j<mesh->nsols; ++j ) {
-            psl    = field + j;
-            oldPsl = oldField + j;
-            if ( oldPsl->size == 6 ) {
-              /* Tensor field */
-              ier = PMMG_interp4bar_ani(mesh,psl,oldPsl,
-                                        &oldMesh->tetra[ifoundTetra],
-                                        ip,barycoord);
-            }
-            else {
-              /* Scalar or vector field */
-              ier = PMMG_interp4bar_iso(mesh,psl,oldPsl,
-                                        &oldMesh->tetra[ifoundTetra],
-                                        ip,barycoord);
-            }
-          }
-        }
 
-        /* Flag point as interpolated */
-        ppt->flag = mesh->base;
+    /* The first walk of each thread is seeded by the localization grid */
+    ifoundTetra = ifoundTria = 0;
 
-      }
+#ifdef USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+    for( ip = 1; ip <= mesh->np; ip++ ) {
+      if( !MG_VOK(&mesh->point[ip]) ) continue;
+
+      nex += PMMG_interpMetricsAndFields_point( mesh,oldMesh,met,oldMet,field,
+                                                oldField,faceAreas,triaNormals,
+                                                nodeTrias,grid,mymarks,ismet,ip,
+                                                &ifoundTetra,&ifoundTria,
+                                                myrank,igrp );
     }
   }
+  *nexhaust += nex;
+
 #ifndef NDEBUG
   PMMG_locate_postprocessing( mesh,oldMesh,locStats );
 #endif
@@ -666,10 +738,13 @@ int PMMG_interpMetricsAndFields( PMMG_pParMesh parmesh,int *permNodGlob ) {
   MMG5_pSol        met,oldMet,field,oldField;
   MMG5_Hash        hash;
   PMMG_locateStats *locStats,*mylocStats;
+  PMMG_locateGrid  grid;
+  PMMG_locateMarks *marks;
   double           *faceAreas,*triaNormals;
   int              *nodeTrias;
-  int              igrp,ier;
+  int              igrp,ier,k,nthreads,nexhaust;
   int8_t           allocated;
+  size_t           arenaMark;
 
   locStats = NULL;
 #ifndef NDEBUG
@@ -681,12 +756,13 @@ int PMMG_interpMetricsAndFields( PMMG_pParMesh parmesh,int *permNodGlob ) {
            parmesh->ngrp*sizeof(PMMG_locateStats) + sizeof(size_t),PTRDIFF_MAX);
   }
   else {
-    PMMG_MALLOC( parmesh,locStats,parmesh->ngrp,PMMG_locateStats,"locStats", );
+    PMMG_CALLOC( parmesh,locStats,parmesh->ngrp,PMMG_locateStats,"locStats", );
   }
 #endif
 
   /** Loop on current groups */
-  ier = 1;
+  ier      = 1;
+  nexhaust = 0;
   for( igrp = 0; igrp < parmesh->ngrp; igrp++ ) {
 
     grp  = &parmesh->listgrp[igrp];
@@ -694,17 +770,53 @@ int PMMG_interpMetricsAndFields( PMMG_pParMesh parmesh,int *permNodGlob ) {
     met  = grp->met;
     field = grp->field;
 
-    oldGrp  = &parmesh->old_listgrp[igrp];
-    oldMesh = oldGrp->mesh;
-    oldMet  = oldGrp->met;
-    oldField = oldGrp->field;
+    /* The group has not been remeshed: metrics and fields are unchanged */
+    if ( grp->isAdapted ) continue;
 
-    /** Pre-allocate oriented face areas and surface unit normals */
+    /* Background groups are not stored if there is nothing to interpolate */
+    if ( parmesh->old_listgrp ) {
+      oldGrp  = &parmesh->old_listgrp[igrp];
+      oldMesh = oldGrp->mesh;
+      oldMet  = oldGrp->met;
+      oldField = oldGrp->field;
+    }
+    else {
+      oldMesh  = NULL;
+      oldMet   = NULL;
+      oldField = NULL;
+    }
+
+    /** Pre-allocate oriented face areas and surface unit normals in the
+     * scratch arena (given back at the end of the group) */
     allocated = 0;
+    marks     = NULL;
+    nthreads  = 0;
+    memset(&grid,0,sizeof(PMMG_locateGrid));
+    arenaMark = PMMG_arena_mark( parmesh );
     if ( mesh->nsols || (( parmesh->info.inputMet == 1 ) && ( mesh->info.hsiz <= 0.0 )) ) {
-      PMMG_MALLOC( parmesh,faceAreas,12*(oldMesh->ne+1),double,"faceAreas",return 0 );
-      PMMG_MALLOC( parmesh,triaNormals,3*(oldMesh->nt+1),double,"triaNormals",return 0 );
-      PMMG_precompute_nodeTrias( parmesh,oldMesh,&nodeTrias );
+      PMMG_ARENA_MALLOC( parmesh,faceAreas,PMMG_BARYCOORD_SOA*(oldMesh->ne+1),double,
+                         "faceAreas",goto fail );
+      PMMG_ARENA_MALLOC( parmesh,triaNormals,3*(oldMesh->nt+1),double,"triaNormals",
+                         goto fail );
+      if ( !PMMG_precompute_nodeTrias( parmesh,oldMesh,&nodeTrias ) ) goto fail;
+
+      if ( !PMMG_locateGrid_build( parmesh,oldMesh,&grid ) ) {
+        /* Localization without grid (exhaustive searches) */
+        memset(&grid,0,sizeof(PMMG_locateGrid));
+      }
+
+      /* Marks of the visited background entities (one set per thread) */
+      k = 1;
+#ifdef USE_OPENMP
+      k = MG_MAX(1,parmesh->info.nthreads);
+#endif
+      PMMG_CALLOC( parmesh,marks,k,PMMG_locateMarks,"locate marks",goto fail );
+      for ( nthreads=0; nthreads<k; ++nthreads ) {
+        if ( !PMMG_locateMarks_init( parmesh,oldMesh,&marks[nthreads] ) ) break;
+      }
+      /* Use less threads if the marks of all threads cannot be allocated */
+      if ( !nthreads ) goto fail;
+
       allocated = 1;
     }
 
@@ -714,21 +826,28 @@ int PMMG_interpMetricsAndFields( PMMG_pParMesh parmesh,int *permNodGlob ) {
     }
     if( !PMMG_interpMetricsAndFields_mesh( mesh,oldMesh,met,oldMet,
                                            field,oldField,
-                                           faceAreas,triaNormals,nodeTrias,
+                                           faceAreas,triaNormals,nodeTrias,&grid,
+                                           marks,nthreads,
                                            permNodGlob,parmesh->info.inputMet,
-                                           parmesh->myrank,igrp,mylocStats ) ) {
+                                           parmesh->myrank,igrp,mylocStats,
+                                           &nexhaust ) ) {
       ier = 0;
     }
 
     /** Deallocate oriented face areas and surface unit normals */
     if( allocated ) {
-      PMMG_DEL_MEM(parmesh,faceAreas,double,"faceAreas");
-      PMMG_DEL_MEM(parmesh,triaNormals,double,"triaNormals");
-      PMMG_DEL_MEM(parmesh,nodeTrias,int,"nodeTrias");
+      PMMG_arena_release( parmesh,arenaMark );
+      PMMG_locateGrid_free(parmesh,&grid);
+      for ( k=0; k<nthreads; ++k ) {
+        PMMG_locateMarks_free( parmesh,&marks[k] );
+      }
+      PMMG_DEL_MEM(parmesh,marks,PMMG_locateMarks,"locate marks");
     }
 
   }
 
+  PMMG_trace_addExhaustive( parmesh,nexhaust );
+
 #ifndef NDEBUG
   if( ((( parmesh->info.inputMet == 1 ) && ( mesh->info.hsiz <= 0.0 )) || mesh->nsols)
       && (parmesh->info.imprim0 > PMMG_VERB_DETQUAL) ) {
@@ -738,4 +857,19 @@ int PMMG_interpMetricsAndFields( PMMG_pParMesh parmesh,int *permNodGlob ) {
 #endif
 
   return ier;
+
+fail:
+  PMMG_locateGrid_free(parmesh,&grid);
+  if ( marks ) {
+    for ( k=0; k<nthreads; ++k ) {
+      PMMG_locateMarks_free( parmesh,&marks[k] );
+    }
+    PMMG_DEL_MEM(parmesh,marks,PMMG_locateMarks,"locate marks");
+  }
+  PMMG_arena_release( parmesh,arenaMark );
+#ifndef NDEBUG
+  PMMG_DEL_MEM(parmesh,locStats,PMMG_locateStats,"locStats");
+#endif
+
+  return 0;
 }
@@ -219,7 +219,7 @@ int PMMG_preprocessMesh_distributed( PMMG_pParMesh parmesh )
    * local entity indices (for node comms, also itosend and itorecv arrays are
    * filled with local/global node IDs).
   */
-  if( parmesh->nprocs >1 ) {
+  if( parmesh->nprocs >1 && !parmesh->session_open ) {
     if( parmesh->info.API_mode == PMMG_APIDISTRIB_faces && !parmesh->next_face_comm ) {
       fprintf(stderr," ## Error: %s: parallel interface faces must be set through the API interface\n",__func__);
       return PMMG_STRONGFAILURE;
@@ -232,6 +232,13 @@ int PMMG_preprocessMesh_distributed( PMMG_pParMesh parmesh )
   /** Function setters (must be assigned before quality computation) */
   MMG3D_Set_commonFunc();
 
+  /* Session: recompute the hmin/hmax values of the previous call from the new
+   * metric (unless provided by the user) */
+  if ( parmesh->session_open ) {
+    if ( !parmesh->info.sethmin ) mesh->info.sethmin = 0;
+    if ( !parmesh->info.sethmax ) mesh->info.sethmax = 0;
+  }
+
   /** Mesh scaling and quality histogram */
   if ( !MMG5_scaleMesh(mesh,met,NULL) ) {
     return PMMG_LOWFAILURE;
@@ -275,6 +282,10 @@ int PMMG_preprocessMesh_distributed( PMMG_pParMesh parmesh )
     return PMMG_STRONGFAILURE;
   }
 
+  /** Session: the communicators and the geometric analysis of the output of
+   * the previous call are still valid */
+  if ( parmesh->session_open ) goto histo;
+
   /** Mesh analysis I: check triangles, create xtetras */
   if ( !PMMG_analys_tria(parmesh,mesh) ) {
     return PMMG_STRONGFAILURE;
@@ -296,7 +307,7 @@ int PMMG_preprocessMesh_distributed( PMMG_pParMesh parmesh )
       parmesh->next_node_comm = 0;
       PMMG_DEL_MEM(parmesh, parmesh->int_node_comm,PMMG_Int_comm,"int node comm");
       PMMG_CALLOC(parmesh,parmesh->int_node_comm,1,PMMG_Int_comm,"int node comm",return 0);
-      if ( !PMMG_build_nodeCommFromFaces(parmesh) ) return PMMG_STRONGFAILURE;
+      if ( !PMMG_build_nodeCommFromFaces(parmesh,0) ) return PMMG_STRONGFAILURE;
       break;
     case PMMG_APIDISTRIB_nodes :
       /* 1) Set node communicators indexing */
@@ -315,6 +326,7 @@ int PMMG_preprocessMesh_distributed( PMMG_pParMesh parmesh )
     return PMMG_STRONGFAILURE;
   }
 
+histo:
   if ( !PMMG_qualhisto(parmesh,PMMG_INQUA,0) ) {
     return PMMG_STRONGFAILURE;
   }
@@ -365,7 +377,9 @@ int PMMG_distributeMesh_centralized_timers( PMMG_pParMesh parmesh,mytime *ctim )
       chrono(ON,&(ctim[tim]));
       fprintf(stdout,"\n  -- ANALYSIS" );
     }
+    PMMG_trace_begin( parmesh,PMMG_TRACE_analys );
     ier = PMMG_preprocessMesh( parmesh );
+    PMMG_trace_end( parmesh,PMMG_TRACE_analys );
     if ( parmesh->info.imprim >= PMMG_VERB_STEPS ) {
       chrono(OFF,&(ctim[tim]));
       printim(ctim[tim].gdif,stim);
@@ -1306,6 +1320,26 @@ int PMMG_color_commNodes( PMMG_pParMesh parmesh ) {
   return 1;
 }
 
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * \return 1 if the output mesh stays distributed over the processes, 0 if it
+ * is merged on the root process.
+ *
+ */
+static inline
+int PMMG_distributedOutput( PMMG_pParMesh parmesh ) {
+
+  switch ( parmesh->info.fmtout ) {
+  case ( PMMG_UNSET ): case ( MMG5_FMT_VtkPvtu ): case ( PMMG_FMT_Distributed ):
+  case ( PMMG_FMT_DistributedMeditASCII ): case ( PMMG_FMT_DistributedMeditBinary ):
+  case ( PMMG_FMT_ParallelMeditBinary ):
+    return 1;
+  default:
+    return 0;
+  }
+}
+
 /**
  * \param parmesh pointer toward the parmesh
  *
@@ -1334,15 +1368,19 @@ int PMMG_parmmglib_post(PMMG_pParMesh parmesh) {
     break;
   case ( MMG5_FMT_VtkPvtu ): case ( PMMG_FMT_Distributed ):
   case ( PMMG_FMT_DistributedMeditASCII ): case ( PMMG_FMT_DistributedMeditBinary ):
+  case ( PMMG_FMT_ParallelMeditBinary ):
 
-    /* Distributed Output */
+    /* Distributed Output (or centralized output written by all the
+     * processes) */
     tim = 1;
     chrono(ON,&(ctim[tim]));
     if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
       fprintf( stdout,"\n   -- PHASE 3 : MESH PACKED UP\n" );
     }
 
+    PMMG_trace_begin( parmesh,PMMG_TRACE_pack );
     ier = PMMG_bdryBuild ( parmesh );
+    PMMG_trace_end( parmesh,PMMG_TRACE_pack );
 
     MPI_Allreduce( &ier, &iresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
     if ( !iresult ) {
@@ -1353,7 +1391,8 @@ int PMMG_parmmglib_post(PMMG_pParMesh parmesh) {
     }
 
 
-    if( parmesh->info.globalNum ) {
+    if( parmesh->info.globalNum ||
+        parmesh->info.fmtout == PMMG_FMT_ParallelMeditBinary ) {
 
       ier = PMMG_Compute_verticesGloNum( parmesh );
       if( !ier ) {
@@ -1362,13 +1401,24 @@ int PMMG_parmmglib_post(PMMG_pParMesh parmesh) {
         }
       }
 
+      iresult = ier;
       ier = PMMG_Compute_trianglesGloNum( parmesh );
       if( !ier ) {
         if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
           fprintf(stdout,"\n\n\n  -- WARNING: IMPOSSIBLE TO COMPUTE TRIANGLE GLOBAL NUMBERING\n\n\n");
         }
       }
+      ier = ier && iresult;
 
+      /* The parallel writing of a centralized mesh needs the global numbering */
+      MPI_Allreduce( &ier, &iresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+      if ( !iresult && parmesh->info.fmtout == PMMG_FMT_ParallelMeditBinary ) {
+        if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
+          fprintf(stdout,"\n\n\n  -- IMPOSSIBLE TO WRITE THE CENTRALIZED MESH..."
+                  " TRY TO SAVE DISTRIBUTED MESHES\n\n\n");
+        }
+        parmesh->info.fmtout = PMMG_FMT_DistributedMeditBinary;
+      }
     }
 
 
@@ -1388,7 +1438,9 @@ int PMMG_parmmglib_post(PMMG_pParMesh parmesh) {
       fprintf( stdout,"\n   -- PHASE 3 : MERGE MESHES OVER PROCESSORS\n" );
     }
 
+    PMMG_trace_begin( parmesh,PMMG_TRACE_merge );
     ier = PMMG_merge_parmesh( parmesh );
+    PMMG_trace_end( parmesh,PMMG_TRACE_merge );
     MPI_Allreduce( &ier, &iresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
 
     if ( !iresult ) {
@@ -1462,6 +1514,12 @@ int PMMG_parmmglib_centralized(PMMG_pParMesh parmesh) {
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
 
+  /* Start the performance trace (if asked) */
+  PMMG_trace_init( parmesh );
+
+  /* The centralized mesh is always distributed again */
+  parmesh->session_open = 0;
+
   /* I/O check: if an input field name is provided but the output one is not,
    compute automatically an output solution field name. */
   if ( parmesh->fieldin &&  *parmesh->fieldin ) {
@@ -1499,12 +1557,15 @@ int PMMG_parmmglib_centralized(PMMG_pParMesh parmesh) {
     fprintf(stdout,"  -- PHASE 2 COMPLETED.     %s\n",stim);
   }
   if ( ierlib == PMMG_STRONGFAILURE ) {
+    PMMG_trace_write( parmesh );
     return ierlib;
   }
 
   ier = PMMG_parmmglib_post(parmesh);
   ierlib = MG_MAX ( ier, ierlib );
 
+  PMMG_trace_write( parmesh );
+
   chrono(OFF,&ctim[0]);
   printim(ctim[0].gdif,stim);
   if ( parmesh->info.imprim >= PMMG_VERB_VERSION ) {
@@ -1536,6 +1597,9 @@ int PMMG_parmmglib_distributed(PMMG_pParMesh parmesh) {
   tminit(ctim,TIMEMAX);
   chrono(ON,&(ctim[0]));
 
+  /* Start the performance trace (if asked) */
+  PMMG_trace_init( parmesh );
+
   /** Check input data */
   tim = 1;
   chrono(ON,&(ctim[tim]));
@@ -1556,6 +1620,17 @@ int PMMG_parmmglib_distributed(PMMG_pParMesh parmesh) {
     }
   }
 
+  /* Session: the metric computed by the previous call from the hsiz or optim
+   * options is not an input metric */
+  if ( parmesh->session_open && parmesh->ngrp ) {
+    mesh = parmesh->listgrp[0].mesh;
+    met  = parmesh->listgrp[0].met;
+    if ( mesh->info.optim || mesh->info.hsiz > 0. ) {
+      MMG5_DEL_MEM(mesh,met->m);
+      met->np = 0;
+    }
+  }
+
   ier = PMMG_check_inputData( parmesh );
   MPI_CHECK( MPI_Allreduce( &ier, &iresult, 1, MPI_INT, MPI_MIN, parmesh->comm ),
              return PMMG_LOWFAILURE);
@@ -1577,7 +1652,9 @@ int PMMG_parmmglib_distributed(PMMG_pParMesh parmesh) {
   if ( parmesh->ngrp ) {
     /** Mesh preprocessing: set function pointers, scale mesh, perform mesh
      * analysis and display length and quality histos. */
+    PMMG_trace_begin( parmesh,PMMG_TRACE_analys );
     ier  = PMMG_preprocessMesh_distributed( parmesh );
+    PMMG_trace_end( parmesh,PMMG_TRACE_analys );
     mesh = parmesh->listgrp[0].mesh;
     met  = parmesh->listgrp[0].met;
     if ( (ier==PMMG_STRONGFAILURE) && MMG5_unscaleMesh( mesh, met, NULL ) ) {
@@ -1588,6 +1665,7 @@ int PMMG_parmmglib_distributed(PMMG_pParMesh parmesh) {
 
   MPI_Allreduce( &ier, &iresult, 1, MPI_INT, MPI_MAX, parmesh->comm );
   if ( iresult!=PMMG_SUCCESS ) {
+    parmesh->session_open = 0;
     return iresult;
   }
 
@@ -1614,12 +1692,22 @@ int PMMG_parmmglib_distributed(PMMG_pParMesh parmesh) {
     fprintf(stdout,"  -- PHASE 2 COMPLETED.     %s\n",stim);
   }
   if ( ierlib == PMMG_STRONGFAILURE ) {
+    parmesh->session_open = 0;
+    PMMG_trace_write( parmesh );
     return ierlib;
   }
 
   ier = PMMG_parmmglib_post(parmesh);
   ierlib = MG_MAX ( ier, ierlib );
 
+  /* Keep the adapted mesh and its parallel structures for the next call of the
+   * session (the success and the output format are the same on all the
+   * processes) */
+  parmesh->session_open = parmesh->info.session && ( ierlib == PMMG_SUCCESS )
+    && PMMG_distributedOutput( parmesh );
+
+  PMMG_trace_write( parmesh );
+
   chrono(OFF,&ctim[0]);
   printim(ctim[0].gdif,stim);
   if ( parmesh->info.imprim >= PMMG_VERB_VERSION ) {
@@ -80,6 +80,18 @@ enum PMMG_Param {
   PMMG_IPARAM_APImode,           /*!< [0/1], Initialize parallel library through interface faces or nodes */
   PMMG_IPARAM_globalNum,         /*!< [1,0], Compute nodes and triangles global numbering in output */
   PMMG_IPARAM_niter,             /*!< [n], Set the number of remeshing iterations */
+  PMMG_IPARAM_nthreads,          /*!< [n], Number of threads used to remesh and interpolate the groups of a process (needs OpenMP) */
+  PMMG_IPARAM_workWgt,           /*!< [1/0], Weight the partitioning and the interface displacement by the predicted remeshing work of the elements */
+  PMMG_IPARAM_parallelInput,     /*!< [0/1], Read a centralized binary Medit mesh (and metric) on all the processes */
+  PMMG_IPARAM_parallelOutput,    /*!< [0/1], Write the centralized binary Medit mesh (and metric) from all the processes */
+  PMMG_IPARAM_loadBalancingMode, /*!< [1/2/4], Partitioner of the meshes: metis, parmetis or space filling curve (see PMMG_LOADBALANCING_) */
+  PMMG_IPARAM_adaptiveNiter,     /*!< [0/1], Stop the iterations when the adaptation has converged, iterate more while the interfaces are not adapted */
+  PMMG_IPARAM_niterMax,          /*!< [n], Maximal number of iterations of the adaptive iterations mode */
+  PMMG_IPARAM_skipAdapted,       /*!< [0/1], Don't remesh the groups that are already adapted to the metric */
+  PMMG_IPARAM_checkComm,         /*!< [0/1], Check the consistency of the communicators after each redistribution */
+  PMMG_IPARAM_session,           /*!< [0/1], Keep the partition and the parallel structures between successive calls of PMMG_parmmglib_distributed */
+  PMMG_IPARAM_autoTune,          /*!< [0/1], Tune the groups size and the metis ratio from the remeshing times measured at each iteration */
+  PMMG_IPARAM_sfcRenum,          /*!< [1/0], Renumber the points and tetra of the groups along a space filling curve after each splitting (unused with the Scotch renumbering) */
   PMMG_DPARAM_angleDetection,    /*!< [val], Value for angle detection */
   PMMG_DPARAM_hmin,              /*!< [val], Minimal mesh size */
   PMMG_DPARAM_hmax,              /*!< [val], Maximal mesh size */
@@ -88,6 +100,9 @@ enum PMMG_Param {
   PMMG_DPARAM_hgrad,             /*!< [val], Control gradation */
   PMMG_DPARAM_hgradreq,          /*!< [val], Control gradation from required entities */
   PMMG_DPARAM_ls,                /*!< [val], Value of level-set */
+  PMMG_DPARAM_convLength,        /*!< [val], Max fraction of edges of length out of [0.7,1.4] at convergence (adaptive iterations) */
+  PMMG_DPARAM_convQuality,       /*!< [val], Minimal element quality at convergence (adaptive iterations) */
+  PMMG_DPARAM_itrRatio,          /*!< [val], Ratio between the communication and the migration costs for the adaptive repartitioning of parmetis (0: compute a new partition, other values need ParMetis) */
   PMMG_PARAM_size,               /*!< [n], Number of parameters */
 };
 
@@ -135,6 +150,13 @@ enum PMMG_Param {
  *
  * Main program for the parallel remesh library for distributed meshes.
  *
+ * \remark If the \ref PMMG_IPARAM_session parameter is enabled and the output
+ * mesh stays distributed, the adapted mesh, its partition and its parallel
+ * structures are kept in the parmesh. The next call then adapts this mesh to
+ * the metric (and fields) updated through the API without rebuilding the
+ * communicators nor redoing the geometric analysis. Setting a new mesh or new
+ * communicators closes the session.
+ *
  * \remark Fortran interface:
  * >   SUBROUTINE PMMG_parmmglib_distributed(parmesh,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: parmesh\n
@@ -307,6 +329,28 @@ int  PMMG_Set_outputSolsName(PMMG_pParMesh parmesh, const char* solout);
  *
  */
 int  PMMG_Set_outputMetName(PMMG_pParMesh parmesh, const char* metout);
+/**
+ * \param parmesh pointer toward a parmesh structure.
+ * \param tracename name of the performance trace file (NULL to disable the
+ * trace).
+ * \return 0 if failed, 1 otherwise.
+ *
+ *  Set the name of the performance trace file. If provided, the timings and
+ *  counts of each phase of the run (group splitting, remeshing, interpolation,
+ *  load balancing, analysis, merging, packing) are recorded on every process
+ *  and written by the root process in the Chrome trace event format. Must be
+ *  called on all the processes.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SET_TRACENAME(parmesh,tracename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: tracename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int  PMMG_Set_traceName(PMMG_pParMesh parmesh, const char* tracename);
 
 /**
  * \param parmesh pointer toward the parmesh structure.
@@ -627,6 +671,52 @@ int PMMG_Set_tetrahedron(PMMG_pParMesh parmesh, int v0, int v1, int v2, int v3,
  */
 int PMMG_Set_tetrahedra(PMMG_pParMesh parmesh, int *tetra, int *refs);
 
+/**
+ * \param parmesh  pointer toward the group structure.
+ * \param vertices table of the points coordinates. The \f$d^{th}\f$ coordinate
+ * of the \f$i^{th}\f$ point is stored in
+ * vertices[(i-1)*verStride+d*verCompStride] (\f$d\in[0,2]\f$).
+ * \param verStride distance between the coordinates of two successive points.
+ * \param verCompStride distance between two coordinates of a point.
+ * \param verRefs table of the point references (the ref of the \f$i^{th}\f$
+ * point is stored in verRefs[i-1]), NULL to set null references.
+ * \param tetra table of the tetra vertices. The \f$j^{th}\f$ vertex of the
+ * \f$i^{th}\f$ tetra is stored in tetra[(i-1)*tetStride+j*tetCompStride]
+ * (\f$j\in[0,3]\f$).
+ * \param tetStride distance between the vertices of two successive tetra.
+ * \param tetCompStride distance between two vertices of a tetra.
+ * \param tetRefs table of the tetra references (the ref of the \f$i^{th}\f$
+ * tetra is stored in tetRefs[i-1]), NULL to set null references.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Set the vertices and the tetrahedra of the mesh in one pass over arrays of
+ * any layout: interleaved arrays (verStride=3, verCompStride=1, tetStride=4,
+ * tetCompStride=1) as well as arrays of structures of arrays (verStride=1,
+ * verCompStride=np, tetStride=1, tetCompStride=ne) are read without
+ * intermediate copy. The mesh size must be set before (\ref
+ * PMMG_Set_meshSize). Tetrahedra with a negative volume are reoriented.
+ *
+ * \remark Fortran interface: (commentated in order to allow to pass \%val(0)
+ * instead of the verRefs or tetRefs arrays)
+ *
+ * > !  SUBROUTINE PMMG_SET_MESHARRAYS(parmesh,vertices,verStride,verCompStride,&\n
+ * > !                                 verRefs,tetra,tetStride,tetCompStride,&\n
+ * > !                                 tetRefs,retval)\n
+ * > !    MMG5_DATA_PTR_T,INTENT(INOUT)          :: parmesh\n
+ * > !    REAL(KIND=8), DIMENSION(*), INTENT(IN) :: vertices\n
+ * > !    INTEGER, INTENT(IN)                    :: verStride,verCompStride\n
+ * > !    INTEGER, DIMENSION(*), INTENT(IN)      :: verRefs,tetra,tetRefs\n
+ * > !    INTEGER, INTENT(IN)                    :: tetStride,tetCompStride\n
+ * > !    INTEGER, INTENT(OUT)                   :: retval\n
+ * > !  END SUBROUTINE\n
+ *
+ */
+int PMMG_Set_meshArrays(PMMG_pParMesh parmesh,
+                        double *vertices,int verStride,int verCompStride,
+                        int *verRefs,
+                        int *tetra,int tetStride,int tetCompStride,
+                        int *tetRefs);
+
 /**
  * \param parmesh pointer toward the group structure.
  * \param v0  first vertex of prism.
@@ -1306,6 +1396,49 @@ int  PMMG_Get_tetrahedron(PMMG_pParMesh parmesh, int* v0, int* v1, int* v2,
 int  PMMG_Get_tetrahedra(PMMG_pParMesh parmesh, int* tetra,int* refs,
                           int* areRequired);
 
+/**
+ * \param parmesh  pointer toward the group structure.
+ * \param vertices pointer toward the table of the points coordinates. The
+ * \f$d^{th}\f$ coordinate of the \f$i^{th}\f$ point is stored in
+ * vertices[(i-1)*verStride+d*verCompStride] (\f$d\in[0,2]\f$).
+ * \param verStride distance between the coordinates of two successive points.
+ * \param verCompStride distance between two coordinates of a point.
+ * \param verRefs pointer toward the table of the point references (the ref of
+ * the \f$i^{th}\f$ point is stored in verRefs[i-1]), may be NULL.
+ * \param tetra pointer toward the table of the tetra vertices. The
+ * \f$j^{th}\f$ vertex of the \f$i^{th}\f$ tetra is stored in
+ * tetra[(i-1)*tetStride+j*tetCompStride] (\f$j\in[0,3]\f$).
+ * \param tetStride distance between the vertices of two successive tetra.
+ * \param tetCompStride distance between two vertices of a tetra.
+ * \param tetRefs pointer toward the table of the tetra references (the ref of
+ * the \f$i^{th}\f$ tetra is stored in tetRefs[i-1]), may be NULL.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Get the vertices and the tetrahedra of the mesh in one pass into arrays of
+ * any layout (see \ref PMMG_Set_meshArrays).
+ *
+ * \remark Fortran interface: (commentated in order to allow to pass \%val(0)
+ * instead of the verRefs or tetRefs arrays)
+ *
+ * > !  SUBROUTINE PMMG_GET_MESHARRAYS(parmesh,vertices,verStride,verCompStride,&\n
+ * > !                                 verRefs,tetra,tetStride,tetCompStride,&\n
+ * > !                                 tetRefs,retval)\n
+ * > !    MMG5_DATA_PTR_T,INTENT(INOUT)           :: parmesh\n
+ * > !    REAL(KIND=8), DIMENSION(*), INTENT(OUT) :: vertices\n
+ * > !    INTEGER, INTENT(IN)                     :: verStride,verCompStride\n
+ * > !    INTEGER, DIMENSION(*), INTENT(OUT)      :: tetra\n
+ * > !    INTEGER, DIMENSION(*)                   :: verRefs,tetRefs\n
+ * > !    INTEGER, INTENT(IN)                     :: tetStride,tetCompStride\n
+ * > !    INTEGER, INTENT(OUT)                    :: retval\n
+ * > !  END SUBROUTINE\n
+ *
+ */
+int  PMMG_Get_meshArrays(PMMG_pParMesh parmesh,
+                         double *vertices,int verStride,int verCompStride,
+                         int *verRefs,
+                         int *tetra,int tetStride,int tetCompStride,
+                         int *tetRefs);
+
 /**
  * \param parmesh pointer toward the mesh structure.
  * \param v0  pointer toward the first vertex of prism.
@@ -1812,6 +1945,33 @@ int PMMG_usage( PMMG_pParMesh parmesh, char * const prog);
  *
  */
   int PMMG_loadMesh_centralized(PMMG_pParMesh parmesh,const char *filename);
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of file.
+ * \return 1 if success, 0 if the file is not found, PMMG_MPIIO_CENTRALIZED if
+ * the metric file can't be read collectively (ASCII or unsupported file:
+ * nothing is read and the centralized reading must be used), -1 otherwise
+ *
+ * Read a centralized binary Medit mesh (.meshb) on all the processes: each
+ * process reads a slice of the file through MPI-IO and the elements are
+ * distributed along a space filling curve, so the mesh is never stored on a
+ * single process. The vertex metric given by \ref PMMG_Set_inputMetName
+ * (binary .solb file) is read in the same way, a missing metric file is
+ * ignored. The parmesh is filled as a
+ * distributed mesh with node communicators (API mode
+ * \a PMMG_APIDISTRIB_nodes), ready for \ref PMMG_parmmglib_distributed.
+ * Collective function.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_LOADMESH_PARALLEL(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_loadMesh_parallel(PMMG_pParMesh parmesh,const char *filename);
 /**
  * \param parmesh pointer toward the parmesh structure.
  * \param filename name of file.
@@ -1955,6 +2115,30 @@ int PMMG_usage( PMMG_pParMesh parmesh, char * const prog);
  *
  */
   int PMMG_saveMesh_distributed(PMMG_pParMesh parmesh, const char *filename);
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename pointer toward the name of file.
+
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Save a distributed mesh into one centralized binary Medit file (.meshb):
+ * each process writes the vertices, triangles and edges it owns and its
+ * tetrahedra through MPI-IO at the position given by the global numbering, so
+ * the mesh is never gathered on a single process. The vertex and triangle
+ * global numberings must have been computed (output format \a
+ * PMMG_FMT_ParallelMeditBinary or \a PMMG_IPARAM_globalNum parameter).
+ * Collective function.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SAVEMESH_PARALLEL(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_saveMesh_parallel(PMMG_pParMesh parmesh, const char *filename);
 /**
  * \param parmesh pointer toward the parmesh structure.
  * \param filename name of file.
@@ -1990,6 +2174,25 @@ int PMMG_usage( PMMG_pParMesh parmesh, char * const prog);
  *
  */
   int PMMG_saveMet_distributed(PMMG_pParMesh parmesh, const char *filename);
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of file.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Write the isotropic or anisotropic metric of a distributed mesh into one
+ * centralized binary file (.solb) from all the processes, in the vertex order
+ * of \ref PMMG_saveMesh_parallel. Collective function.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SAVEMET_PARALLEL(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_saveMet_parallel(PMMG_pParMesh parmesh, const char *filename);
 
 /**
  * \param parmesh pointer toward the parmesh structure.
@@ -34,6 +34,36 @@
  *
  */
 #include "parmmg.h"
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * \struct PMMG_remeshStats
+ * \brief Remeshing times of the groups of a process (sums over the remeshed
+ * groups, used by the auto-tuning of the groups size).
+ */
+typedef struct {
+  double ngrp;  /*!< number of remeshed groups */
+  double sn;    /*!< sum of the groups sizes (nb of tetra before remeshing) */
+  double st;    /*!< sum of the groups remeshing times */
+  double snn;   /*!< sum of the squared groups sizes */
+  double snt;   /*!< sum of the groups sizes times their remeshing times */
+  double wtime; /*!< wall time of the remeshing of the process */
+} PMMG_remeshStats;
+
+/**
+ * \return the wall time (usable in OpenMP threads).
+ *
+ */
+static inline
+double PMMG_wtime( void ) {
+#ifdef USE_OPENMP
+  return omp_get_wtime();
+#else
+  return MPI_Wtime();
+#endif
+}
 
 /**
  * \param grp pointer toward the group in which we want to update the list of
@@ -294,7 +324,8 @@ int PMMG_packParMesh( PMMG_pParMesh parmesh )
  *
  * Store in \a facesVertices the nodes indices of the interface faces.  The \f$
  * i^th \f$ face is stored at the \f$ [ 3*i;3$i+2 ] positions of the \a
- * facesData array. The \a facesData array is allocated in this function.
+ * facesData array. The \a facesData array is allocated in this function (on
+ * the group mesh).
  *
  */
 static inline
@@ -311,11 +342,12 @@ int PMMG_store_faceVerticesInIntComm( PMMG_pParMesh parmesh, int igrp,
 
   grp                 = &parmesh->listgrp[igrp];
   nitem_int_face_comm = grp->nitem_int_face_comm;
+  mesh                = grp->mesh;
 
-  PMMG_MALLOC(parmesh,*facesData,3*nitem_int_face_comm,int,"facesData",return 0);
+  /* Memory is counted on the group mesh: groups may be treated concurrently */
+  PMMG_MALLOC(mesh,*facesData,3*nitem_int_face_comm,int,"facesData",return 0);
 
   face2int_face_comm_index1 = grp->face2int_face_comm_index1;
-  mesh                      = parmesh->listgrp[igrp].mesh;
   for ( k=0; k<nitem_int_face_comm; ++k ) {
     /** Get the vertices indices of the interface triangles */
     iel   =  face2int_face_comm_index1[k]/12;
@@ -441,16 +473,33 @@ hash:
   MMG5_DEL_MEM(mesh,hash.item);
 
 facesData:
-  PMMG_DEL_MEM(parmesh,facesData,int,"facesData");
+  PMMG_DEL_MEM(mesh,facesData,int,"facesData");
 
   return ier;
 }
 
+/**
+ * \param warnScotch pointer toward the flag storing if a scotch warning has
+ * been printed (shared by the threads remeshing the groups).
+ *
+ * Print the scotch warning once.
+ *
+ */
 static inline void PMMG_scotch_message( int8_t *warnScotch ) {
+  int8_t warned;
+
+#ifdef USE_OPENMP
+#pragma omp critical (PMMG_scotch_message)
+#endif
+  {
+    warned      = *warnScotch;
+    *warnScotch = 1;
+  }
+
+  if ( warned ) return;
 
   fprintf(stdout, "\n  ## Warning: %s: Unable to renumber mesh entites.\n"
           "Renumbering disabled.\n",__func__);
-  *warnScotch = 1;
 
   return;
 }
@@ -472,6 +521,8 @@ int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
   int        k,imprim;
   int8_t     warnScotch;
 
+  warnScotch = 0;
+
   mesh  = parmesh->listgrp[igrp].mesh;
   met   = parmesh->listgrp[igrp].met;
   field = parmesh->listgrp[igrp].field;
@@ -534,6 +585,467 @@ int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
   return 1;
 }
 
+/**
+ * \param parmesh pointer toward a parmesh structure
+ * \param igrp index of the group to remesh
+ * \param warnScotch pointer toward the flag storing if a scotch warning has
+ * been printed
+ *
+ * \return PMMG_SUCCESS if success, PMMG_LOWFAILURE if we are not able to remesh
+ * the group but the mesh is conform, PMMG_STRONGFAILURE if the mesh is non
+ * conform.
+ *
+ * Remesh the group \a igrp with Mmg and update its interface communicators.
+ * Only the memory of the group mesh is modified so different groups can be
+ * remeshed concurrently. If \a info.skip_adapted is set, groups that are
+ * already adapted are left untouched and marked with \a isAdapted.
+ *
+ */
+static
+int PMMG_remesh_grp( PMMG_pParMesh parmesh,int igrp,int8_t *warnScotch ) {
+  PMMG_pGrp  oldGrp;
+  MMG5_pMesh mesh;
+  MMG5_pSol  met,field,psl;
+  int        ier,ierComm,k,is,*facesData,*permNodGlob;
+
+  mesh         = parmesh->listgrp[igrp].mesh;
+  met          = parmesh->listgrp[igrp].met;
+  field        = parmesh->listgrp[igrp].field;
+
+#ifdef USE_POINTMAP
+  for( k = 1; k <= mesh->np; k++ )
+    mesh->point[k].src = k;
+#endif
+
+  /* Reset the value of the fem mode */
+  mesh->info.fem = parmesh->info.fem;
+
+  parmesh->listgrp[igrp].isAdapted = 0;
+
+  if ( (!mesh->np) && (!mesh->ne) ) {
+    /* Empty mesh */
+    return PMMG_SUCCESS;
+  }
+
+  /** Don't remesh the groups that are already adapted to the input metric
+   * (the qualities are computed at the end of the previous iteration) */
+  if ( parmesh->info.skip_adapted && parmesh->iter > 0 &&
+       parmesh->info.inputMet == 1 && PMMG_isAdapted_grp(parmesh,igrp) ) {
+    parmesh->listgrp[igrp].isAdapted = 1;
+    if ( mesh->adja )
+      PMMG_DEL_MEM(mesh,mesh->adja,int,"adja table");
+    return PMMG_SUCCESS;
+  }
+
+  /** Store the vertices of interface faces in the internal communicator */
+  if ( !PMMG_store_faceVerticesInIntComm(parmesh,igrp,&facesData) ) {
+    /* We are not able to remesh */
+    fprintf(stderr,"\n  ## Interface faces storage problem."
+            " Exit program.\n");
+    return PMMG_LOWFAILURE;
+  }
+
+  /* We can remesh */
+  permNodGlob = NULL;
+
+#ifdef USE_SCOTCH
+  /* Allocation of the array that will store the node permutation */
+  PMMG_MALLOC(mesh,permNodGlob,mesh->np+1,int,"node permutation",
+              PMMG_scotch_message(warnScotch) );
+  if ( permNodGlob ) {
+    for ( k=1; k<=mesh->np; ++k ) {
+      permNodGlob[k] = k;
+    }
+    for ( k=1; k<=mesh->npi; ++k ) {
+      assert  ( permNodGlob[k] >0 );
+    }
+
+  }
+
+  /* renumerotation if available: no need to renum the field here (they
+   * will be interpolated) */
+  assert ( mesh->npi==mesh->np );
+  if ( permNodGlob ) {
+#ifdef USE_OPENMP
+#pragma omp critical (PMMG_remesh_grp_scotch)
+#endif
+    ier = MMG5_scotchCall(mesh,met,NULL,permNodGlob);
+
+    if ( !ier ) {
+      PMMG_scotch_message(warnScotch);
+    }
+  }
+#endif
+
+  /* Mark reinitialisation in order to be able to remesh all the mesh */
+  mesh->mark = 0;
+  mesh->base = 0;
+  for ( k=1 ; k<=mesh->nemax ; k++ ) {
+    mesh->tetra[k].mark = mesh->mark;
+    mesh->tetra[k].flag = mesh->base;
+  }
+
+  /** Call the remesher */
+  /* Here we need to scale the mesh */
+  if ( !MMG5_scaleMesh(mesh,met,NULL) ) { goto strong_failed; }
+
+  if ( !mesh->adja ) {
+    if ( !MMG3D_hashTetra(mesh,0) ) {
+      fprintf(stderr,"\n  ## Hashing problem. Exit program.\n");
+      goto strong_failed;
+    }
+  }
+
+#ifdef PATTERN
+  ier = MMG5_mmg3d1_pattern( mesh, met, permNodGlob );
+#else
+  ier = MMG5_mmg3d1_delone( mesh, met, permNodGlob );
+#endif
+  mesh->npi = mesh->np;
+  mesh->nei = mesh->ne;
+
+  if ( !ier ) {
+    fprintf(stderr,"\n  ## MMG remeshing problem. Exit program.\n");
+  }
+
+  /* Realloc the solution fields at the same size than other structures */
+  if ( mesh->nsols ) {
+    for ( is=0; is<mesh->nsols; ++is ) {
+      psl    = field + is;
+      assert ( psl && psl->m );
+      PMMG_REALLOC(mesh,psl->m,psl->size*(mesh->npmax+1),
+                   psl->size*(psl->npmax+1),double,
+                   "field array",goto strong_failed);
+      psl->npmax = mesh->npmax;
+    }
+  }
+
+  if ( parmesh->iter < parmesh->niter-1 && (!parmesh->info.inputMet) ) {
+    /* Delete the metrec computed by Mmg except at last iter */
+    PMMG_DEL_MEM(mesh,met->m,double,"internal metric");
+  }
+
+  /** Pack the tetra */
+  if ( mesh->adja )
+    PMMG_DEL_MEM(mesh,mesh->adja,int,"adja table");
+
+  if ( !MMG5_paktet(mesh) ) {
+    fprintf(stderr,"\n  ## Tetra packing problem. Exit program.\n");
+    goto strong_failed;
+  }
+
+  /** Update interface tetra indices in the face communicator (facesData is
+   * freed by this function) */
+  ierComm = PMMG_update_face2intInterfaceTetra(parmesh,igrp,facesData,permNodGlob);
+  facesData = NULL;
+  if ( !ierComm ) {
+    fprintf(stderr,"\n  ## Interface tetra updating problem. Exit program.\n");
+    goto strong_failed;
+  }
+
+#ifdef USE_SCOTCH
+  /** Update nodal communicators if node renumbering is enabled */
+  if ( mesh->info.renum &&
+       !PMMG_update_node2intRnbg(&parmesh->listgrp[igrp],permNodGlob) ) {
+    fprintf(stderr,"\n  ## Nodal communicator updating problem. Exit program.\n");
+    goto strong_failed;
+  }
+#endif
+
+  if ( !MMG5_unscaleMesh(mesh,met,NULL) ) { goto strong_failed; }
+
+  /* Background groups are not stored if there is nothing to interpolate */
+  if ( parmesh->old_listgrp ) {
+    oldGrp = &parmesh->old_listgrp[igrp];
+    if ( !PMMG_copyMetricsAndFields_point( mesh,oldGrp->mesh,met,oldGrp->met,
+                                           field,oldGrp->field,
+                                           permNodGlob,parmesh->info.inputMet) ) {
+      goto strong_failed;
+    }
+  }
+
+  PMMG_DEL_MEM(mesh,permNodGlob,int,"node permutation");
+
+  if ( !ier ) {
+    return PMMG_LOWFAILURE;
+  }
+
+  /* Reset the mesh->gap field in case Mmg have modified it */
+  mesh->gap = MMG5_GAP;
+
+  return PMMG_SUCCESS;
+
+strong_failed:
+  PMMG_DEL_MEM(mesh,facesData,int,"facesData");
+  PMMG_DEL_MEM(mesh,permNodGlob,int,"node permutation");
+  return PMMG_STRONGFAILURE;
+}
+
+/**
+ * \param parmesh pointer toward a parmesh structure
+ * \param warnScotch pointer toward the flag storing if a scotch warning has
+ * been printed
+ * \param stats pointer toward the remeshing times of the groups (to fill)
+ *
+ * \return PMMG_SUCCESS if success, PMMG_LOWFAILURE if we are not able to remesh
+ * one of the groups but the mesh is conform, PMMG_STRONGFAILURE if the mesh is
+ * non conform.
+ *
+ * Remesh the groups of the process. If ParMmg is compiled with OpenMP and more
+ * than one thread is asked, independent groups are remeshed concurrently, each
+ * group being allowed to use a share of the memory available for the process.
+ *
+ * \remark The concurrent remeshing relies on the Mmg remesher working only on
+ * the data of its mesh and metric: the global function pointers of Mmg are
+ * set by MMG3D_setfunc before the remeshing loop and only read by the threads,
+ * and the Mmg static variables are warning flags (at worst a warning is
+ * printed twice). Scotch is not assumed to be reentrant: the renumbering of
+ * the groups is serialized.
+ *
+ */
+static
+int PMMG_remesh_grps( PMMG_pParMesh parmesh,int8_t *warnScotch,
+                      PMMG_remeshStats *stats ) {
+  double t0,t,n,ngrp,sn,st,snn,snt;
+  int    ret,ret_grp,i,nthreads;
+
+  ret      = PMMG_SUCCESS;
+  nthreads = 1;
+
+  ngrp = sn = st = snn = snt = 0.;
+  t0   = PMMG_wtime();
+
+  /* Give the scratch memory of the previous steps back to the groups */
+  PMMG_arena_trim( parmesh );
+
+#ifdef USE_OPENMP
+  nthreads = MG_MIN(parmesh->info.nthreads,parmesh->ngrp);
+  if ( nthreads > 1 && !PMMG_parmesh_ShareMemMax(parmesh) ) {
+    /* Not enough memory to remesh groups concurrently */
+    nthreads = 1;
+  }
+#endif
+
+#ifdef USE_OPENMP
+#pragma omp parallel for private(ret_grp,t,n) reduction(+:ngrp,sn,st,snn,snt) schedule(dynamic,1) num_threads(nthreads) if(nthreads>1)
+#endif
+  for ( i=0; i<parmesh->ngrp; ++i ) {
+
+    /* Stop remeshing once a group has failed */
+#ifdef USE_OPENMP
+#pragma omp critical (PMMG_remesh_grps_status)
+#endif
+    ret_grp = ret;
+
+    if ( ret_grp != PMMG_SUCCESS ) continue;
+
+    /* The groups are built with the tuned size before their remeshing: the
+     * time of a group is sampled against its input size */
+    n       = (double)parmesh->listgrp[i].mesh->ne;
+    t       = PMMG_wtime();
+    ret_grp = PMMG_remesh_grp( parmesh,i,warnScotch );
+    t       = PMMG_wtime() - t;
+
+    /* Sample the groups that have been remeshed */
+    if ( ret_grp == PMMG_SUCCESS && !parmesh->listgrp[i].isAdapted && n > 0. ) {
+      ngrp += 1.;
+      sn   += n;
+      st   += t;
+      snn  += n*n;
+      snt  += n*t;
+    }
+
+    if ( ret_grp != PMMG_SUCCESS ) {
+#ifdef USE_OPENMP
+#pragma omp critical (PMMG_remesh_grps_status)
+#endif
+      ret = MG_MAX(ret,ret_grp);
+    }
+  }
+
+  if ( nthreads > 1 ) {
+    /* Restore the default maximal memory of the groups */
+    PMMG_parmesh_SetMemMax(parmesh);
+  }
+
+  stats->ngrp  = ngrp;
+  stats->sn    = sn;
+  stats->st    = st;
+  stats->snn   = snn;
+  stats->snt   = snt;
+  stats->wtime = PMMG_wtime() - t0;
+
+  return ret;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * Print the number of groups that have not been remeshed at current iteration
+ * because they were already adapted.
+ *
+ */
+static
+void PMMG_print_adaptedGrps( PMMG_pParMesh parmesh ) {
+  int cnt[2],cnt_result[2],i;
+
+  cnt[0] = 0;
+  cnt[1] = parmesh->ngrp;
+  for ( i=0; i<parmesh->ngrp; ++i ) {
+    cnt[0] += parmesh->listgrp[i].isAdapted;
+  }
+
+  MPI_Reduce( cnt,cnt_result,2,MPI_INT,MPI_SUM,parmesh->info.root,parmesh->comm );
+
+  if ( parmesh->myrank == parmesh->info.root ) {
+    fprintf(stdout,"       %d/%d already adapted groups not remeshed\n",
+            cnt_result[0],cnt_result[1]);
+  }
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * \return 1 if success, 0 if the convergence criteria can't be computed.
+ *
+ * Adaptive number of iterations: end the remeshing at the current iteration if
+ * the adaptation has converged (few unadapted edges and no bad elements), and
+ * add an iteration (up to \a info.niter_max) at the last one if the interfaces
+ * frozen during the remeshing still hold unadapted edges. The number of
+ * iterations is updated before the load balancing step so the output load
+ * balancing is performed at the last iteration.
+ *
+ */
+int PMMG_update_niter( PMMG_pParMesh parmesh ) {
+  double lenOut,lenOutIfc,qmin;
+  int    converged,ifcConverged;
+
+  /* The metric must be interpolated between two iterations */
+  if ( parmesh->info.inputMet != 1 ) return 1;
+
+  if ( !PMMG_convergenceStats(parmesh,&lenOut,&lenOutIfc,&qmin) ) return 0;
+
+  ifcConverged = ( lenOutIfc <= parmesh->info.conv_length );
+  converged    = ( lenOut <= parmesh->info.conv_length ) && ifcConverged &&
+    ( qmin >= parmesh->info.conv_qual );
+
+  if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
+    fprintf(stdout,"       unadapted edges %6.2f%% (interfaces %6.2f%%),"
+            " worst quality %8.6f\n",100.*lenOut,100.*lenOutIfc,qmin);
+  }
+
+  if ( converged ) {
+    if ( parmesh->iter < parmesh->niter-1 && parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
+      fprintf(stdout,"       adaptation converged: last iteration\n");
+    }
+    parmesh->niter = parmesh->iter+1;
+  }
+  else if ( parmesh->iter == parmesh->niter-1 && !ifcConverged &&
+            parmesh->niter < parmesh->info.niter_max ) {
+    if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
+      fprintf(stdout,"       unadapted interfaces: one more iteration\n");
+    }
+    ++parmesh->niter;
+  }
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param stats pointer toward the remeshing times of the groups of the process.
+ *
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Auto-tuning of the groups size and of the metis ratio for the next iteration
+ * from the remeshing times of the current one (collective function):
+ *   - the remeshing time of a group is modelled as \f$ t = a + b n \f$ (fixed
+ * cost of a group and cost per tetra, \a n being the number of tetra of the
+ * group before its remeshing, i.e. the size the groups are split to) by a
+ * least-squares fit over the groups of all the processes. The target groups size is the one for which the fixed cost
+ * is PMMG_TUNE_OVERHEAD of the remeshing time, without leaving threads idle.
+ *   - the number of metis nodes per group is doubled if the remeshing time of
+ * the processes is unbalanced by more than PMMG_TUNE_IMBALANCE, and halved if
+ * the remeshing is well balanced (cheaper graph partitioning).
+ *
+ * The sign of the parameters (default or user values) is preserved.
+ *
+ */
+static
+int PMMG_tune_grpsSize( PMMG_pParMesh parmesh,PMMG_remeshStats *stats ) {
+  double loc[7],glo[7],wmax,det,a,b,nmean,nopt,imb;
+  int    nthreads,size,ratio,k;
+
+  nthreads = 1;
+#ifdef USE_OPENMP
+  nthreads = MG_MAX(parmesh->info.nthreads,1);
+#endif
+
+  loc[0] = stats->ngrp;
+  loc[1] = stats->sn;
+  loc[2] = stats->st;
+  loc[3] = stats->snn;
+  loc[4] = stats->snt;
+  loc[5] = stats->wtime;
+  loc[6] = 0.;
+  for ( k=0; k<parmesh->ngrp; ++k ) {
+    if ( parmesh->listgrp[k].mesh ) loc[6] += parmesh->listgrp[k].mesh->ne;
+  }
+
+  MPI_CHECK( MPI_Allreduce(loc,glo,7,MPI_DOUBLE,MPI_SUM,parmesh->comm),
+             return 0 );
+  MPI_CHECK( MPI_Allreduce(&stats->wtime,&wmax,1,MPI_DOUBLE,MPI_MAX,parmesh->comm),
+             return 0 );
+
+  /** Groups size: skipped if the groups sizes are too close to fit the model */
+  size = parmesh->info.target_mesh_size;
+  if ( glo[0] >= 2. ) {
+    nmean = glo[1]/glo[0];
+    det   = glo[0]*glo[3] - glo[1]*glo[1];
+
+    if ( det > PMMG_TUNE_SPREAD*glo[1]*glo[1] ) {
+      b = ( glo[0]*glo[4] - glo[1]*glo[2] ) / det;
+      a = ( glo[2] - b*glo[1] ) / glo[0];
+
+      if ( a > 0. && b > 0. ) {
+        nopt = a / (b*PMMG_TUNE_OVERHEAD);
+
+        /* Limit the change from the current groups size */
+        nopt = MG_MIN( nopt,PMMG_TUNE_FACTOR*nmean );
+        nopt = MG_MAX( nopt,nmean/PMMG_TUNE_FACTOR );
+
+        /* Leave at least one group to each thread */
+        nopt = MG_MIN( nopt,glo[6]/(parmesh->nprocs*nthreads) );
+        nopt = MG_MAX( nopt,(double)PMMG_TUNE_NELEM_MIN );
+        nopt = MG_MIN( nopt,(double)INT_MAX );
+
+        size = ( parmesh->info.target_mesh_size < 0 ) ? -(int)nopt : (int)nopt;
+      }
+    }
+  }
+
+  /** Metis ratio */
+  ratio = MG_MAX( abs(parmesh->info.metis_ratio),1 );
+  imb   = ( glo[5] > 0. ) ? wmax*parmesh->nprocs/glo[5] : 1.;
+  if ( imb > PMMG_TUNE_IMBALANCE ) {
+    ratio = MG_MIN( 2*ratio,PMMG_REDISTR_NGRPS_MAX );
+  }
+  else if ( imb < 1. + 0.25*(PMMG_TUNE_IMBALANCE-1.) ) {
+    ratio = MG_MAX( ratio/2,1 );
+  }
+  if ( parmesh->info.metis_ratio < 0 ) ratio = -ratio;
+
+  if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
+    fprintf(stdout,"       auto-tuning: remeshing imbalance %.2f, groups size"
+            " %d, metis ratio %d\n",imb,abs(size),abs(ratio));
+  }
+
+  parmesh->info.target_mesh_size = size;
+  parmesh->info.metis_ratio      = ratio;
+
+  return 1;
+}
+
 /**
  * \param parmesh pointer toward a parmesh structure where the boundary entities
  * are stored into xtetra and xpoint strucutres
@@ -550,16 +1062,18 @@ int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
 int PMMG_parmmglib1( PMMG_pParMesh parmesh )
 {
   MMG5_pMesh mesh;
-  MMG5_pSol  met,field,psl;
+  MMG5_pSol  met;
+  PMMG_remeshStats stats;
   mytime     ctim[TIMEMAX];
-  int        ier,ier_end,ieresult,i,k,is,*facesData,*permNodGlob;
+  int        ier,ier_end,ieresult,i,*permNodGlob,niter;
   int8_t     tim,warnScotch;
   char       stim[32];
   uint8_t    inputMet;
 
   tminit(ctim,TIMEMAX);
 
-  ier_end = PMMG_SUCCESS;
+  ier_end     = PMMG_SUCCESS;
+  permNodGlob = NULL;
 
   assert ( parmesh->ngrp >= 1 );
   assert ( parmesh->listgrp[0].mesh );
@@ -594,8 +1108,10 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
   }
 
   if ( ier ) {
+    PMMG_trace_begin( parmesh,PMMG_TRACE_split );
     ier = PMMG_splitPart_grps( parmesh,PMMG_GRPSPL_MMG_TARGET,0,
                                PMMG_REDISTRIBUTION_graph_balancing );
+    PMMG_trace_end( parmesh,PMMG_TRACE_split );
   }
 
   MPI_CHECK ( MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm ),
@@ -631,8 +1147,10 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
     /* if ( !MMG3D_analys(mesh) ) { PMMG_CLEAN_AND_RETURN(parmesh,PMMG_STRONGFAILURE); } */
   }
 
-  /** Mesh adaptation */
+  /** Mesh adaptation (the number of iterations may be updated in the adaptive
+   * iterations mode) */
   warnScotch = 0;
+  niter      = parmesh->niter;
   for ( parmesh->iter = 0; parmesh->iter < parmesh->niter; parmesh->iter++ ) {
     if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
       tim = 1;
@@ -659,161 +1177,24 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
       chrono(ON,&(ctim[tim]));
     }
 
-    for ( i=0; i<parmesh->ngrp; ++i ) {
-      mesh         = parmesh->listgrp[i].mesh;
-      met          = parmesh->listgrp[i].met;
-      field        = parmesh->listgrp[i].field;
-
-#ifdef USE_POINTMAP
-      for( k = 1; k <= mesh->np; k++ )
-        mesh->point[k].src = k;
-#endif
-
-      /* Reset the value of the fem mode */
-      mesh->info.fem = parmesh->info.fem;
-
-      if ( (!mesh->np) && (!mesh->ne) ) {
-        /* Empty mesh */
-        continue;
-      }
-
-      /** Store the vertices of interface faces in the internal communicator */
-      if ( !(ier = PMMG_store_faceVerticesInIntComm(parmesh,i,&facesData) ) ) {
-        /* We are not able to remesh */
-        fprintf(stderr,"\n  ## Interface faces storage problem."
-                " Exit program.\n");
-        break;
-      }
-      else {
-        /* We can remesh */
-
-        permNodGlob = NULL;
-
-#ifdef USE_SCOTCH
-        /* Allocation of the array that will store the node permutation */
-        PMMG_MALLOC(parmesh,permNodGlob,mesh->np+1,int,"node permutation",
-                    PMMG_scotch_message(&warnScotch) );
-        if ( permNodGlob ) {
-          for ( k=1; k<=mesh->np; ++k ) {
-            permNodGlob[k] = k;
-          }
-          for ( k=1; k<=mesh->npi; ++k ) {
-            assert  ( permNodGlob[k] >0 );
-          }
-
-        }
-
-        /* renumerotation if available: no need to renum the field here (they
-         * will be interpolated) */
-        assert ( mesh->npi==mesh->np );
-        if ( permNodGlob ) {
-          if ( !MMG5_scotchCall(mesh,met,NULL,permNodGlob) )
-          {
-            PMMG_scotch_message(&warnScotch);
-          }
-        }
-#endif
-
-        /* Mark reinitialisation in order to be able to remesh all the mesh */
-        mesh->mark = 0;
-        mesh->base = 0;
-        for ( k=1 ; k<=mesh->nemax ; k++ ) {
-          mesh->tetra[k].mark = mesh->mark;
-          mesh->tetra[k].flag = mesh->base;
-        }
-
-        /** Call the remesher */
-        /* Here we need to scale the mesh */
-        if ( !MMG5_scaleMesh(mesh,met,NULL) ) { goto strong_failed; }
-
-        if ( !mesh->adja ) {
-          if ( !MMG3D_hashTetra(mesh,0) ) {
-            fprintf(stderr,"\n  ## Hashing problem. Exit program.\n");
-            goto strong_failed;
-          }
-        }
-
-#ifdef PATTERN
-        ier = MMG5_mmg3d1_pattern( mesh, met, permNodGlob );
-#else
-        ier = MMG5_mmg3d1_delone( mesh, met, permNodGlob );
-#endif
-        mesh->npi = mesh->np;
-        mesh->nei = mesh->ne;
-
-        if ( !ier ) {
-          fprintf(stderr,"\n  ## MMG remeshing problem. Exit program.\n");
-        }
-
-        /* Realloc the solution fields at the same size than other structures */
-        if ( mesh->nsols ) {
-          for ( is=0; is<mesh->nsols; ++is ) {
-            psl    = field + is;
-            assert ( psl && psl->m );
-            PMMG_REALLOC(mesh,psl->m,psl->size*(mesh->npmax+1),
-                         psl->size*(psl->npmax+1),double,
-                         "field array",goto strong_failed);
-            psl->npmax = mesh->npmax;
-          }
-        }
-
-        if ( parmesh->iter < parmesh->niter-1 && (!parmesh->info.inputMet) ) {
-          /* Delete the metrec computed by Mmg except at last iter */
-          PMMG_DEL_MEM(mesh,met->m,double,"internal metric");
-        }
-
-        /** Pack the tetra */
-        if ( mesh->adja )
-          PMMG_DEL_MEM(mesh,mesh->adja,int,"adja table");
-
-        if ( !MMG5_paktet(mesh) ) {
-          fprintf(stderr,"\n  ## Tetra packing problem. Exit program.\n");
-          goto strong_failed;
-        }
-
-        /** Update interface tetra indices in the face communicator */
-        if ( ! PMMG_update_face2intInterfaceTetra(parmesh,i,facesData,permNodGlob) ) {
-          fprintf(stderr,"\n  ## Interface tetra updating problem. Exit program.\n");
-          goto strong_failed;
-        }
-
-
-#ifdef USE_SCOTCH
-        /** Update nodal communicators if node renumbering is enabled */
-        if ( mesh->info.renum &&
-             !PMMG_update_node2intRnbg(&parmesh->listgrp[i],permNodGlob) ) {
-          fprintf(stderr,"\n  ## Nodal communicator updating problem. Exit program.\n");
-          goto strong_failed;
-        }
-#endif
-
-        if ( !MMG5_unscaleMesh(mesh,met,NULL) ) { goto strong_failed; }
-
-        if ( !PMMG_copyMetricsAndFields_point( parmesh->listgrp[i].mesh,
-                                               parmesh->old_listgrp[i].mesh,
-                                               parmesh->listgrp[i].met,
-                                               parmesh->old_listgrp[i].met,
-                                               parmesh->listgrp[i].field,
-                                               parmesh->old_listgrp[i].field,
-                                               permNodGlob,parmesh->info.inputMet) ) {
-          goto strong_failed;
-        }
-
-        if ( !ier ) { break; }
-      }
-      /* Reset the mesh->gap field in case Mmg have modified it */
-      mesh->gap = MMG5_GAP;
-
-#ifdef USE_SCOTCH
-      PMMG_DEL_MEM(parmesh,permNodGlob,int,"node permutation");
-#endif
+    PMMG_trace_begin( parmesh,PMMG_TRACE_mmg );
+    ier = PMMG_remesh_grps( parmesh,&warnScotch,&stats );
+    PMMG_trace_end( parmesh,PMMG_TRACE_mmg );
+    if ( ier == PMMG_STRONGFAILURE ) {
+      ier = 0;
+      goto strong_failed;
     }
+    ier = ( ier == PMMG_SUCCESS );
 
     MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
     if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
       chrono(OFF,&(ctim[tim]));
       printim(ctim[tim].gdif,stim);
       fprintf(stdout,"\n       mmg                               %s\n",stim);
+
+      if ( parmesh->info.skip_adapted ) {
+        PMMG_print_adaptedGrps( parmesh );
+      }
     }
 
     if ( !ieresult )
@@ -826,7 +1207,9 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
       chrono(ON,&(ctim[tim]));
     }
 
+    PMMG_trace_begin( parmesh,PMMG_TRACE_interp );
     ier = PMMG_interpMetricsAndFields( parmesh, permNodGlob );
+    PMMG_trace_end( parmesh,PMMG_TRACE_interp );
 
     MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
     if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
@@ -841,9 +1224,30 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
       PMMG_CLEAN_AND_RETURN(parmesh,PMMG_STRONGFAILURE);
     }
 
+    /* The background groups are not needed anymore: release them before the
+     * load balancing */
+    PMMG_free_oldGrps( parmesh );
+
     /* Compute quality in the interpolated metrics */
     ier = PMMG_tetraQual( parmesh,1 );
 
+    /** Adaptive number of iterations */
+    if ( parmesh->info.adaptive_niter ) {
+      if ( !PMMG_update_niter( parmesh ) ) {
+        if ( !parmesh->myrank )
+          fprintf(stderr,"\n  ## Warning: unable to check the adaptation"
+                  " convergence.\n");
+      }
+    }
+
+    /** Auto-tuning of the groups size for the next iteration */
+    if ( parmesh->info.auto_tune && parmesh->iter < parmesh->niter-1 ) {
+      if ( !PMMG_tune_grpsSize( parmesh,&stats ) ) {
+        if ( !parmesh->myrank )
+          fprintf(stderr,"\n  ## Warning: unable to tune the groups size.\n");
+      }
+    }
+
     /** load Balancing at group scale and communicators reconstruction */
     tim = 3;
     if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
@@ -851,6 +1255,7 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
       chrono(ON,&(ctim[tim]));
     }
 
+    PMMG_trace_begin( parmesh,PMMG_TRACE_loadBalancing );
     if ( parmesh->iter == parmesh->niter-1 ) {
 
       if ( !parmesh->info.nobalancing ) {
@@ -871,6 +1276,7 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
       /** Standard parallel mesh repartitioning */
       ier = PMMG_loadBalancing(parmesh);
     }
+    PMMG_trace_end( parmesh,PMMG_TRACE_loadBalancing );
 
 
     MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
@@ -890,10 +1296,25 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
       PMMG_CLEAN_AND_RETURN(parmesh,PMMG_STRONGFAILURE);
     }
 
+    /** Check the communicators of the new partition */
+    if ( parmesh->info.check_comm && !PMMG_check_comms(parmesh) ) {
+      if ( !parmesh->myrank )
+        fprintf(stderr,"\n  ## Inconsistent communicators. Exit program.\n");
+      ier = 0;
+      goto strong_failed;
+    }
+
     /** update geometric analysis */
-    if( !PMMG_update_analys(parmesh) )
+    PMMG_trace_begin( parmesh,PMMG_TRACE_analys );
+    ier = PMMG_update_analys(parmesh);
+    PMMG_trace_end( parmesh,PMMG_TRACE_analys );
+    if( !ier )
       PMMG_CLEAN_AND_RETURN(parmesh,PMMG_LOWFAILURE);
+
+    /** Load imbalance of the iteration phases */
+    PMMG_trace_balance( parmesh );
   }
+  parmesh->niter = niter;
 
   if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
     printf("\n");
@@ -919,7 +1340,9 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
     chrono(ON,&(ctim[tim]));
     }
 
+  PMMG_trace_begin( parmesh,PMMG_TRACE_pack );
   ier = PMMG_packParMesh(parmesh);
+  PMMG_trace_end( parmesh,PMMG_TRACE_pack );
   MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
   if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
     chrono(OFF,&(ctim[tim]));
@@ -932,14 +1355,16 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
     PMMG_CLEAN_AND_RETURN(parmesh,PMMG_STRONGFAILURE);
   }
 
-  PMMG_listgrp_free( parmesh, &parmesh->old_listgrp, parmesh->nold_grp);
+  PMMG_free_oldGrps( parmesh );
 
   if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
     tim = 5;
     chrono(ON,&(ctim[tim]));
   }
 
+  PMMG_trace_begin( parmesh,PMMG_TRACE_merge );
   ier = PMMG_merge_grps(parmesh,0);
+  PMMG_trace_end( parmesh,PMMG_TRACE_merge );
   MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
 
   if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
@@ -968,10 +1393,12 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
 
   /** mmg3d1_delone failure */
 strong_failed:
+  parmesh->niter = niter;
   MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
   PMMG_CLEAN_AND_RETURN(parmesh,PMMG_STRONGFAILURE);
 
 failed_handling:
+  parmesh->niter = niter;
   if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
     tim = 4;
     chrono(ON,&(ctim[tim]));
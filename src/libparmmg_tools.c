@@ -74,13 +74,23 @@ int PMMG_defaultValues( PMMG_pParMesh parmesh )
             parmesh->memGloMax/MMG5_MILLION);
     fprintf(stdout,"\n** Parameters\n");
     fprintf( stdout,"# of remeshing iterations (-niter)        : %d\n",parmesh->niter);
+    fprintf( stdout,"max # of adaptive iterations (-niter-max) : %d\n",parmesh->info.niter_max);
+    fprintf( stdout,"unadapted edges at convergence (-conv-length) : %f\n",parmesh->info.conv_length);
+    fprintf( stdout,"element quality at convergence (-conv-qual)   : %f\n",parmesh->info.conv_qual);
     fprintf( stdout,"repartitioning mode                       : PMMG_REDISTRIBUTION_ifc_displacement\n");
-//    fprintf( stdout,"loadbalancing_mode (not yet customizable) : PMMG_LOADBALANCING_metis\n");
+    fprintf( stdout,"partitioner (-lb)                         : %s\n",
+             parmesh->info.loadbalancing_mode == PMMG_LOADBALANCING_sfc ? "sfc" :
+             (parmesh->info.loadbalancing_mode == PMMG_LOADBALANCING_parmetis ?
+              "parmetis" : "metis") );
 //    fprintf( stdout,"target mesh size for Mmg (-mesh-size) : %d\n",abs(PMMG_REMESHER_TARGET_MESH_SIZE));
 //    fprintf( stdout,"ratio: # meshes / # metis super nodes (-metis-ratio) : %d\n",abs(PMMG_RATIO_MMG_METIS) );
     fprintf( stdout,"# of layers for interface displacement (-nlayers) : %d\n",PMMG_MVIFCS_NLAYERS);
     fprintf( stdout,"allowed imbalance between current and desired groups size (-groups-ratio) : %f\n",PMMG_GRPS_RATIO);
 
+#ifdef USE_OPENMP
+    fprintf( stdout,"# of threads for groups remeshing and interpolation (-nthreads) : %d\n",parmesh->info.nthreads);
+#endif
+
 #ifdef USE_SCOTCH
     fprintf(stdout,"SCOTCH renumbering                  : enabled\n");
 #else
@@ -121,14 +131,37 @@ int PMMG_usage( PMMG_pParMesh parmesh, char * const prog )
     fprintf(stdout,"-sol   file  load level-set, displacement or metric file\n");
     fprintf(stdout,"-field file  load sol field to interpolate from init onto final mesh\n");
     fprintf(stdout,"-noout       do not write output triangulation\n");
+    fprintf(stdout,"-parallel-input  read the (binary) input mesh and metric on all the processes\n");
+    fprintf(stdout,"-parallel-output write the (binary) output mesh and metric from all the processes\n");
+    fprintf(stdout,"-trace file  write per-rank and per-phase timings (Chrome trace format)\n");
 
     fprintf(stdout,"\n**  Parameters\n");
     fprintf(stdout,"-niter        val  number of remeshing iterations\n");
+    fprintf(stdout,"-adaptive-niter    stop the iterations when the adaptation has converged\n");
+    fprintf(stdout,"-niter-max    val  maximal number of iterations with unadapted interfaces (-adaptive-niter)\n");
+    fprintf(stdout,"-conv-length  val  max fraction of edges of length out of [0.7,1.4] at convergence\n");
+    fprintf(stdout,"-conv-qual    val  minimal element quality at convergence\n");
+    fprintf(stdout,"-skip-adapted      don't remesh the groups that are already adapted\n");
+    fprintf(stdout,"-check-comm        check the parallel communicators after each redistribution\n");
     fprintf(stdout,"-mesh-size    val  target mesh size for the remesher\n");
+    fprintf(stdout,"-auto-tune         tune the groups size and the metis ratio at each iteration\n");
+    fprintf(stdout,"-sfc-renum   [1/0] renumber the groups along a space filling curve (default 1,\n"
+            "                   unused with the SCOTCH renumbering)\n");
     fprintf(stdout,"-metis-ratio  val  number of metis super nodes per mesh\n");
     fprintf(stdout,"-nlayers      val  number of layers for interface displacement\n");
     fprintf(stdout,"-groups-ratio val  allowed imbalance between current and desired groups size\n");
     fprintf(stdout,"-nobalance         switch off load balancing of the output mesh\n");
+    fprintf(stdout,"-work-wgt          balance the predicted remeshing work instead of the elements\n");
+#ifdef USE_PARMETIS
+    fprintf(stdout,"-lb [metis|parmetis|sfc] partitioner (sfc: space filling curve, no graph)\n");
+    fprintf(stdout,"-itr          val  parmetis adaptive repartitioning from the current partition\n"
+            "                   (communication/migration cost ratio, 0: new partition)\n");
+#else
+    fprintf(stdout,"-lb [metis|sfc]    partitioner (sfc: space filling curve, no graph)\n");
+#endif
+#ifdef USE_OPENMP
+    fprintf(stdout,"-nthreads     val  number of threads used to remesh and interpolate the groups of a process\n");
+#endif
 
     //fprintf(stdout,"-ar     val  angle detection\n");
     //fprintf(stdout,"-nr          no angle detection\n");
@@ -210,6 +243,27 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
   while ( i < argc ) {
     if ( *argv[i] == '-' ) {
       switch( argv[i][1] ) {
+      case 'a':
+        if ( !strcmp(argv[i],"-adaptive-niter") ) {
+          /* stop the iterations at convergence */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_adaptiveNiter,1) )  {
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+        else if ( !strcmp(argv[i],"-auto-tune") ) {
+          /* tune the groups size from the measured remeshing times */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_autoTune,1) )  {
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+        else {
+          ARGV_APPEND(parmesh, argv, mmgArgv, i, mmgArgc,
+                      " adding to mmgArgv for mmg: ",
+                      ret_val = 0; goto fail_proc );
+        }
+        break;
       case 'c':
         if ( !strcmp(argv[i],"-centralized-output") ) {
           /* force centralized output: only relevant using medit distributed
@@ -219,6 +273,30 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
             goto fail_proc;
           }
         }
+        else if ( !strcmp(argv[i],"-check-comm") ) {
+          /* check the communicators after each redistribution */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_checkComm,1) )  {
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+        else if ( !strcmp(argv[i],"-conv-length") || !strcmp(argv[i],"-conv-qual") ) {
+          /* convergence criteria of the adaptive iterations */
+          if ( ++i < argc && (isdigit(argv[i][0]) || argv[i][0]=='.') ) {
+            if ( !PMMG_Set_dparameter(parmesh,
+                                      strcmp(argv[i-1],"-conv-qual") ?
+                                      PMMG_DPARAM_convLength : PMMG_DPARAM_convQuality,
+                                      atof(argv[i])) ) {
+              ret_val = 0;
+              goto fail_proc;
+            }
+          }
+          else {
+            fprintf( stderr, "\nMissing argument option %s\n", argv[i-1] );
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
         else {
           ARGV_APPEND(parmesh, argv, mmgArgv, i, mmgArgc,
                       " adding to mmgArgv for mmg: ",
@@ -295,6 +373,64 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
         }
         break;
 
+      case 'i':
+        if ( !strcmp(argv[i],"-itr") ) {
+          /* parmetis adaptive repartitioning */
+          if ( ++i < argc && (isdigit(argv[i][0]) || argv[i][0]=='.') ) {
+            if ( !PMMG_Set_dparameter(parmesh,PMMG_DPARAM_itrRatio,atof(argv[i])) ) {
+              ret_val = 0;
+              goto fail_proc;
+            }
+          }
+          else {
+            fprintf( stderr, "\nMissing argument option %s\n", argv[i-1] );
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+        else {
+          ARGV_APPEND(parmesh, argv, mmgArgv, i, mmgArgc,
+                      " adding to mmgArgv for mmg: ",
+                      ret_val = 0; goto fail_proc );
+        }
+        break;
+
+      case 'l':
+        if ( !strcmp(argv[i],"-lb") ) {
+          /* partitioner of the meshes */
+          if ( ++i < argc ) {
+            if ( !strcmp(argv[i],"metis") ) {
+              val = PMMG_LOADBALANCING_metis;
+            }
+            else if ( !strcmp(argv[i],"parmetis") ) {
+              val = PMMG_LOADBALANCING_parmetis;
+            }
+            else if ( !strcmp(argv[i],"sfc") ) {
+              val = PMMG_LOADBALANCING_sfc;
+            }
+            else {
+              fprintf(stderr,"\nUnknown partitioner %s\n",argv[i]);
+              ret_val = 0;
+              goto fail_proc;
+            }
+            if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_loadBalancingMode,val) ) {
+              ret_val = 0;
+              goto fail_proc;
+            }
+          }
+          else {
+            fprintf( stderr, "\nMissing argument option %s\n", argv[i-1] );
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+        else {
+          ARGV_APPEND(parmesh, argv, mmgArgv, i, mmgArgc,
+                      " adding to mmgArgv for mmg: ",
+                      ret_val = 0; goto fail_proc );
+        }
+        break;
+
       case 'm':
         if ( !strcmp(argv[i],"-mmg-v") ) {
 
@@ -402,7 +538,21 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
         break;
 
       case 'n':  /* number of adaptation iterations */
-        if ( ( 0 == strncmp( argv[i], "-niter", 5 ) ) && ( ( i + 1 ) < argc ) ) {
+        if ( !strcmp( argv[i], "-niter-max" ) && ( ( i + 1 ) < argc ) ) {
+          ++i;
+          if ( isdigit( argv[i][0] ) && ( atoi( argv[i] ) >= 0 ) ) {
+            if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_niterMax,atoi(argv[i])) ) {
+              ret_val = 0;
+              goto fail_proc;
+            }
+          } else {
+            fprintf( stderr,
+                     "\nWrong maximal number of adaptation iterations (%s).\n",argv[i]);
+
+            ret_val = 0;
+            goto fail_proc;
+          }
+        } else if ( ( 0 == strncmp( argv[i], "-niter", 5 ) ) && ( ( i + 1 ) < argc ) ) {
           ++i;
           if ( isdigit( argv[i][0] ) && ( atoi( argv[i] ) >= 0 ) ) {
             parmesh->niter = atoi( argv[i] );
@@ -423,6 +573,20 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
             fprintf( stderr,
                      "\nWrong number of layers for interface displacement (%s).\n",argv[i]);
 
+            ret_val = 0;
+            goto fail_proc;
+          }
+        } else if ( ( 0 == strcmp( argv[i], "-nthreads" ) ) && ( ( i + 1 ) < argc ) ) {
+          ++i;
+          if ( isdigit( argv[i][0] ) && ( atoi( argv[i] ) > 0 ) ) {
+            if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_nthreads,atoi(argv[i])) ) {
+              ret_val = 0;
+              goto fail_proc;
+            }
+          } else {
+            fprintf( stderr,
+                     "\nWrong number of threads (%s).\n",argv[i]);
+
             ret_val = 0;
             goto fail_proc;
           }
@@ -442,6 +606,42 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
         }
         break;
 
+      case 'w':
+        if ( !strcmp(argv[i],"-work-wgt") ) {
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_workWgt,1) )  {
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+        else {
+          ARGV_APPEND(parmesh, argv, mmgArgv, i, mmgArgc,
+                      " adding to mmgArgv for mmg: ",
+                      ret_val = 0; goto fail_proc );
+        }
+        break;
+
+      case 'p':
+        if ( !strcmp(argv[i],"-parallel-input") ) {
+          /* read a centralized binary medit mesh on all the processes */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_parallelInput,1) )  {
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+        else if ( !strcmp(argv[i],"-parallel-output") ) {
+          /* write a centralized binary medit mesh from all the processes */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_parallelOutput,1) )  {
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+        else {
+          ARGV_APPEND(parmesh, argv, mmgArgv, i, mmgArgc,
+                      " adding to mmgArgv for mmg: ",
+                      ret_val = 0; goto fail_proc );
+        }
+        break;
+
       case 'd':
         if ( !strcmp(argv[i],"-distributed-output") ) {
           /* force distributed output: only relevant using medit centralized
@@ -474,8 +674,50 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
         break;
 #endif
 
+      case 't':
+        if ( !strcmp(argv[i],"-trace") ) {
+          if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
+            if ( ! PMMG_Set_traceName(parmesh,argv[i]) ) {
+              ret_val = 0;
+              goto fail_mmgargv;
+            }
+          }
+          else {
+            RUN_ON_ROOT_AND_BCAST( PMMG_usage(parmesh, argv[0]),0,
+                                   parmesh->myrank,ret_val=0; goto fail_mmgargv);
+            ret_val = 0;
+            goto fail_mmgargv;
+          }
+        }
+        else {
+          ARGV_APPEND(parmesh, argv, mmgArgv, i, mmgArgc,
+                      " adding to mmgArgv for mmg: ",
+                      ret_val = 0; goto fail_proc );
+        }
+        break;
       case 's':
-        if ( 0 == strncmp( argv[i], "-surf", 4 ) ) {
+        if ( !strcmp(argv[i],"-skip-adapted") ) {
+          /* don't remesh already adapted groups */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_skipAdapted,1) )  {
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+        else if ( !strcmp(argv[i],"-sfc-renum") ) {
+          /* space filling curve renumbering of the groups */
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_sfcRenum,atoi(argv[i])) )  {
+              ret_val = 0;
+              goto fail_proc;
+            }
+          }
+          else {
+            fprintf( stderr, "\nMissing argument option %s\n", argv[i-1] );
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+        else if ( 0 == strncmp( argv[i], "-surf", 4 ) ) {
           parmesh->listgrp[0].mesh->info.nosurf = 0;
         }
         else {
@@ -209,6 +209,15 @@
  */
 #define PMMG_LOADBALANCING_parmetis 2
 
+/**
+ * \def PMMG_LOADBALANCING_sfc
+ *
+ * Use a space filling curve (Hilbert ordering of the elements barycenters) to
+ * partition the meshes without building their graph
+ *
+ */
+#define PMMG_LOADBALANCING_sfc 4
+
 /**
  * \def PMMG_APIDISTRIB_faces
  *
@@ -243,6 +252,15 @@
  */
 #define PMMG_GAP     0.2
 
+/**
+ * \def PMMG_MPIIO_CENTRALIZED
+ *
+ * Return value of \ref PMMG_loadMesh_parallel if the input data can't be read
+ * collectively and must be read by the centralized reading
+ *
+ */
+#define PMMG_MPIIO_CENTRALIZED -2
+
 /**
  * Types
  */
@@ -303,6 +321,7 @@ typedef struct {
   int*         face2int_face_comm_index1; /*!< List of interface faces (local index)*/
   int*         face2int_face_comm_index2; /*!< List of index in internal communicator (where put the interface faces)*/
   int          flag;
+  int8_t       isAdapted; /*!< 1 if the group has not been remeshed at current iteration because it is already adapted */
 } PMMG_Grp;
 typedef PMMG_Grp  * PMMG_pGrp;
 
@@ -324,9 +343,22 @@ typedef struct {
   double grps_ratio;  /*!< allowed imbalance ratio between current and demanded groups size */
   int nobalancing; /*!< switch off final load balancing */
   int loadbalancing_mode; /*!< way to perform the loadbalanding (see LOADBALANCING) */
+  double itr_ratio; /*!< parmetis adaptive repartitioning ratio (0: new partition) */
   int contiguous_mode; /*!< force/don't force partitions contiguity */
   int metis_ratio; /*!< wanted ratio between the number of meshes and the number of metis super nodes */
   int target_mesh_size; /*!< target mesh size for Mmg */
+  int nthreads; /*!< number of threads used to remesh and interpolate the groups of a process */
+  int work_wgt; /*!< weight the graph nodes by the predicted remeshing work */
+  int parallel_input; /*!< read the centralized input mesh on all the processes */
+  int adaptive_niter; /*!< stop the iterations at convergence of the adaptation */
+  int niter_max; /*!< maximal number of iterations of the adaptive iterations mode */
+  double conv_length; /*!< max fraction of unadapted edges at convergence */
+  double conv_qual; /*!< minimal element quality at convergence */
+  int skip_adapted; /*!< don't remesh the groups that are already adapted */
+  int check_comm; /*!< check the communicators after each redistribution */
+  int session; /*!< keep the parallel structures between successive library calls */
+  int auto_tune; /*!< tune the groups size from the measured remeshing times */
+  int sfc_renum; /*!< renumber the groups along a space filling curve */
   int API_mode; /*!< use faces or nodes information to build communicators */
   int globalNum; /*!< compute nodes and triangles global numbering in output */
   int fmtout; /*!< store the output format asked */
@@ -359,6 +391,7 @@ typedef struct {
   char     *lsin;
   char     *dispin;
   char     *fieldin,*fieldout;
+  char     *tracename; /*!< performance trace file (no trace if NULL) */
 
   /* grp */
   int       ngrp;       /*!< Number of grp */
@@ -380,14 +413,25 @@ typedef struct {
   int            next_face_comm; /*!< Number of external face communicator */
   PMMG_pExt_comm ext_face_comm;  /*!< External communicators (in increasing order w.r. to the remote proc index) */
 
+  /* persistent requests of the halo exchanges on the external communicators */
+  MPI_Request    *node_halo; /*!< Requests exchanging the node communicator buffers */
+  MPI_Request    *edge_halo; /*!< Requests exchanging the edge communicator buffers */
+
   /* global variables */
   int            ddebug; //! Debug level
   int            iter;   //! Current adaptation iteration
   int            niter;  //! Number of adaptation iterations
+  int8_t         session_open; //! The parmesh holds the output of the previous call of the session
 
   /* parameters of the run */
   PMMG_Info      info; /*!< \ref PMMG_Info structure */
 
+  /* performance trace */
+  struct PMMG_Trace *trace; /*!< Timings of the run phases (NULL if disabled) */
+
+  /* scratch memory */
+  struct PMMG_Arena *arena; /*!< Short-lived arrays (NULL if never used) */
+
 } PMMG_ParMesh;
 typedef PMMG_ParMesh  * PMMG_pParMesh;
 
@@ -85,7 +85,9 @@ int PMMG_loadBalancing(PMMG_pParMesh parmesh) {
 
   if ( ier ) {
     /** Split the ngrp groups of listgrp into a higher number of groups */
+    PMMG_trace_begin( parmesh,PMMG_TRACE_split );
     ier = PMMG_split_n2mGrps(parmesh,PMMG_GRPSPL_DISTR_TARGET,1);
+    PMMG_trace_end( parmesh,PMMG_TRACE_split );
   }
 
   /* There is mpi comms in distribute_grps thus we don't want that one proc
@@ -132,7 +134,9 @@ int PMMG_loadBalancing(PMMG_pParMesh parmesh) {
 
   if ( ier ) {
     /** Redistribute the ngrp groups of listgrp into a higher number of groups */
+    PMMG_trace_begin( parmesh,PMMG_TRACE_split );
     ier = PMMG_split_n2mGrps(parmesh,PMMG_GRPSPL_MMG_TARGET,0);
+    PMMG_trace_end( parmesh,PMMG_TRACE_split );
     if ( ier<=0 )
       fprintf(stderr,"\n  ## Problem when splitting into a lower number of groups.\n");
     }
@@ -91,30 +91,42 @@ int PMMG_precompute_triaNormals( MMG5_pMesh mesh,double *triaNormals ) {
 
 /**
  * \param mesh pointer to the current mesh structure.
- * \param faceAreas pointer to the array of oriented face areas.
+ * \param faceAreas pointer to the array of barycentric coefficients.
  *
  * \return 1.
  *
- *  Precompute oriented face areas on tetrahedra.
+ *  Precompute the barycentric coefficients of the tetrahedra from their
+ *  oriented face areas. The coefficients are stored by structure of arrays
+ *  (PMMG_BARYCOORD_SOA doubles per tetra): for the face \a ifac of the tetra
+ *  \a ie, faceAreas[16*ie+4*d+ifac] is the component \a d of the face area
+ *  divided by minus the tetra volume, and faceAreas[16*ie+12+ifac] is the
+ *  constant term of the barycentric coordinate.
  *
  */
 int PMMG_precompute_faceAreas( MMG5_pMesh mesh,double *faceAreas ) {
   MMG5_pTetra pt;
-  double      *normal;
-  int         ie,ifac,ia,ib,ic;
+  double      *coef,*c0,normal[3],dd;
+  int         ie,ifac,ia,ib,ic,d;
   int         ier;
 
   for( ie = 1; ie <= mesh->ne; ie++ ) {
     pt = &mesh->tetra[ie];
     /* Store tetra volume in the qual field */
     pt->qual = MMG5_orvol( mesh->point, pt->v );
-    /* Store oriented face normals */
+    dd = 1.0/pt->qual;
+    /* Store the coefficients of the oriented face normals */
+    coef = &faceAreas[PMMG_BARYCOORD_SOA*ie];
     for( ifac = 0; ifac < 4; ifac++ ) {
-      normal = &faceAreas[12*ie+3*ifac];
       ia = pt->v[MMG5_idir[ifac][0]];
       ib = pt->v[MMG5_idir[ifac][1]];
       ic = pt->v[MMG5_idir[ifac][2]];
       ier = MMG5_nonUnitNorPts( mesh,ia,ib,ic,normal );
+      c0 = mesh->point[ia].c;
+      coef[12+ifac] = 0.0;
+      for( d = 0; d < 3; d++ ) {
+        coef[4*d+ifac]  = -normal[d]*dd;
+        coef[12+ifac]  += normal[d]*c0[d]*dd;
+      }
     }
   }
 
@@ -126,9 +138,10 @@ int PMMG_precompute_faceAreas( MMG5_pMesh mesh,double *faceAreas ) {
  * \param mesh pointer to the current mesh structure.
  * \param nodeTrias double pointer to the node triangles graph.
  *
- * \return 1.
+ * \return 0 if fail, 1 otherwise.
  *
- *  Precompute node triangles graph on the surface.
+ *  Precompute node triangles graph on the surface. The graph is allocated in
+ *  the scratch arena of the parmesh.
  *
  */
 int PMMG_precompute_nodeTrias( PMMG_pParMesh parmesh,MMG5_pMesh mesh,int **nodeTrias ) {
@@ -159,7 +172,7 @@ int PMMG_precompute_nodeTrias( PMMG_pParMesh parmesh,MMG5_pMesh mesh,int **nodeT
   }
 
   /* Allocate */
-  PMMG_MALLOC( parmesh,*nodeTrias,np+3*mesh->nt,int,"nodeTrias",return 0 );
+  PMMG_ARENA_MALLOC( parmesh,*nodeTrias,np+3*mesh->nt,int,"nodeTrias",return 0 );
 
   for( ip = 2; ip <= mesh->np; ip++ )
     mesh->point[ip].tmp = mesh->point[ip-1].flag ? mesh->point[ip-1].tmp+mesh->point[ip-1].flag+1 : mesh->point[ip-1].tmp;
@@ -194,8 +207,325 @@ int PMMG_precompute_nodeTrias( PMMG_pParMesh parmesh,MMG5_pMesh mesh,int **nodeT
   return 1;
 }
 
+/**
+ * \param grid pointer to the localization grid.
+ * \param i cell index in the first direction.
+ * \param j cell index in the second direction.
+ * \param l cell index in the third direction.
+ *
+ * \return the index of the cell in the grid arrays.
+ *
+ */
+static inline
+int PMMG_locateGrid_idx( PMMG_pLocateGrid grid,int i,int j,int l ) {
+  return (l*grid->n[1] + j)*grid->n[0] + i;
+}
+
+/**
+ * \param grid pointer to the localization grid.
+ * \param c point coordinates.
+ * \param idx indices of the cell in each direction.
+ *
+ *  Compute the indices of the cell that contains a point (points outside the
+ *  grid are projected on its boundary cells).
+ *
+ */
+static inline
+void PMMG_locateGrid_cell( PMMG_pLocateGrid grid,double *c,int *idx ) {
+  double x;
+  int    d;
+
+  for( d = 0; d < 3; d++ ) {
+    x = (c[d]-grid->min[d])*grid->inv[d];
+    if( x < 0.0 )
+      idx[d] = 0;
+    else if( x >= (double)grid->n[d] )
+      idx[d] = grid->n[d]-1;
+    else
+      idx[d] = (int)x;
+  }
+}
+
+/**
+ * \param parmesh pointer to the parmesh structure.
+ * \param mesh pointer to the background mesh structure.
+ * \param grid pointer to the localization grid.
+ * \param nv number of vertices of the elements (4 for tetra, 3 for triangles).
+ * \param off pointer to the array of cell offsets to allocate and fill.
+ * \param list pointer to the array of cell elements to allocate and fill.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ *  Store in each grid cell the elements whose bounding box intersects the cell.
+ *
+ */
+static
+int PMMG_locateGrid_fill( PMMG_pParMesh parmesh,MMG5_pMesh mesh,
+                          PMMG_pLocateGrid grid,int nv,int **off,int **list ) {
+  MMG5_pPoint ppt;
+  double      bmin[3],bmax[3];
+  int         *v,imin[3],imax[3],i,j,l,d,iv,k,nelt,ncell,cell;
+
+  nelt  = ( nv == 4 ) ? mesh->ne : mesh->nt;
+
+  /* Bounded by PMMG_LOCATE_GRID_NCELL_MAX in PMMG_locateGrid_build */
+  ncell = grid->n[0]*grid->n[1]*grid->n[2];
+
+  PMMG_CALLOC( parmesh,*off,ncell+1,int,"locate grid offsets",return 0 );
+
+  /* Two passes: count the elements of each cell, then store them */
+  for( iv = 0; iv < 2; iv++ ) {
+    for( k = 1; k <= nelt; k++ ) {
+      v = ( nv == 4 ) ? mesh->tetra[k].v : mesh->tria[k].v;
+      if( v[0] <= 0 ) continue;
+
+      /* Cells intersected by the element bounding box */
+      ppt = &mesh->point[v[0]];
+      for( d = 0; d < 3; d++ )
+        bmin[d] = bmax[d] = ppt->c[d];
+      for( i = 1; i < nv; i++ ) {
+        ppt = &mesh->point[v[i]];
+        for( d = 0; d < 3; d++ ) {
+          bmin[d] = MG_MIN(bmin[d],ppt->c[d]);
+          bmax[d] = MG_MAX(bmax[d],ppt->c[d]);
+        }
+      }
+      PMMG_locateGrid_cell( grid,bmin,imin );
+      PMMG_locateGrid_cell( grid,bmax,imax );
+
+      for( l = imin[2]; l <= imax[2]; l++ ) {
+        for( j = imin[1]; j <= imax[1]; j++ ) {
+          for( i = imin[0]; i <= imax[0]; i++ ) {
+            cell = PMMG_locateGrid_idx( grid,i,j,l );
+            if( !iv )
+              (*off)[cell+1]++;
+            else
+              (*list)[(*off)[cell]++] = k;
+          }
+        }
+      }
+    }
+
+    if( !iv ) {
+      for( cell = 0; cell < ncell; cell++ )
+        (*off)[cell+1] += (*off)[cell];
+
+      PMMG_MALLOC( parmesh,*list,(*off)[ncell],int,"locate grid list",
+                   PMMG_DEL_MEM(parmesh,*off,int,"locate grid offsets");
+                   return 0 );
+    }
+  }
+
+  /* Offsets have been shifted by the filling */
+  for( cell = ncell; cell > 0; cell-- )
+    (*off)[cell] = (*off)[cell-1];
+  (*off)[0] = 0;
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer to the parmesh structure.
+ * \param mesh pointer to the background mesh structure.
+ * \param grid pointer to the localization grid to build.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ *  Build a uniform grid over the bounding box of the background mesh (with
+ *  about PMMG_LOCATE_GRID_DENSITY elements per cell) and store the tetra and
+ *  the triangles that intersect each cell.
+ *
+ */
+int PMMG_locateGrid_build( PMMG_pParMesh parmesh,MMG5_pMesh mesh,
+                           PMMG_pLocateGrid grid ) {
+  MMG5_pPoint ppt;
+  double      max[3],len[3],vol,h;
+  int64_t     ntot,nmax;
+  int         ip,d,ndim,ncell;
+
+  memset(grid,0,sizeof(PMMG_locateGrid));
+
+  /* Bounding box of the mesh */
+  for( d = 0; d < 3; d++ ) {
+    grid->min[d] =  DBL_MAX;
+    max[d]       = -DBL_MAX;
+  }
+  for( ip = 1; ip <= mesh->np; ip++ ) {
+    ppt = &mesh->point[ip];
+    if( !MG_VOK(ppt) ) continue;
+    for( d = 0; d < 3; d++ ) {
+      grid->min[d] = MG_MIN(grid->min[d],ppt->c[d]);
+      max[d]       = MG_MAX(max[d],ppt->c[d]);
+    }
+  }
+
+  /* Cell size */
+  ncell = MG_MAX(1,MG_MAX(mesh->ne,mesh->nt)/PMMG_LOCATE_GRID_DENSITY);
+  ncell = MG_MIN(ncell,PMMG_LOCATE_GRID_NCELL_MAX);
+  vol   = 1.0;
+  ndim  = 0;
+  for( d = 0; d < 3; d++ ) {
+    len[d] = max[d] - grid->min[d];
+    if( len[d] > 0.0 ) {
+      vol *= len[d];
+      ndim++;
+    }
+  }
+  h = ndim ? pow(vol/ncell,1.0/ndim) : 1.0;
+
+  /* Each direction holds at least one cell, so a thin bounding box may give
+   * much more cells than targeted: enlarge the cells until the total number of
+   * cells is bounded */
+  nmax = MG_MIN((int64_t)PMMG_LOCATE_GRID_NCELL_FACTOR*ncell,
+                (int64_t)PMMG_LOCATE_GRID_NCELL_MAX);
+  do {
+    ntot = 1;
+    for( d = 0; d < 3; d++ ) {
+      if( len[d] > 0.0 ) {
+        grid->n[d] = (int)MG_MIN((double)ncell,floor(len[d]/h)+1.0);
+      }
+      else {
+        grid->n[d] = 1;
+      }
+      ntot *= grid->n[d];
+    }
+    h *= 2.0;
+  } while( ntot > nmax );
+
+  for( d = 0; d < 3; d++ ) {
+    if( len[d] > 0.0 ) {
+      grid->inv[d] = grid->n[d]/len[d];
+    }
+    else {
+      /* Empty or flat mesh */
+      if( len[d] < 0.0 ) grid->min[d] = 0.0;
+      grid->inv[d] = 0.0;
+    }
+  }
+
+  /* Elements of each cell */
+  if( mesh->ne ) {
+    if( !PMMG_locateGrid_fill( parmesh,mesh,grid,4,&grid->tetraOff,&grid->tetra ) )
+      return 0;
+  }
+  if( mesh->nt ) {
+    if( !PMMG_locateGrid_fill( parmesh,mesh,grid,3,&grid->triaOff,&grid->tria ) ) {
+      PMMG_locateGrid_free( parmesh,grid );
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer to the parmesh structure.
+ * \param grid pointer to the localization grid.
+ *
+ *  Free the localization grid.
+ *
+ */
+void PMMG_locateGrid_free( PMMG_pParMesh parmesh,PMMG_pLocateGrid grid ) {
+
+  if( grid->tetraOff ) {
+    PMMG_DEL_MEM(parmesh,grid->tetra,int,"locate grid list");
+    PMMG_DEL_MEM(parmesh,grid->tetraOff,int,"locate grid offsets");
+  }
+  if( grid->triaOff ) {
+    PMMG_DEL_MEM(parmesh,grid->tria,int,"locate grid list");
+    PMMG_DEL_MEM(parmesh,grid->triaOff,int,"locate grid offsets");
+  }
+}
+
+/**
+ * \param warn pointer to a warning flag.
+ *
+ * \return 1 the first time the function is called with \a warn, 0 otherwise.
+ *
+ *  Test and set a warning flag (points may be located by concurrent threads).
+ *
+ */
+static inline
+int PMMG_locate_warnOnce( int *warn ) {
+  int first;
+
+#ifdef USE_OPENMP
+#pragma omp critical (PMMG_locate_warn)
+#endif
+  {
+    first = !(*warn);
+    *warn = 1;
+  }
+
+  return first;
+}
+
+/**
+ * \param parmesh pointer to the parmesh structure.
+ * \param mesh pointer to the background mesh structure.
+ * \param marks pointer to the marks to allocate.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ *  Allocate the marks of the background entities visited by the localizations.
+ *
+ */
+int PMMG_locateMarks_init( PMMG_pParMesh parmesh,MMG5_pMesh mesh,
+                           PMMG_pLocateMarks marks ) {
+
+  memset(marks,0,sizeof(PMMG_locateMarks));
+
+  PMMG_CALLOC( parmesh,marks->tetra,mesh->ne+1,int,"tetra marks",
+               return 0 );
+  PMMG_CALLOC( parmesh,marks->tria,mesh->nt+1,int,"tria marks",
+               PMMG_locateMarks_free( parmesh,marks );return 0 );
+  PMMG_CALLOC( parmesh,marks->point,mesh->np+1,int,"point marks",
+               PMMG_locateMarks_free( parmesh,marks );return 0 );
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer to the parmesh structure.
+ * \param marks pointer to the marks.
+ *
+ *  Free the marks of the background entities.
+ *
+ */
+void PMMG_locateMarks_free( PMMG_pParMesh parmesh,PMMG_pLocateMarks marks ) {
+
+  PMMG_DEL_MEM(parmesh,marks->tetra,int,"tetra marks");
+  PMMG_DEL_MEM(parmesh,marks->tria,int,"tria marks");
+  PMMG_DEL_MEM(parmesh,marks->point,int,"point marks");
+}
+
+/**
+ * \param grid pointer to the localization grid.
+ * \param off offsets of the cells in the \a list array.
+ * \param list elements of the cells.
+ * \param c coordinates of the point to locate.
+ *
+ * \return the index of an element of the cell that contains the point, 0 if
+ * the cell is empty.
+ *
+ *  Get an element near a point to start a localization walk.
+ *
+ */
+static inline
+int PMMG_locateGrid_seed( PMMG_pLocateGrid grid,int *off,int *list,double *c ) {
+  int idx[3],cell;
+
+  PMMG_locateGrid_cell( grid,c,idx );
+  cell = PMMG_locateGrid_idx( grid,idx[0],idx[1],idx[2] );
+
+  if( off[cell+1] > off[cell] ) return list[off[cell]];
+
+  return 0;
+}
+
 /**
  * \param mesh pointer to the background mesh structure
+ * \param marks pointer to the marks of the visited entities
  * \param iel index of the background triangle
  * \param iloc local index of the cone point in the background triangle
  * \param ppt pointer to the point to locate
@@ -206,7 +536,7 @@ int PMMG_precompute_nodeTrias( PMMG_pParMesh parmesh,MMG5_pMesh mesh,int **nodeT
  *  Locate a point in the shadow cone of a background point.
  *
  */
-int PMMG_locatePointInCone( MMG5_pMesh mesh,int *nodeTrias,int iel,int iloc,
+int PMMG_locatePointInCone( MMG5_pMesh mesh,PMMG_pLocateMarks marks,int *nodeTrias,int iel,int iloc,
                             MMG5_pPoint ppt ) {
   MMG5_pTria     ptr;
   MMG5_pPoint    ppt0,ppt1;
@@ -216,7 +546,7 @@ int PMMG_locatePointInCone( MMG5_pMesh mesh,int *nodeTrias,int iel,int iloc,
   ppt0 = &mesh->point[mesh->tria[iel].v[iloc]];
 
   /* Mark point */
-  ppt0->flag = mesh->base;
+  marks->point[mesh->tria[iel].v[iloc]] = marks->base;
 
   /* Target point vector */
   for( d = 0; d < 3; d++ ) p[d] = ppt->c[d]-ppt0->c[d];
@@ -245,8 +575,8 @@ int PMMG_locatePointInCone( MMG5_pMesh mesh,int *nodeTrias,int iel,int iloc,
         continue;
       }
       ppt1 = &mesh->point[jp];
-      if( ppt1->flag == ip ) continue;
-      ppt1->flag = ip;
+      if( marks->point[jp] == ip ) continue;
+      marks->point[jp] = ip;
       /* Edge vector */
       for( d = 0; d < 3; d++ ) a[d] = ppt1->c[d]-ppt0->c[d];
       /* Rough check on maximum distance */
@@ -271,6 +601,7 @@ int PMMG_locatePointInCone( MMG5_pMesh mesh,int *nodeTrias,int iel,int iloc,
 
 /**
  * \param mesh pointer to the background mesh structure
+ * \param marks pointer to the marks of the visited entities
  * \param ptr pointer to the background triangle
  * \param k index of the background triangle
  * \param l local index of the edge
@@ -283,7 +614,7 @@ int PMMG_locatePointInCone( MMG5_pMesh mesh,int *nodeTrias,int iel,int iloc,
  *  triangles have already been tested.
  *
  */
-int PMMG_locatePointInWedge( MMG5_pMesh mesh,MMG5_pTria ptr,int k,int l,MMG5_pPoint ppt,PMMG_barycoord *barycoord ) {
+int PMMG_locatePointInWedge( MMG5_pMesh mesh,PMMG_pLocateMarks marks,MMG5_pTria ptr,int k,int l,MMG5_pPoint ppt,PMMG_barycoord *barycoord ) {
   MMG5_pPoint ppt0,ppt1;
   double      a[3],p[3],norm2,dist,alpha;
   int         i0,i1,d;
@@ -316,10 +647,10 @@ int PMMG_locatePointInWedge( MMG5_pMesh mesh,MMG5_pTria ptr,int k,int l,MMG5_pPo
 
   /* Check scalar product */
   if( alpha < 0.0 ) {
-    ppt1->flag = mesh->base;
+    marks->point[ptr->v[i1]] = marks->base;
     return i0;
   } else if( alpha > norm2 ) {
-    ppt0->flag = mesh->base;
+    marks->point[ptr->v[i0]] = marks->base;
     return i1;
   }
 
@@ -367,6 +698,7 @@ int PMMG_locateChkDistTria( MMG5_pMesh mesh,MMG5_pTria ptr,MMG5_pPoint ppt,
 
 /**
  * \param mesh pointer to the background mesh structure
+ * \param marks pointer to the marks of the visited entities
  * \param ptr pointer to the triangle to analyze
  * \param k index of the triangle
  * \param ppt pointer to the point to locate
@@ -382,7 +714,7 @@ int PMMG_locateChkDistTria( MMG5_pMesh mesh,MMG5_pTria ptr,MMG5_pPoint ppt,
  *  coordinates.
  *
  */
-int PMMG_locatePointInTria( MMG5_pMesh mesh,MMG5_pTria ptr,int k,MMG5_pPoint ppt,
+int PMMG_locatePointInTria( MMG5_pMesh mesh,PMMG_pLocateMarks marks,MMG5_pTria ptr,int k,MMG5_pPoint ppt,
                             double *triaNormal,PMMG_barycoord *barycoord,
                             double *h,double *closestDist,int *closestTria ) {
   MMG5_pPoint    ppt0,ppt1;
@@ -391,7 +723,7 @@ int PMMG_locatePointInTria( MMG5_pMesh mesh,MMG5_pTria ptr,int k,MMG5_pPoint ppt
   int            j,d,found;
 
   /* Mark tria */
-  ptr->flag = mesh->base;
+  marks->tria[k] = marks->base;
 
   /* Evaluate point in tetra through barycentric coordinates */
   found = PMMG_barycoord2d_evaluate( mesh,ptr,k,ppt->c,triaNormal,barycoord );
@@ -424,10 +756,11 @@ int PMMG_locatePointInTria( MMG5_pMesh mesh,MMG5_pTria ptr,int k,MMG5_pPoint ppt
 
 /**
  * \param mesh pointer to the background mesh structure
+ * \param marks pointer to the marks of the visited entities
  * \param pt pointer to the tetra to analyze
  * \param k index of the tetra
  * \param ppt pointer to the point to locate
- * \param faceAreas oriented face areas of the current tetrahedron
+ * \param faceAreas barycentric coefficients of the current tetrahedron
  * \param barycoord barycentric coordinates of the point to be located
  * \param closestDist pointer to the distance from the closest tetrahedron
  * \param closestTet pointer to the index of the closest tetrahedron
@@ -438,14 +771,14 @@ int PMMG_locatePointInTria( MMG5_pMesh mesh,MMG5_pTria ptr,int k,MMG5_pPoint ppt
  *  coordinates.
  *
  */
-int PMMG_locatePointInTetra( MMG5_pMesh mesh,MMG5_pTetra pt,int k,MMG5_pPoint ppt,
+int PMMG_locatePointInTetra( MMG5_pMesh mesh,PMMG_pLocateMarks marks,MMG5_pTetra pt,int k,MMG5_pPoint ppt,
                              double *faceAreas,PMMG_barycoord *barycoord,
                              double *closestDist,int *closestTet) {
   double vol;
   int    found;
 
   /* Mark tetra */
-  pt->flag = mesh->base;
+  marks->tetra[k] = marks->base;
 
   /* Evaluate point in tetra through barycentric coordinates */
   found = PMMG_barycoord3d_evaluate( mesh,pt,ppt->c,faceAreas,barycoord );
@@ -462,6 +795,174 @@ int PMMG_locatePointInTetra( MMG5_pMesh mesh,MMG5_pTetra pt,int k,MMG5_pPoint pp
 
 /**
  * \param mesh pointer to the background mesh structure
+ * \param marks pointer to the marks of the visited entities
+ * \param list indices of the tetra to analyze
+ * \param nel number of tetra in \a list (at most PMMG_BARYCOORD_BATCH)
+ * \param ppt pointer to the point to locate
+ * \param faceAreas barycentric coefficients of all the tetrahedra in the mesh
+ * \param barycoord barycentric coordinates of the point to be located
+ * \param closestDist pointer to the distance from the closest tetrahedron
+ * \param closestTet pointer to the index of the closest tetrahedron
+ *
+ * \return the position in \a list of the tetra containing the point, -1 if
+ * not found.
+ *
+ *  Locate a point in a batch of background tetrahedra. The barycentric
+ *  coordinates of the whole batch are computed by a single kernel call, then
+ *  the tetra are analyzed in the order of \a list as in
+ *  PMMG_locatePointInTetra.
+ *
+ */
+static
+int PMMG_locatePointInTetraBatch( MMG5_pMesh mesh,PMMG_pLocateMarks marks,
+                                  int *list,int nel,MMG5_pPoint ppt,
+                                  double *faceAreas,PMMG_barycoord *barycoord,
+                                  double *closestDist,int *closestTet ) {
+  double phi[4*PMMG_BARYCOORD_BATCH],*myphi,phimin,dist;
+  int    j,k,ifac;
+
+  PMMG_barycoord3d_computeBatch( faceAreas,list,nel,ppt->c,phi );
+
+  for( j = 0; j < nel; j++ ) {
+    k = list[j];
+
+    /* The same tetra may appear twice in a batch */
+    if( marks->tetra[k] == marks->base ) continue;
+    marks->tetra[k] = marks->base;
+
+    myphi  = &phi[4*j];
+    phimin = MG_MIN(MG_MIN(myphi[0],myphi[1]),MG_MIN(myphi[2],myphi[3]));
+
+    /** Save element index if it is the closest one */
+    dist = fabs(phimin)*mesh->tetra[k].qual;
+    if( dist < *closestDist ) {
+      *closestDist = dist;
+      *closestTet = k;
+    }
+
+    if( phimin > -MMG5_EPS ) {
+      for( ifac = 0; ifac < 4; ifac++ ) {
+        barycoord[ifac].val = myphi[ifac];
+        barycoord[ifac].idx = ifac;
+      }
+      PMMG_barycoord_sort( barycoord,4 );
+      return j;
+    }
+  }
+
+  return -1;
+}
+
+/**
+ * \param mesh pointer to the background mesh structure
+ * \param marks pointer to the marks of the visited entities
+ * \param grid pointer to the localization grid
+ * \param ppt pointer to the point to locate
+ * \param istet 1 to search in the tetra, 0 to search in the triangles
+ * \param areas barycentric coefficients of the tetra or normals of the triangles
+ * \param barycoord barycentric coordinates of the point to be located
+ * \param idx pointer to the index of the found element
+ * \param closest pointer to the index of the closest element
+ * \param closestDist pointer to the distance from the closest element
+ *
+ * \return 1 if found, 0 otherwise.
+ *
+ *  Point search on the background elements stored in the grid cells around
+ *  the point: the rings of cells around the cell of the point are explored
+ *  until PMMG_LOCATE_GRID_RING rings have been explored after the first non
+ *  empty one. Replace the exhaustive search over all the mesh elements.
+ *
+ */
+static
+int PMMG_locateGrid_search( MMG5_pMesh mesh,PMMG_pLocateMarks marks,PMMG_pLocateGrid grid,
+                            MMG5_pPoint ppt,int istet,double *areas,
+                            PMMG_barycoord *barycoord,int *idx,
+                            int *closest,double *closestDist ) {
+  MMG5_pTria  ptr;
+  double      h;
+  int         *off,*list,icell[3],imin[3],imax[3];
+  int         batch[PMMG_BARYCOORD_BATCH],nbatch,ib;
+  int         i,j,l,d,r,rmax,cell,m,k,nseen,found;
+
+  off  = istet ? grid->tetraOff : grid->triaOff;
+  list = istet ? grid->tetra    : grid->tria;
+
+  PMMG_locateGrid_cell( grid,ppt->c,icell );
+
+  rmax   = MG_MAX(grid->n[0],MG_MAX(grid->n[1],grid->n[2]));
+  nseen  = 0;
+  nbatch = 0;
+  for( r = 0; r <= rmax; r++ ) {
+    for( d = 0; d < 3; d++ ) {
+      imin[d] = MG_MAX(0,icell[d]-r);
+      imax[d] = MG_MIN(grid->n[d]-1,icell[d]+r);
+    }
+
+    for( l = imin[2]; l <= imax[2]; l++ ) {
+      for( j = imin[1]; j <= imax[1]; j++ ) {
+        for( i = imin[0]; i <= imax[0]; i++ ) {
+          /* Only visit the cells of the ring r */
+          if( abs(i-icell[0]) < r && abs(j-icell[1]) < r && abs(l-icell[2]) < r )
+            continue;
+
+          cell = PMMG_locateGrid_idx( grid,i,j,l );
+          for( m = off[cell]; m < off[cell+1]; m++ ) {
+            k = list[m];
+            nseen++;
+
+            if( istet ) {
+              /* Skip already analized elements */
+              if( marks->tetra[k] == marks->base ) continue;
+              ppt->s--;
+              /* Evaluate the tetra by batches */
+              batch[nbatch++] = k;
+              if( nbatch < PMMG_BARYCOORD_BATCH ) continue;
+              ib = PMMG_locatePointInTetraBatch( mesh,marks,batch,nbatch,ppt,areas,
+                                                 barycoord,closestDist,closest );
+              nbatch = 0;
+              found = ( ib >= 0 );
+              if( found ) k = batch[ib];
+            }
+            else {
+              ptr = &mesh->tria[k];
+              if( marks->tria[k] == marks->base ) continue;
+              ppt->s--;
+              found = PMMG_locatePointInTria( mesh,marks,ptr,k,ppt,&areas[3*k],
+                                              barycoord,&h,closestDist,closest );
+            }
+
+            if( found ) {
+              *idx = k;
+              return 1;
+            }
+          }
+        }
+      }
+    }
+
+    /* Evaluate the last tetra batch of the ring */
+    if( nbatch ) {
+      ib = PMMG_locatePointInTetraBatch( mesh,marks,batch,nbatch,ppt,areas,
+                                         barycoord,closestDist,closest );
+      nbatch = 0;
+      if( ib >= 0 ) {
+        *idx = batch[ib];
+        return 1;
+      }
+    }
+
+    /* Stop PMMG_LOCATE_GRID_RING rings after the first non empty one */
+    if( nseen && rmax > r + PMMG_LOCATE_GRID_RING ) {
+      rmax = r + PMMG_LOCATE_GRID_RING;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * \param mesh pointer to the background mesh structure
+ * \param marks pointer to the marks of the visited entities
  * \param ppt pointer to the point to locate
  * \param triaNormals non-normalized triangle normals of all mesh triangles
  * \param iTria pointer to the index of the found triangle
@@ -474,7 +975,7 @@ int PMMG_locatePointInTetra( MMG5_pMesh mesh,MMG5_pTetra pt,int k,MMG5_pPoint pp
  *  found, the triangle pointers points to the closest triangle.
  *
  */
-int PMMG_locatePoint_exhaustTria( MMG5_pMesh mesh,MMG5_pPoint ppt,
+int PMMG_locatePoint_exhaustTria( MMG5_pMesh mesh,PMMG_pLocateMarks marks,MMG5_pPoint ppt,
                                   double *triaNormals,PMMG_barycoord *barycoord,
                                   int *iTria,int *closestTria,double *closestDist ) {
   MMG5_pTria     ptr;
@@ -490,10 +991,10 @@ int PMMG_locatePoint_exhaustTria( MMG5_pMesh mesh,MMG5_pPoint ppt,
     if ( !MG_EOK(ptr) ) continue;
 
     /*¨Skip already analized tetras */
-    if( ptr->flag == mesh->base ) continue;
+    if( marks->tria[*iTria] == marks->base ) continue;
 
     /** Exit the loop if you find the element */
-    if( PMMG_locatePointInTria( mesh, ptr, *iTria, ppt,
+    if( PMMG_locatePointInTria( mesh,marks,ptr, *iTria, ppt,
                                 &triaNormals[3*(*iTria)], barycoord,
                                 &h, closestDist, closestTria ) ) break;
 
@@ -504,7 +1005,7 @@ int PMMG_locatePoint_exhaustTria( MMG5_pMesh mesh,MMG5_pPoint ppt,
   } else {
     *iTria = *closestTria;
     /* Recompute barycentric coordinates */
-    if( !PMMG_locatePointInTria( mesh, ptr, *iTria, ppt,
+    if( !PMMG_locatePointInTria( mesh,marks,ptr, *iTria, ppt,
                                  &triaNormals[3*(*iTria)], barycoord,
                                  &h, closestDist, closestTria ) ) {
       /* Recompute barycentric coordinates to the closest point */
@@ -516,6 +1017,7 @@ int PMMG_locatePoint_exhaustTria( MMG5_pMesh mesh,MMG5_pPoint ppt,
 
 /**
  * \param mesh pointer to the background mesh structure
+ * \param marks pointer to the marks of the visited entities
  * \param ppt pointer to the point to locate
  * \param kfound pointer to the index of the starting element
  * \param triaNormals unit normals of the all triangles in the mesh
@@ -528,7 +1030,7 @@ int PMMG_locatePoint_exhaustTria( MMG5_pMesh mesh,MMG5_pPoint ppt,
  *  and barycentric coordinates if this is the case.
  *
  */
-int PMMG_locatePoint_foundConvex( MMG5_pMesh mesh,MMG5_pPoint ppt,int *kfound,
+int PMMG_locatePoint_foundConvex( MMG5_pMesh mesh,PMMG_pLocateMarks marks,MMG5_pPoint ppt,int *kfound,
                                   double *triaNormals,PMMG_barycoord *baryfound,
                                   double *h,double *closestDist,int *closestTria ) {
   MMG5_pTria ptr;
@@ -547,10 +1049,10 @@ int PMMG_locatePoint_foundConvex( MMG5_pMesh mesh,MMG5_pPoint ppt,int *kfound,
     ptr = &mesh->tria[k];
     if( !MG_EOK(ptr) ) continue;
     /* Visited triangles don't see the point or have already been listed here */
-    if( ptr->flag == mesh->base ) continue;
+    if( marks->tria[k] == marks->base ) continue;
 
     /** Exit the loop if you find the element */
-    if( PMMG_locatePointInTria( mesh, ptr, k, ppt, &triaNormals[3*k],
+    if( PMMG_locatePointInTria( mesh,marks,ptr, k, ppt, &triaNormals[3*k],
                                 barycoord, h, closestDist, closestTria ) ) {
       if( *h < hmin ) {
         updated = 1;
@@ -570,8 +1072,11 @@ int PMMG_locatePoint_foundConvex( MMG5_pMesh mesh,MMG5_pPoint ppt,int *kfound,
 
 /**
  * \param mesh pointer to the background mesh structure
+ * \param marks pointer to the marks of the visited entities
  * \param ppt pointer to the point to locate
  * \param triaNormals unit normals of the all triangles in the mesh
+ * \param nodeTrias node triangles graph
+ * \param grid localization grid (may be NULL)
  * \param barycoord barycentric coordinates of the point to be located
  * \param iTria pointer to the index of the triangle
  * \param ifoundEdge pointer to the index of the local edge
@@ -581,11 +1086,13 @@ int PMMG_locatePoint_foundConvex( MMG5_pMesh mesh,MMG5_pPoint ppt,int *kfound,
  * search.
  *
  *  Locate a point in a background mesh surface by traveling the triangles
- *  adjacency.
+ *  adjacency. If a localization grid is provided, it is used to seed the walk
+ *  when no starting triangle is given and to replace the exhaustive search.
  *
  */
-int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
-                         double *triaNormals,int *nodeTrias,PMMG_barycoord *barycoord,
+int PMMG_locatePointBdy( MMG5_pMesh mesh,PMMG_pLocateMarks marks,MMG5_pPoint ppt,
+                         double *triaNormals,int *nodeTrias,PMMG_pLocateGrid grid,
+                         PMMG_barycoord *barycoord,
                          int *iTria,int *ifoundEdge,int *ifoundVertex ) {
   MMG5_pTria     ptr,ptr1;
   int            *adjt,j,i,k,k1,kprev,step,closestTria,stuck,backward;
@@ -594,17 +1101,18 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
   static int     mmgWarn0=0,mmgWarn1=0;
   int            ier;
 
-  if(!(*iTria))
+  k = *iTria;
+  if( !k && grid && grid->triaOff )
+    k = PMMG_locateGrid_seed( grid,grid->triaOff,grid->tria,ppt->c );
+  if( !k )
     k = 1;
-  else
-    k = *iTria;
 
   assert( k <= mesh->nt );
 
   kprev = 0;
   stuck = 0;
   step = 0;
-  ++mesh->base;
+  ++marks->base;
 
   closestTria = 0;
   closestDist = 1.0e10;
@@ -621,7 +1129,7 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
     if ( !MG_EOK(ptr) ) continue;
 
     /** Exit the loop if you find the element */
-    if( PMMG_locatePointInTria( mesh, ptr, k, ppt, &triaNormals[3*k],
+    if( PMMG_locatePointInTria( mesh,marks,ptr, k, ppt, &triaNormals[3*k],
                                 barycoord, &h, &closestDist, &closestTria ) ) {
       PMMG_barycoord_isBorder( barycoord, ifoundEdge, ifoundVertex );
       break;
@@ -639,8 +1147,8 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
 
       /* Test shadow regions if the tria has already been visited */
       ptr1 = &mesh->tria[k1];
-      if(ptr1->flag == mesh->base) {
-        iloc = PMMG_locatePointInWedge( mesh,ptr,k,i,ppt,barycoord );
+      if(marks->tria[k1] == marks->base) {
+        iloc = PMMG_locatePointInWedge( mesh,marks,ptr,k,i,ppt,barycoord );
         if( iloc == PMMG_UNSET ) continue;
         if( iloc == 4 ) {
           *ifoundEdge = i;
@@ -648,7 +1156,7 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
           *iTria = k;
           return 1;
         } else {
-          ier = PMMG_locatePointInCone( mesh,nodeTrias,k,iloc,ppt );
+          ier = PMMG_locatePointInCone( mesh,marks,nodeTrias,k,iloc,ppt );
           if( ier ) {
             *ifoundVertex = iloc;
             ppt->s = step;
@@ -685,7 +1193,7 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
 
   /* If a candidate triangle has been found, check convex configurations */
   if( !stuck )
-    PMMG_locatePoint_foundConvex( mesh,ppt,&k,triaNormals,barycoord,
+    PMMG_locatePoint_foundConvex( mesh,marks,ppt,&k,triaNormals,barycoord,
                                   &h,&closestDist,&closestTria);
 
   /* Return the index of the tria */
@@ -693,22 +1201,37 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
 
   /** Boundary hit or cyclic path: Perform exhaustive research */
   if( stuck ) {
-    if ( !mmgWarn0 ) {
-      mmgWarn0 = 1;
+    if ( PMMG_locate_warnOnce(&mmgWarn0) ) {
       if ( mesh->info.imprim > PMMG_VERB_DETQUAL ) {
         fprintf(stderr,"\n  ## Warning %s: Cannot locate point,"
-                " performing exhaustive research.\n",__func__);
+                " performing %s research.\n",__func__,
+                ( grid && grid->triaOff ) ? "grid" : "exhaustive");
       }
     }
 
-    ier = PMMG_locatePoint_exhaustTria( mesh, ppt,triaNormals,barycoord,
-                                           iTria,&closestTria,&closestDist );
+    if( grid && grid->triaOff ) {
+      ier = PMMG_locateGrid_search( mesh,marks,grid,ppt,0,triaNormals,barycoord,
+                                    iTria,&closestTria,&closestDist );
+      if( !ier ) {
+        *iTria = closestTria;
+        /* Recompute barycentric coordinates */
+        if( !PMMG_locatePointInTria( mesh,marks,&mesh->tria[*iTria],*iTria,ppt,
+                                     &triaNormals[3*(*iTria)],barycoord,
+                                     &h,&closestDist,&closestTria ) ) {
+          /* Recompute barycentric coordinates to the closest point */
+          PMMG_barycoord2d_getClosest( mesh,*iTria,ppt,barycoord );
+        }
+      }
+    }
+    else {
+      ier = PMMG_locatePoint_exhaustTria( mesh,marks,ppt,triaNormals,barycoord,
+                                          iTria,&closestTria,&closestDist );
+    }
     if( ier ) {
       return -1;
     } else {
     /** Element not found: Return the closest one */
-      if ( !mmgWarn1 ) {
-        mmgWarn1 = 1;
+      if ( PMMG_locate_warnOnce(&mmgWarn1) ) {
         if ( mesh->info.imprim > PMMG_VERB_VERSION ) {
           fprintf(stderr,"\n  ## Warning %s: Point not located, smallest external area %e.",
                   __func__,closestDist);
@@ -724,8 +1247,9 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
 
 /**
  * \param mesh pointer to the background mesh structure
+ * \param marks pointer to the marks of the visited entities
  * \param ppt pointer to the point to locate
- * \param faceAreas oriented face areas of the all tetrahedra in the mesh
+ * \param faceAreas barycentric coefficients of all the tetrahedra in the mesh
  * \param idxTet pointer to the index of the found tetrahedron
  * \param closestTet pointer to the index of the closest tetrahedron
  * \param closestDist pointer to the distance from the closest tetrahedron
@@ -734,64 +1258,82 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
  *  Exhaustive point search on the background tetrahedra.
  *
  */
-int PMMG_locatePoint_exhaustTetra( MMG5_pMesh mesh,MMG5_pPoint ppt,
+int PMMG_locatePoint_exhaustTetra( MMG5_pMesh mesh,PMMG_pLocateMarks marks,MMG5_pPoint ppt,
                                    double *faceAreas,PMMG_barycoord *barycoord,
                                    int *idxTet,int *closestTet,double *closestDist ) {
   MMG5_pTetra    pt;
-  double         vol;
+  int            batch[PMMG_BARYCOORD_BATCH],nbatch,ib,k;
 
-  for( *idxTet = 1; *idxTet <= mesh->ne; (*idxTet)++ ) {
+  nbatch = 0;
+  for( k = 1; k <= mesh->ne; k++ ) {
 
     /* Increase step counter */
     ppt->s--;
 
     /** Get tetra */
-    pt = &mesh->tetra[*idxTet];
+    pt = &mesh->tetra[k];
     if ( !MG_EOK(pt) ) continue;
 
     /*¨Skip already analized tetras */
-    if( pt->flag == mesh->base ) continue;
-
-    /** Exit the loop if you find the element */
-    if( PMMG_locatePointInTetra( mesh, pt, *idxTet, ppt,&faceAreas[12*(*idxTet)],
-                                 barycoord, closestDist, closestTet ) ) break;
-
+    if( marks->tetra[k] == marks->base ) continue;
+
+    /** Evaluate the tetra by batches, exit the loop if you find the element */
+    batch[nbatch++] = k;
+    if( nbatch < PMMG_BARYCOORD_BATCH ) continue;
+
+    ib = PMMG_locatePointInTetraBatch( mesh,marks,batch,nbatch,ppt,faceAreas,
+                                       barycoord,closestDist,closestTet );
+    nbatch = 0;
+    if( ib >= 0 ) {
+      *idxTet = batch[ib];
+      return 1;
+    }
   }
 
-  if( *idxTet <= mesh->ne ) {
-    return 1;
-  } else {
-    *idxTet = *closestTet;
-    /* Recompute barycentric coordinates to the closest point */
-    PMMG_barycoord3d_getClosest( mesh,*idxTet,ppt,barycoord );
-    return 0;
+  if( nbatch ) {
+    ib = PMMG_locatePointInTetraBatch( mesh,marks,batch,nbatch,ppt,faceAreas,
+                                       barycoord,closestDist,closestTet );
+    if( ib >= 0 ) {
+      *idxTet = batch[ib];
+      return 1;
+    }
   }
-  return 1;
+
+  *idxTet = *closestTet;
+  /* Recompute barycentric coordinates to the closest point */
+  PMMG_barycoord3d_getClosest( mesh,*idxTet,ppt,barycoord );
+  return 0;
 }
 
 /**
  * \param mesh pointer to the background mesh structure
+ * \param marks pointer to the marks of the visited entities
  * \param ppt pointer to the point to locate
  * \param init index of the starting element
- * \param faceAreas oriented face areas of the all tetrahedra in the mesh
+ * \param faceAreas barycentric coefficients of all the tetrahedra in the mesh
+ * \param grid localization grid (may be NULL)
  * \param barycoord barycentric coordinates of the point to be located
  * \param idxTet pointer to the index of the found tetrahedron.
  *
  * \return 0 if not found (closest), 1 if found, -1 if found through exhaustive
  * search.
  *
- *  Locate a point in a background mesh by traveling the elements adjacency.
+ *  Locate a point in a background mesh by traveling the elements adjacency. If
+ *  a localization grid is provided, it is used to seed the walk when no
+ *  starting element is given and to replace the exhaustive search.
  *
  */
-int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
-                         double *faceAreas,PMMG_barycoord *barycoord,
-                         int *idxTet ) {
+int PMMG_locatePointVol( MMG5_pMesh mesh,PMMG_pLocateMarks marks,MMG5_pPoint ppt,
+                         double *faceAreas,PMMG_pLocateGrid grid,
+                         PMMG_barycoord *barycoord,int *idxTet ) {
   MMG5_pTetra    pt,pt1;
   int            *adja,iel,i,step,closestTet,stuck;
   double         vol,eps,closestDist;
   static int     mmgWarn0=0,mmgWarn1=0;
   int            ier;
 
+  if( !(*idxTet) && grid && grid->tetraOff )
+    *idxTet = PMMG_locateGrid_seed( grid,grid->tetraOff,grid->tetra,ppt->c );
   if(!(*idxTet))
     *idxTet = 1;
 
@@ -802,7 +1344,7 @@ int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
 
   stuck = 0;
   step = 0;
-  ++mesh->base;
+  ++marks->base;
   while( (step <= mesh->ne) && (!stuck) ) {
     step++;
 
@@ -811,7 +1353,7 @@ int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
     if ( !MG_EOK(pt) ) continue;
 
     /** Exit the loop if you find the element */
-    if( PMMG_locatePointInTetra( mesh, pt, *idxTet,ppt,&faceAreas[12*(*idxTet)],
+    if( PMMG_locatePointInTetra( mesh,marks,pt, *idxTet,ppt,&faceAreas[PMMG_BARYCOORD_SOA*(*idxTet)],
                                  barycoord,&closestDist,&closestTet ) ) break;
 
     /** Compute new direction (barycentric coordinates are sorted in increasing
@@ -825,7 +1367,7 @@ int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
 
       /* Skip if already marked */
       pt1 = &mesh->tetra[iel];
-      if(pt1->flag == mesh->base) continue;
+      if(marks->tetra[iel] == marks->base) continue;
 
       /* Get next otherwise */
       *idxTet = iel;
@@ -853,23 +1395,33 @@ int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
 
   /** Boundary hit or cyclic path: Perform exhaustive research */
   if( stuck ) {
-    if ( !mmgWarn0 ) {
-      mmgWarn0 = 1;
+    if ( PMMG_locate_warnOnce(&mmgWarn0) ) {
       if ( mesh->info.imprim > PMMG_VERB_DETQUAL ) {
         fprintf(stderr,"\n  ## Warning %s: Cannot locate point,"
-                " performing exhaustive research.\n",__func__);
+                " performing %s research.\n",__func__,
+                ( grid && grid->tetraOff ) ? "grid" : "exhaustive");
       }
     }
 
-    ier = PMMG_locatePoint_exhaustTetra( mesh,ppt,faceAreas,barycoord,
-                                         idxTet,&closestTet,&closestDist );
+    if( grid && grid->tetraOff ) {
+      ier = PMMG_locateGrid_search( mesh,marks,grid,ppt,1,faceAreas,barycoord,
+                                    idxTet,&closestTet,&closestDist );
+      if( !ier ) {
+        *idxTet = closestTet;
+        /* Recompute barycentric coordinates to the closest point */
+        PMMG_barycoord3d_getClosest( mesh,*idxTet,ppt,barycoord );
+      }
+    }
+    else {
+      ier = PMMG_locatePoint_exhaustTetra( mesh,marks,ppt,faceAreas,barycoord,
+                                           idxTet,&closestTet,&closestDist );
+    }
 
     if( ier ) {
       return -1;
     } else {
       /** Element not found: Return the closest one */
-      if ( !mmgWarn1 ) {
-        mmgWarn1 = 1;
+      if ( PMMG_locate_warnOnce(&mmgWarn1) ) {
         if ( mesh->info.imprim > PMMG_VERB_VERSION ) {
           fprintf(stderr,"\n  ## Warning %s: Point not located, smallest external volume %e.",
                   __func__,closestDist);
@@ -896,22 +1448,20 @@ int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
 void PMMG_locatePoint_errorCheck( MMG5_pMesh mesh,int ip,int ier,
                                  int myrank,int igrp ) {
   MMG5_pPoint ppt;
-  static int8_t pmmgWarn0 = 0;
-  static int8_t pmmgWarn1 = 0;
+  static int    pmmgWarn0 = 0;
+  static int    pmmgWarn1 = 0;
 
   ppt = &mesh->point[ip];
 
   if( !ier ) {
-    if ( !pmmgWarn0 ) {
-      pmmgWarn0 = 1;
+    if ( PMMG_locate_warnOnce(&pmmgWarn0) ) {
       fprintf(stderr,"\n  ## Warning: %s (rank %d, grp %d): at least one"
               " localisation issue: closest element for"
               " point %d (tag %d), coords %e %e %e\n",__func__,myrank,igrp,
               ip,ppt->tag,ppt->c[0],ppt->c[1],ppt->c[2]);
     }
   } else if ( ier < 0 ) {
-    if ( !pmmgWarn1 ) {
-      pmmgWarn1 = 1;
+    if ( PMMG_locate_warnOnce(&pmmgWarn1) ) {
       fprintf(stderr,"\n  ## Warning: %s (rank %d, grp %d): at least one"
               " exhaustive search for"
               " point %d (tag %d), coords %e %e %e\n",__func__,myrank,igrp,
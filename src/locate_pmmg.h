@@ -37,6 +37,20 @@
 
 #include "barycoord_pmmg.h"
 
+/** Targeted number of elements per cell of the localization grid */
+#define PMMG_LOCATE_GRID_DENSITY 4
+
+/** Maximal ratio between the number of cells of the localization grid and its
+ * targeted number of cells (thin bounding boxes) */
+#define PMMG_LOCATE_GRID_NCELL_FACTOR 8
+
+/** Maximal number of cells of the localization grid */
+#define PMMG_LOCATE_GRID_NCELL_MAX (1<<26)
+
+/** Number of rings of cells explored around the cell of a point once an
+ * element has been tested by a grid search */
+#define PMMG_LOCATE_GRID_RING 1
+
 /** \struct PMMG_locateStats
  *
  * \brief Struct containing the statistics of localization searches
@@ -49,21 +63,59 @@ typedef struct {
   int    stepmin;  /*!< minimum number of steps on the search paths */
 } PMMG_locateStats;
 
+/** \struct PMMG_locateGrid
+ *
+ * \brief Uniform grid over the background mesh, used to seed the localization
+ * walks and to replace the exhaustive searches. Each cell stores the elements
+ * whose bounding box intersects it.
+ *
+ */
+typedef struct {
+  double min[3];    /*!< lower corner of the grid */
+  double inv[3];    /*!< inverse of the cell sizes */
+  int    n[3];      /*!< number of cells in each direction */
+  int    *tetraOff; /*!< offsets of the cells in the \a tetra list */
+  int    *tetra;    /*!< list of the tetra of each cell */
+  int    *triaOff;  /*!< offsets of the cells in the \a tria list */
+  int    *tria;     /*!< list of the triangles of each cell */
+} PMMG_locateGrid;
+typedef PMMG_locateGrid * PMMG_pLocateGrid;
+
+/** \struct PMMG_locateMarks
+ *
+ * \brief Marks of the background entities visited by the localization of a
+ * point. The background mesh is only read during the localization, so points
+ * can be located concurrently by threads owning their own marks.
+ *
+ */
+typedef struct {
+  int *tetra; /*!< marks of the tetra */
+  int *tria;  /*!< marks of the triangles */
+  int *point; /*!< marks of the points */
+  int base;   /*!< value of the mark of the current localization */
+} PMMG_locateMarks;
+typedef PMMG_locateMarks * PMMG_pLocateMarks;
+
 int PMMG_precompute_triaNormals( MMG5_pMesh mesh,double *triaNormals );
 int PMMG_precompute_faceAreas( MMG5_pMesh mesh,double *faceAreas );
 int PMMG_precompute_nodeTrias( PMMG_pParMesh parmesh,MMG5_pMesh mesh,int **nodeTrias );
-int PMMG_locatePointInTria( MMG5_pMesh mesh,MMG5_pTria ptr,int k,MMG5_pPoint ppt,
+int PMMG_locateGrid_build( PMMG_pParMesh parmesh,MMG5_pMesh mesh,PMMG_pLocateGrid grid );
+void PMMG_locateGrid_free( PMMG_pParMesh parmesh,PMMG_pLocateGrid grid );
+int PMMG_locateMarks_init( PMMG_pParMesh parmesh,MMG5_pMesh mesh,PMMG_pLocateMarks marks );
+void PMMG_locateMarks_free( PMMG_pParMesh parmesh,PMMG_pLocateMarks marks );
+int PMMG_locatePointInTria( MMG5_pMesh mesh,PMMG_pLocateMarks marks,MMG5_pTria ptr,int k,MMG5_pPoint ppt,
                             double *triaNormal,PMMG_barycoord *barycoord,
                             double *h,double *closestDist,int *closestTria );
-int PMMG_locatePointInTetra( MMG5_pMesh mesh,MMG5_pTetra pt,int k,MMG5_pPoint ppt,
+int PMMG_locatePointInTetra( MMG5_pMesh mesh,PMMG_pLocateMarks marks,MMG5_pTetra pt,int k,MMG5_pPoint ppt,
                              double *faceAreas,PMMG_barycoord *barycoord,
                              double *closestDist,int *closestTet);
-int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
-                         double *triaNormals,int *nodeTrias,PMMG_barycoord *barycoord,
+int PMMG_locatePointBdy( MMG5_pMesh mesh,PMMG_pLocateMarks marks,MMG5_pPoint ppt,
+                         double *triaNormals,int *nodeTrias,PMMG_pLocateGrid grid,
+                         PMMG_barycoord *barycoord,
                          int *iTria,int *foundWedge,int *foundCone );
-int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
-                         double *faceAreas,PMMG_barycoord *barycoord,
-                         int *idxTet );
+int PMMG_locatePointVol( MMG5_pMesh mesh,PMMG_pLocateMarks marks,MMG5_pPoint ppt,
+                         double *faceAreas,PMMG_pLocateGrid grid,
+                         PMMG_barycoord *barycoord,int *idxTet );
 void PMMG_locatePoint_errorCheck( MMG5_pMesh mesh,int ip,int ier,int myrank,int igrp );
 void PMMG_locate_setStart( MMG5_pMesh mesh,MMG5_pMesh meshOld );
 void PMMG_locate_postprocessing( MMG5_pMesh mesh,MMG5_pMesh meshOld,PMMG_locateStats *locStats );
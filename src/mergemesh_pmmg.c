@@ -31,6 +31,7 @@
  *
  */
 #include "parmmg.h"
+#include "mpitypes_pmmg.h"
 #include "mpipack_pmmg.h"
 #include "mpiunpack_pmmg.h"
 #include "moveinterfaces_pmmg.h"
@@ -1072,6 +1073,112 @@ fail_ncomm:
   return 0;
 }
 
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param sndbuf buffer to send
+ * \param pack_size size of the buffer to send
+ * \param rcvbuf buffer in which we receive (only on root)
+ * \param rcv_pack_size sizes of the buffers to receive (only on root)
+ * \param displs displacements of the received buffers in \a rcvbuf (only on
+ * root)
+ *
+ * \return 0 if fail, 1 otherwise (only the allocation errors are reduced over
+ * the procs, before the communications)
+ *
+ * Gather the packed parmeshes on the root proc. An MPI_Gatherv is used if the
+ * received buffer fits in the int counts of mpi, point to point
+ * communications of big char data types otherwise.
+ *
+ */
+static inline
+int PMMG_gatherv_packedParmesh( PMMG_pParMesh parmesh,char *sndbuf,
+                                size_t pack_size,char *rcvbuf,
+                                size_t *rcv_pack_size,size_t *displs ) {
+  MPI_Request *request;
+  int         *icounts,*idispls;
+  int         ier,k,fit,nprocs,root;
+
+  nprocs = parmesh->nprocs;
+  root   = parmesh->info.root;
+  ier    = 1;
+
+  fit = 1;
+  if ( parmesh->myrank == root ) {
+    fit = ( displs[nprocs-1] + rcv_pack_size[nprocs-1] <= (size_t)INT_MAX );
+  }
+  MPI_CHECK( MPI_Bcast(&fit,1,MPI_INT,root,parmesh->comm), return 0 );
+
+  if ( fit ) {
+    icounts = idispls = NULL;
+    if ( parmesh->myrank == root ) {
+      PMMG_MALLOC( parmesh,icounts,nprocs,int,"icounts",ier=0 );
+      PMMG_MALLOC( parmesh,idispls,nprocs,int,"idispls",ier=0 );
+      if ( ier ) {
+        for ( k=0; k<nprocs; ++k ) {
+          icounts[k] = (int)rcv_pack_size[k];
+          idispls[k] = (int)displs[k];
+        }
+      }
+    }
+
+    /* The root must not enter the gather without its counts */
+    MPI_CHECK( MPI_Allreduce(MPI_IN_PLACE,&ier,1,MPI_INT,MPI_MIN,parmesh->comm),
+               ier = 0 );
+    if ( !ier ) {
+      PMMG_DEL_MEM(parmesh,icounts,int,"icounts");
+      PMMG_DEL_MEM(parmesh,idispls,int,"idispls");
+      return 0;
+    }
+
+    MPI_CHECK( MPI_Gatherv ( sndbuf,(int)pack_size,MPI_CHAR,
+                             rcvbuf,icounts,idispls,MPI_CHAR,
+                             root,parmesh->comm ),ier=0 );
+
+    PMMG_DEL_MEM(parmesh,icounts,int,"icounts");
+    PMMG_DEL_MEM(parmesh,idispls,int,"idispls");
+
+    return ier;
+  }
+
+  request = NULL;
+  PMMG_MALLOC( parmesh,request,parmesh->myrank == root ? nprocs : 1,MPI_Request,
+               "request",ier = 0 );
+  MPI_CHECK( MPI_Allreduce(MPI_IN_PLACE,&ier,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier = 0 );
+  if ( !ier ) {
+    PMMG_DEL_MEM(parmesh,request,MPI_Request,"request");
+    return 0;
+  }
+
+  if ( parmesh->myrank == root ) {
+    for ( k=0; k<nprocs; ++k ) {
+      request[k] = MPI_REQUEST_NULL;
+      if ( k == root ) {
+        memcpy(&rcvbuf[displs[k]],sndbuf,pack_size);
+      }
+      else if ( !PMMG_Irecv_bigChar(&rcvbuf[displs[k]],rcv_pack_size[k],k,
+                                    MPI_GATHERPARMESH_TAG,parmesh->comm,
+                                    &request[k]) ) {
+        ier = 0;
+      }
+    }
+    MPI_CHECK( MPI_Waitall(nprocs,request,MPI_STATUSES_IGNORE), ier = 0 );
+    PMMG_DEL_MEM(parmesh,request,MPI_Request,"request");
+  }
+  else {
+    if ( PMMG_Isend_bigChar(sndbuf,pack_size,root,MPI_GATHERPARMESH_TAG,
+                            parmesh->comm,request) ) {
+      MPI_CHECK( MPI_Wait(request,MPI_STATUS_IGNORE), ier = 0 );
+    }
+    else {
+      ier = 0;
+    }
+    PMMG_DEL_MEM(parmesh,request,MPI_Request,"request");
+  }
+
+  return ier;
+}
+
 /**
  * \param parmesh pointer toward the parmesh structure.
  * \param rcv_grps array of groups to allocate and fill.
@@ -1098,9 +1205,9 @@ int PMMG_gather_parmesh( PMMG_pParMesh parmesh,
                          int **rcv_next_node_comm,
                          PMMG_pExt_comm **rcv_ext_node_comm ) {
 
-  size_t     pack_size_tot;
-  int        *rcv_pack_size,ier,ier_glob,k,*displs,ier_pack;
-  int        nprocs,root,pack_size;
+  size_t     pack_size_tot,*rcv_pack_size,*displs,pack_size;
+  int        ier,ier_glob,k,ier_pack;
+  int        nprocs,root;
   char       *rcv_buffer,*buffer,*ptr;
 
   nprocs        = parmesh->nprocs;
@@ -1119,8 +1226,8 @@ int PMMG_gather_parmesh( PMMG_pParMesh parmesh,
 
   /** 1: Memory alloc */
   if ( parmesh->myrank == root ) {
-    PMMG_MALLOC( parmesh, rcv_pack_size        ,nprocs,int,"rcv_pack_size",ier=0);
-    PMMG_MALLOC( parmesh, displs               ,nprocs,int,"displs for gatherv",ier=0);
+    PMMG_MALLOC( parmesh, rcv_pack_size        ,nprocs,size_t,"rcv_pack_size",ier=0);
+    PMMG_MALLOC( parmesh, displs               ,nprocs,size_t,"displs for gatherv",ier=0);
     PMMG_CALLOC( parmesh, (*rcv_grps)          ,nprocs,PMMG_Grp,"rcv_grps",ier=0);
     PMMG_MALLOC( parmesh, (*rcv_int_node_comm) ,nprocs,PMMG_Int_comm,"rcv_int_comm" ,ier=0);
     PMMG_MALLOC( parmesh, (*rcv_next_node_comm),nprocs,int,"rcv_next_comm" ,ier=0);
@@ -1137,17 +1244,18 @@ int PMMG_gather_parmesh( PMMG_pParMesh parmesh,
   }
 #endif
 
-  MPI_CHECK(MPI_Gather(&pack_size,1,MPI_INT,rcv_pack_size,1,MPI_INT,root,parmesh->comm),ier = 0);
+  MPI_CHECK(MPI_Gather(&pack_size,1,MPI_PMMG_SIZE_T,rcv_pack_size,1,
+                       MPI_PMMG_SIZE_T,root,parmesh->comm),ier = 0);
 
   /** 3: Gather compressed parmeshes */
   /* Compute data for gatherv: displacement array and receiver buffer size */
   if ( parmesh->myrank == root ) {
     displs[0] = 0;
     for ( k=1; k<nprocs; ++k ) {
-      assert ( displs[k-1] <= INT_MAX - rcv_pack_size[k-1] && "INT_MAX overflow");
+      assert ( displs[k-1] <= SIZE_MAX - rcv_pack_size[k-1] && "SIZE_MAX overflow");
       displs[k] = displs[k-1] + rcv_pack_size[k-1];
     }
-    pack_size_tot        = (size_t)(displs[nprocs-1])+(size_t)(rcv_pack_size[nprocs-1]);
+    pack_size_tot        = displs[nprocs-1] + rcv_pack_size[nprocs-1];
     assert ( pack_size_tot < SIZE_MAX && "SIZE_MAX overflow" );
     PMMG_MALLOC( parmesh,rcv_buffer,pack_size_tot,char,"rcv_buffer",ier=0);
   }
@@ -1170,9 +1278,12 @@ int PMMG_gather_parmesh( PMMG_pParMesh parmesh,
 
   /* Gather the packed parmeshes */
   ier = MG_MIN ( ier, ier_pack );
-  MPI_CHECK( MPI_Gatherv ( ptr,pack_size,MPI_CHAR,
-                           rcv_buffer,rcv_pack_size,
-                           displs,MPI_CHAR,root,parmesh->comm ),ier=0 );
+  ier_pack = PMMG_gatherv_packedParmesh ( parmesh,ptr,pack_size,rcv_buffer,
+                                          rcv_pack_size,displs );
+  if ( parmesh->myrank != parmesh->info.root ) {
+    PMMG_trace_addBytes( parmesh,pack_size );
+  }
+  ier = MG_MIN ( ier, ier_pack );
 
   PMMG_DEL_MEM(parmesh,ptr,char,"buffer to send");
 
@@ -1196,8 +1307,8 @@ int PMMG_gather_parmesh( PMMG_pParMesh parmesh,
 
   /** Free the memory */
   /* Free temporary arrays */
-  PMMG_DEL_MEM(parmesh,rcv_pack_size,int,"rcv_pack_size");
-  PMMG_DEL_MEM(parmesh,displs,int,"displs");
+  PMMG_DEL_MEM(parmesh,rcv_pack_size,size_t,"rcv_pack_size");
+  PMMG_DEL_MEM(parmesh,displs,size_t,"displs");
   PMMG_DEL_MEM(parmesh,ptr ,char,"rcv_buffer");
 
   return ier;
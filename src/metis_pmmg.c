@@ -30,7 +30,9 @@
  * \copyright GNU Lesser General Public License.
  */
 #include "metis_pmmg.h"
+#include "sfc_pmmg.h"
 #include "linkedlist_pmmg.h"
+#include "mpipack_pmmg.h"
 
 /**
  * \param parmesh pointer toward the parmesh structure.
@@ -300,6 +302,50 @@ double PMMG_computeWgt( MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,int ifac )
   return res;
 }
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met  pointer toward the met structure.
+ * \param pt   pointer toward the tetrahedron structure.
+ *
+ * \return The weight value
+ *
+ * Compute an element weight predicting the remeshing work on the element: the
+ * number of elements that should fill it after adaptation, that is its volume
+ * in the metric divided by the volume of the unit regular tetrahedron
+ * (\f$\sqrt{2}/12\f$). The metric density is averaged over the element
+ * vertices. An element that will be coarsened still costs one unit of work.
+ *
+ */
+double PMMG_computeWorkWgt( MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt ) {
+  double       *m,vol,dens,det,h,res;
+  int          i;
+
+  if ( !met || !met->m ) return 1.0;
+
+  vol = fabs(MMG5_orvol(mesh->point,pt->v))/6.0;
+
+  dens = 0.0;
+  for( i=0; i<4; i++ ) {
+    if ( met->size == 6 ) {
+      m   = &met->m[6*pt->v[i]];
+      det = m[0]*(m[3]*m[5]-m[4]*m[4]) - m[1]*(m[1]*m[5]-m[2]*m[4])
+        + m[2]*(m[1]*m[4]-m[2]*m[3]);
+      if ( det <= 0.0 ) return 1.0;
+      dens += sqrt(det);
+    }
+    else {
+      h = met->m[pt->v[i]];
+      if ( h <= 0.0 ) return 1.0;
+      dens += 1.0/(h*h*h);
+    }
+  }
+  dens *= 0.25;
+
+  res = 12.0*vol*dens/sqrt(2.0);
+
+  return MG_MAX(1.0,MG_MIN(res,PMMG_WGTVAL_WORKMAX));
+}
+
 /**
  * \param parmesh pointer toward the parmesh structure.
  *
@@ -867,6 +913,9 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
   if( (parmesh->iter == parmesh->niter-1) && !parmesh->info.nobalancing ) {
     /* Switch off weights for output load balancing */
     *wgtflag = PMMG_WGTFLAG_NONE;
+  } else if ( parmesh->info.work_wgt ) {
+    /* Balance the predicted remeshing work of the groups */
+    *wgtflag = PMMG_WGTFLAG_BOTH;
   } else {
     /* Default weight choice for parmetis */
     *wgtflag = PMMG_WGTFLAG_DEF;
@@ -889,7 +938,8 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
   for ( k=1; k<=nproc; ++k )
     (*vtxdist)[k] += (*vtxdist)[k-1];
 
-  /** Step 2: Fill weights array with the number of MG_PARBDY face per group */
+  /** Step 2: Fill weights array with the number of MG_PARBDY face per group
+   * (or with the predicted remeshing work of the group) */
   PMMG_CALLOC(parmesh,*vwgt,ngrp,idx_t,"parmetis vwgt", goto fail_1);
 
   for ( igrp=0; igrp<ngrp; ++igrp ) {
@@ -900,6 +950,18 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
       continue;
     }
 
+    if ( *wgtflag == PMMG_WGTFLAG_BOTH ) {
+      met = parmesh->listgrp[igrp].met;
+      for ( k=1; k<=mesh->ne; ++k ) {
+        pt = &mesh->tetra[k];
+        if ( !MG_EOK(pt) ) continue;
+
+        (*vwgt)[igrp] += (idx_t)PMMG_computeWorkWgt(mesh,met,pt);
+      }
+      (*vwgt)[igrp] = MG_MAX((*vwgt)[igrp],1);
+      continue;
+    }
+
     for ( k=1; k<=mesh->ne; ++k ) {
       pt = &mesh->tetra[k];
       if ( !MG_EOK(pt) ) continue;
@@ -1258,6 +1320,26 @@ fail_1:
   return 0;
 }
 
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part pointer of an array containing the partitions (at the end)
+ * \param nproc number of partitions asked
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Partition the first mesh in the list of meshes into nproc groups with the
+ * partitioner selected by the load balancing mode (metis or space filling
+ * curve).
+ *
+ */
+int PMMG_part_meshElts( PMMG_pParMesh parmesh, idx_t* part, idx_t nproc )
+{
+  if ( parmesh->info.loadbalancing_mode == PMMG_LOADBALANCING_sfc ) {
+    return PMMG_part_meshElts2sfc( parmesh, part, nproc );
+  }
+  return PMMG_part_meshElts2metis( parmesh, part, nproc );
+}
+
 /**
  * \param parmesh pointer toward the parmesh structure
  * \param part pointer of an array containing the partitions (at the end)
@@ -1281,6 +1363,7 @@ int PMMG_part_meshElts2metis( PMMG_pParMesh parmesh, idx_t* part, idx_t nproc )
   idx_t      objval = 0;
   int        ier = 0;
   int        status = 1;
+  int        k;
 
   xadj = adjncy = vwgt = adjwgt = NULL;
 
@@ -1293,6 +1376,18 @@ int PMMG_part_meshElts2metis( PMMG_pParMesh parmesh, idx_t* part, idx_t nproc )
   if ( !PMMG_graph_meshElts2metis(parmesh,mesh,met,&xadj,&adjncy,&adjwgt,&adjsize) )
     return 0;
 
+  /** Weight the graph nodes by the predicted remeshing work (except for the
+   * output load balancing, see PMMG_graph_parmeshGrps2parmetis) */
+  if ( parmesh->info.work_wgt && met && met->m &&
+       !( (parmesh->iter == parmesh->niter-1) && !parmesh->info.nobalancing ) ) {
+    PMMG_MALLOC(parmesh,vwgt,nelt,idx_t,"vwgt",
+                PMMG_DEL_MEM(parmesh, adjwgt, idx_t, "deallocate adjwgt" );
+                PMMG_DEL_MEM(parmesh, adjncy, idx_t, "deallocate adjncy" );
+                PMMG_DEL_MEM(parmesh, xadj, idx_t, "deallocate xadj" );
+                return 0);
+    for ( k=1; k<=nelt; ++k )
+      vwgt[k-1] = (idx_t)PMMG_computeWorkWgt(mesh,met,&mesh->tetra[k]);
+  }
 
   /** Call metis and get the partition array */
   if( nproc >= 8 ) {
@@ -1323,6 +1418,7 @@ int PMMG_part_meshElts2metis( PMMG_pParMesh parmesh, idx_t* part, idx_t nproc )
   /** Correct partitioning to avoid empty partitions */
   if( !PMMG_correct_meshElts2metis( parmesh,part,nelt,nproc ) ) return 0;
 
+  PMMG_DEL_MEM(parmesh, vwgt, idx_t, "deallocate vwgt" );
   PMMG_DEL_MEM(parmesh, adjwgt, idx_t, "deallocate adjwgt" );
   PMMG_DEL_MEM(parmesh, adjncy, idx_t, "deallocate adjncy" );
   PMMG_DEL_MEM(parmesh, xadj, idx_t, "deallocate xadj" );
@@ -1555,15 +1651,18 @@ int PMMG_part_parmeshGrps2metis( PMMG_pParMesh parmesh,idx_t* part,idx_t nproc )
  * \return  1 if success, 0 if fail
  *
  * Use parmetis to partition the first mesh in the list of meshes into nproc
- * groups
+ * groups. If an adaptive repartitioning ratio is provided, the current
+ * partition is improved by the adaptive repartitioning of parmetis, each group
+ * being weighted by its migration volume.
  *
  */
 int PMMG_part_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t* part,idx_t nproc )
 {
-  real_t     *tpwgts,*ubvec;
-  idx_t      *xadj,*adjncy,*vwgt,*adjwgt,*vtxdist,adjsize,edgecut;
-  idx_t      wgtflag,numflag,ncon,options[3];
-  int        ngrp,nprocs,ier;
+  real_t     *tpwgts,*ubvec,itr;
+  idx_t      *xadj,*adjncy,*vwgt,*adjwgt,*vtxdist,*vsize,adjsize,edgecut;
+  idx_t      wgtflag,numflag,ncon,options[4];
+  size_t     grpsize;
+  int        ngrp,nprocs,igrp,ier;
 
   ngrp   = parmesh->ngrp;
   nprocs = parmesh->nprocs;
@@ -1582,7 +1681,39 @@ int PMMG_part_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t* part,idx_t npro
   }
 
   /** Call parmetis and get the partition array */
-  if ( 2 < nprocs + ngrp ) {
+  if ( (2 < nprocs + ngrp) && (parmesh->info.itr_ratio > 0.) ) {
+    /* Start from the current partition, the migration volume of each group
+     * being its packed size */
+    vsize = NULL;
+    PMMG_CALLOC(parmesh,vsize,ngrp+1,idx_t,"parmetis vsize",ier = 0);
+
+    /* Parmetis call is collective */
+    MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, parmesh->comm);
+
+    if ( ier ) {
+      for ( igrp=0; igrp<ngrp; ++igrp ) {
+        grpsize      = PMMG_mpisizeof_grp( &parmesh->listgrp[igrp] );
+        vsize[igrp]  = (idx_t)MG_MAX( 1,grpsize/PMMG_VSIZE_UNIT );
+        part[igrp]   = parmesh->myrank;
+      }
+
+      itr        = parmesh->info.itr_ratio;
+      options[0] = 1;
+      options[1] = 0;
+      options[2] = 0;
+      options[3] = PARMETIS_PSR_UNCOUPLED;
+
+      if ( ParMETIS_V3_AdaptiveRepart( vtxdist,xadj,adjncy,vwgt,vsize,adjwgt,
+                                       &wgtflag,&numflag,&ncon,&nproc,tpwgts,
+                                       ubvec,&itr,options,&edgecut,part,
+                                       &parmesh->comm) != METIS_OK ) {
+        fprintf(stderr,"\n  ## Error: Parmetis adaptive repartitioning fails.\n" );
+        ier = 0;
+      }
+    }
+    PMMG_DEL_MEM(parmesh, vsize, idx_t, "parmetis vsize" );
+  }
+  else if ( 2 < nprocs + ngrp ) {
     if ( ParMETIS_V3_PartKway( vtxdist,xadj,adjncy,vwgt,adjwgt,&wgtflag,&numflag,
                                &ncon,&nproc,tpwgts,ubvec,options,&edgecut,part,
                                &parmesh->comm) != METIS_OK ) {
@@ -63,6 +63,15 @@
  */
 #define PMMG_WGTVAL_HUGEINT   1000000
 
+/**
+ * \def PMMG_WGTVAL_WORKMAX
+ *
+ * Maximal predicted work weight of an element (to avoid the overflow of the
+ * sum of the weights)
+ *
+ */
+#define PMMG_WGTVAL_WORKMAX   1000
+
 /**
  * \def PMMG_UBVEC_DEF
  *
@@ -71,6 +80,15 @@
  */
 #define PMMG_UBVEC_DEF     1.05
 
+/**
+ * \def PMMG_VSIZE_UNIT
+ *
+ * size (in bytes) of the unit of the migration weights of the groups in the
+ * adaptive repartitioning of ParMetis
+ *
+ */
+#define PMMG_VSIZE_UNIT    1024
+
 /**
  * \def PMMG_CONTIG_DEF
  *
@@ -114,6 +132,7 @@ typedef struct {
 int PMMG_checkAndReset_grps_contiguity( PMMG_pParMesh parmesh );
 int PMMG_check_grps_contiguity( PMMG_pParMesh parmesh );
 int PMMG_graph_meshElts2metis(PMMG_pParMesh,MMG5_pMesh,MMG5_pSol,idx_t**,idx_t**,idx_t**,idx_t*);
+int PMMG_part_meshElts( PMMG_pParMesh,idx_t*,idx_t);
 int PMMG_part_meshElts2metis( PMMG_pParMesh,idx_t*,idx_t);
 int PMMG_graph_parmeshGrps2parmetis(PMMG_pParMesh,idx_t**,idx_t**,idx_t**,idx_t*,
                                     idx_t**,idx_t**,idx_t*,idx_t*,idx_t*,idx_t,
@@ -820,17 +820,21 @@ int PMMG_check_reachability( PMMG_pParMesh parmesh,int *counter ) {
  * \param ip local index of the point in the tetrahedra \a start.
  * \param list pointer toward the list of the tetra in the volumic ball of
  * \a ip.
+ * \param next list of the points of the next front.
+ * \param nnext number of points in \a next (updated).
  * \return 0 if fail and the number of the tetra in the ball otherwise.
  *
  * Fill the volumic ball (i.e. filled with tetrahedra) of point \a ip in tetra
  * \a start. Results are stored under the form \f$4*kel + jel\f$, kel = number
  * of the tetra, jel = local index of p within kel.
  * Mark each tetrahedron in the ball with the highest priority color between
- * its own color and the color brought by the point.
+ * its own color and the color brought by the point. The points newly flagged
+ * as next front points are appended to \a next.
  *
  */
 int PMMG_mark_boulevolp( PMMG_pParMesh parmesh,MMG5_pMesh mesh,int *displsgrp,
-    int *mapgrp,int *negrp,int *nemin,int base_front,int ip,int * list){
+    int *mapgrp,int *negrp,int *nemin,int base_front,int ip,int * list,
+    int *next,int *nnext){
   MMG5_pTetra  pt,pt1;
   MMG5_pPoint  ppt1;
   int    *adja,nump,ilist,base,cur,k,k1,j1,j2;
@@ -870,7 +874,10 @@ int PMMG_mark_boulevolp( PMMG_pParMesh parmesh,MMG5_pMesh mesh,int *displsgrp,
           ppt1->tmp  = color;
           ppt1->s    = 4*start+j2;
         }
-        ppt1->flag = base_front+2;
+        if ( ppt1->flag != base_front+2 ) {
+          next[(*nnext)++] = pt->v[j2];
+          ppt1->flag = base_front+2;
+        }
       }
       else
         ppt1->flag = base_front+1;
@@ -914,7 +921,10 @@ int PMMG_mark_boulevolp( PMMG_pParMesh parmesh,MMG5_pMesh mesh,int *displsgrp,
               ppt1->tmp  = color;
               ppt1->s    = 4*k1+j2;
             }
-            ppt1->flag = base_front+2;
+            if ( ppt1->flag != base_front+2 ) {
+              next[(*nnext)++] = pt1->v[j2];
+              ppt1->flag = base_front+2;
+            }
           }
           else
             ppt1->flag = base_front+1;
@@ -1014,24 +1024,33 @@ int PMMG_mark_sideFront_ppt( PMMG_pParMesh parmesh,MMG5_pMesh mesh,int ip,
  * \param displsgrp sparse representation of the number or groups.
  * \param mapgrp groups priority map.
  * \param list preallocated list for tetras in the point ball.
+ * \param front list of the points of the current front (sorted).
+ * \param nfront number of points in \a front.
+ * \param next list of the points of the next front.
+ * \param nnext number of points in \a next (updated).
  * \return 0 if fail, 1 if success.
  *
- * Mark the intersection of two advancing interfaces.
+ * Mark the intersection of two advancing interfaces. The points of the front
+ * side are kept in the next front.
  *
  */
 int PMMG_mark_sideFront( PMMG_pParMesh parmesh,MMG5_pMesh mesh,int base_front,
-                         int *displsgrp,int *mapgrp,int *list ) {
+                         int *displsgrp,int *mapgrp,int *list,
+                         int *front,int nfront,int *next,int *nnext ) {
   MMG5_pPoint ppt;
-  int         ip;
+  int         ip,i;
 
-  /* Search and mark points on the front side */
-  for( ip = 1; ip <= mesh->np; ip++ ) {
+  /* Search and mark points on the front side (only the points of the current
+   * front may have been flagged as base_front+1) */
+  for( i = 0; i < nfront; i++ ) {
+    ip  = front[i];
     ppt = &mesh->point[ip];
 
     if( ppt->flag != base_front+1 ) continue;
     if( !PMMG_mark_sideFront_ppt( parmesh, mesh, ip, displsgrp, mapgrp, list ) )
       return 0;
     ppt->flag++;
+    next[(*nnext)++] = ip;
   }
 
   return 1;
@@ -1211,19 +1230,45 @@ int PMMG_part_getInterfaces( PMMG_pParMesh parmesh,int *part,int *ngrps,int targ
   return count;
 }
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ *
+ * \return the predicted remeshing work of the mesh (at least 1).
+ *
+ * Sum the predicted remeshing work of the mesh elements, that is the number of
+ * elements expected in the mesh after adaptation.
+ *
+ */
+static int PMMG_get_grpWork( MMG5_pMesh mesh,MMG5_pSol met ) {
+  double work;
+  int    k;
+
+  work = 0.;
+  for( k = 1; k <= mesh->ne; k++ ) {
+    if( !MG_EOK(&mesh->tetra[k]) ) continue;
+    work += PMMG_computeWorkWgt( mesh,met,&mesh->tetra[k] );
+  }
+
+  return (int)MG_MAX( 1.,MG_MIN( work,(double)INT_MAX ) );
+}
+
 /**
  * \param parmesh pointer toward a parmesh structure
  * \param displsgrp sparse representation of the nb of old groups
- * \param mapgrp sparse array for the number of elements in the old groups
+ * \param mapgrp sparse array for the size of the old groups
  *
  * \return 0 if fail, 1 if success.
  *
- * Initialize an array with the number of elements in each group (to be called
- * before group merging).
+ * Initialize an array with the size of each group (to be called before group
+ * merging). The size of a group is its number of elements, or its predicted
+ * remeshing work if the work weighting is asked and a metric is provided, so
+ * the interfaces move from the most loaded groups toward the least loaded ones.
  *
  */
 int PMMG_init_ifcDirection( PMMG_pParMesh parmesh,int **displsgrp,int **mapgrp ) {
   MMG5_pMesh     mesh;
+  MMG5_pSol      met;
   MPI_Comm       comm;
   int            ngrp,nproc,myrank,k,igrp;
 
@@ -1244,11 +1289,18 @@ int PMMG_init_ifcDirection( PMMG_pParMesh parmesh,int **displsgrp,int **mapgrp )
 
   PMMG_CALLOC(parmesh,*mapgrp,(*displsgrp)[nproc],int,"mapgrp", return 0);
 
-  /** Step 2: Store the nb of tetra for each local group */
+  /** Step 2: Store the nb of tetra (or the predicted work) for each local
+   * group */
   for( igrp = 0; igrp < ngrp; igrp++ ) {
     mesh = parmesh->listgrp[igrp].mesh;
+    met  = parmesh->listgrp[igrp].met;
     assert(mesh->ne);
-    (*mapgrp)[ igrp + (*displsgrp)[myrank] ] = mesh->ne;
+    if ( parmesh->info.work_wgt && met && met->m ) {
+      (*mapgrp)[ igrp + (*displsgrp)[myrank] ] = PMMG_get_grpWork( mesh,met );
+    }
+    else {
+      (*mapgrp)[ igrp + (*displsgrp)[myrank] ] = mesh->ne;
+    }
   }
 
   return 1;
@@ -1257,11 +1309,11 @@ int PMMG_init_ifcDirection( PMMG_pParMesh parmesh,int **displsgrp,int **mapgrp )
 /**
  * \param parmesh pointer toward a parmesh structure
  * \param displsgrp sparse representation of the nb of old groups
- * \param mapgrp sparse array for the number of elements in the old groups
+ * \param mapgrp sparse array for the size of the old groups
  *
  * \return 0 if fail, 1 if success.
  *
- * Complete the array with the number of elements in each old group.
+ * Complete the array with the size of each old group.
  *
  */
 int PMMG_set_ifcDirection( PMMG_pParMesh parmesh,int **displsgrp,int **mapgrp ) {
@@ -1293,6 +1345,21 @@ fail:
   return 0;
 }
 
+/**
+ * \param a pointer toward an integer.
+ * \param b pointer toward an integer.
+ * \return -1 if a<b, 1 if a>b, 0 otherwise.
+ *
+ * Compare two point indices (to process the front points in increasing order).
+ *
+ */
+static int PMMG_compare_frontPoints( const void *a,const void *b ) {
+  int ia = *(int*)a;
+  int ib = *(int*)b;
+
+  return (ia > ib) - (ia < ib);
+}
+
 /**
  * \param parmesh pointer toward a parmesh structure.
  * \param displsgrp sparse representation of the number of groups.
@@ -1300,12 +1367,15 @@ fail:
  * \param base_front label of the current interface front points.
  * \return 0 if fail, 1 if success.
  *
- * Move old groups interfaces through an advancing-front method.
+ * Move old groups interfaces through an advancing-front method. The points of
+ * the current and next fronts are stored in work queues, so each layer only
+ * visits the points of its front (and the parallel interface points).
  *
  */
 int PMMG_part_moveInterfaces( PMMG_pParMesh parmesh,int *displsgrp,int *mapgrp,int *base_front ) {
   PMMG_pGrp    grp;
   MMG5_pMesh   mesh;
+  MMG5_pTetra  pt;
   MMG5_pPoint  ppt;
   PMMG_pInt_comm int_node_comm;
   PMMG_pExt_comm ext_node_comm;
@@ -1314,6 +1384,8 @@ int PMMG_part_moveInterfaces( PMMG_pParMesh parmesh,int *displsgrp,int *mapgrp,i
   int          *node2int_node_comm_index1,*node2int_node_comm_index2;
   int          *intvalues,*itosend,*itorecv;
   int          *negrp,*nemin;
+  int          *front,*next,*tmp,nfront,nnext;
+  size_t       arenaMark;
   int          ilayer;
   int          nprocs,ngrp;
   int          igrp,k,i,idx,ip,nitem,color;
@@ -1334,12 +1406,18 @@ int PMMG_part_moveInterfaces( PMMG_pParMesh parmesh,int *displsgrp,int *mapgrp,i
    *  been set.
    */
 
-  /* Get number of tetrahedra on the local partition, and set the minimum
+  /* Get number of tetrahedra on the local partition (from the tetra colors, as
+   * the priority map may store the groups work instead), and set the minimum
    * number of tetrahedra to keep in each group. */
   PMMG_CALLOC( parmesh,negrp,parmesh->nold_grp,int,"negrp",return 0);
   PMMG_CALLOC( parmesh,nemin,parmesh->nold_grp,int,"nemin",return 0);
+  for( k = 1; k <= mesh->ne; k++ ) {
+    pt = &mesh->tetra[k];
+    if( !MG_EOK(pt) ) continue;
+    assert( PMMG_get_proc( parmesh,pt->mark ) == parmesh->myrank );
+    negrp[PMMG_get_grp( parmesh,pt->mark )]++;
+  }
   for( igrp = 0; igrp < parmesh->nold_grp; igrp++ ) {
-    negrp[igrp] = mapgrp[igrp+displsgrp[parmesh->myrank]];
     nemin[igrp] = MG_MIN( PMMG_REDISTR_NELEM_MIN, negrp[igrp]/2+1 );
   }
 
@@ -1362,7 +1440,29 @@ int PMMG_part_moveInterfaces( PMMG_pParMesh parmesh,int *displsgrp,int *mapgrp,i
     PMMG_CALLOC(parmesh,ext_node_comm->itorecv,nitem,int,"itorecv array",
                 return 0);
   }
- 
+
+  /* Work queues of the current and next fronts (a point enters a queue at
+   * most once per layer) */
+  arenaMark = PMMG_arena_mark( parmesh );
+  PMMG_ARENA_MALLOC( parmesh,front,mesh->np+1,int,"front points",return 0 );
+  PMMG_ARENA_MALLOC( parmesh,next,mesh->np+1,int,"next front points",
+                     PMMG_arena_release( parmesh,arenaMark );return 0 );
+
+  /* First front: points flagged by the interface marking. Reset the flags that
+   * could be mistaken for the labels of the next fronts. */
+  nfront = nnext = 0;
+  for( ip = 1; ip <= mesh->np; ip++ ) {
+    ppt = &mesh->point[ip];
+    if( !MG_VOK(ppt) ) continue;
+
+    if( (ppt->flag == *base_front) || (ppt->flag == (*base_front)+1) ) {
+      front[nfront++] = ip;
+    }
+    else if( ppt->flag > (*base_front)+1 ) {
+      ppt->flag = 0;
+    }
+  }
+
   /* Move interfaces */
   for( ilayer = 0; ilayer < parmesh->info.ifc_layers; ilayer++ ) {
 
@@ -1392,7 +1492,8 @@ int PMMG_part_moveInterfaces( PMMG_pParMesh parmesh,int *displsgrp,int *mapgrp,i
       MPI_CHECK(
         MPI_Sendrecv(itosend,nitem,MPI_INT,color,MPI_PARMESHGRPS2PARMETIS_TAG+3,
                      itorecv,nitem,MPI_INT,color,MPI_PARMESHGRPS2PARMETIS_TAG+3,
-                     comm,&status),return 0 );
+                     comm,&status),
+        PMMG_arena_release( parmesh,arenaMark );return 0 );
 
       for ( i=0; i<nitem; ++i ) {
         idx            = ext_node_comm->int_comm_index[i];
@@ -1402,28 +1503,32 @@ int PMMG_part_moveInterfaces( PMMG_pParMesh parmesh,int *displsgrp,int *mapgrp,i
       }
     }
 
-    /* Update grp index and proc after communication */
+    /* Update grp index and proc after communication (parallel interface points
+     * are always in the front) */
     for( i = 0; i < grp->nitem_int_node_comm; i++ ) {
       idx = node2int_node_comm_index2[i];
       ip  = node2int_node_comm_index1[i];
       ppt = &mesh->point[ip];
       assert( MG_VOK(ppt) );
       ppt->tmp = intvalues[idx];
+      if( (ppt->flag != *base_front) && (ppt->flag != (*base_front)+1) ) {
+        front[nfront++] = ip;
+      }
       ppt->flag = *base_front;
     }
 
-    /* Mark tetra in the ball of interface points */
-    for( ip = 1; ip <= mesh->np; ip++ ) {
-      ppt = &mesh->point[ip];
-      if( !MG_VOK(ppt) ) continue;
+    /* Process the front points in increasing order */
+    qsort( front,nfront,sizeof(int),PMMG_compare_frontPoints );
 
-      /* Skip not-interface points */
-      if( (ppt->flag != *base_front) && (ppt->flag != (*base_front)+1)) continue;
+    /* Mark tetra in the ball of interface points */
+    nnext = 0;
+    for( i = 0; i < nfront; i++ ) {
+      ip = front[i];
 
       /* Advance the front: New interface points will be flagged as
-       * base_front+1 */
+       * base_front+2 and stored in the next front */
       ier = PMMG_mark_boulevolp( parmesh, mesh, displsgrp, mapgrp, negrp, nemin,
-                                 *base_front, ip, list);
+                                 *base_front, ip, list, next, &nnext );
       if( !ier ) break;
 
     }
@@ -1431,13 +1536,21 @@ int PMMG_part_moveInterfaces( PMMG_pParMesh parmesh,int *displsgrp,int *mapgrp,i
 
     /* Check front "sides" (i.e. intersection of several interfaces) to be sure
      * of moving them */
-    ier = PMMG_mark_sideFront( parmesh, mesh, *base_front, displsgrp, mapgrp, list );
+    ier = PMMG_mark_sideFront( parmesh, mesh, *base_front, displsgrp, mapgrp, list,
+                               front, nfront, next, &nnext );
     if( !ier ) break;
 
-    /* Update flag base for next wave */
+    /* Update flag base and front for next wave */
     *base_front = (*base_front)+2;
+
+    tmp    = front;
+    front  = next;
+    next   = tmp;
+    nfront = nnext;
   }
 
+  PMMG_arena_release( parmesh,arenaMark );
+
 #ifndef NDEBUG
   PMMG_check_contiguity( parmesh,0 );
 #endif
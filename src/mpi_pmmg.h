@@ -34,6 +34,7 @@
  *
  */
 #include <mpi.h>
+#include <stdint.h>
 
 #define MPI_COMMUNICATORS_NODE_TAG      1000
 #define MPI_COMMUNICATORS_EDGE_TAG      1001
@@ -47,6 +48,18 @@
 #define MPI_TRANSFER_GRP_TAG            8000
 #define MPI_COMMUNICATORS_REF_TAG       9000
 #define MPI_ANALYS_TAG                 10000
+#define MPI_GATHERPARMESH_TAG          11000
+
+/** Size (in chars) of the chunks used to communicate buffers whose size
+ * overflows the int counts of mpi */
+#define PMMG_MPI_CHUNK_SIZE            (1<<30)
+
+/** Mpi datatype of a size_t variable */
+#if SIZE_MAX == UINT64_MAX
+#define MPI_PMMG_SIZE_T MPI_UINT64_T
+#else
+#define MPI_PMMG_SIZE_T MPI_UINT32_T
+#endif
 
 
 #define MPI_CHECK(func_call,on_failure) do {                            \
@@ -41,12 +41,12 @@
  *
  */
 static
-int PMMG_mpisizeof_meshSizes ( PMMG_pGrp grp ) {
+size_t PMMG_mpisizeof_meshSizes ( PMMG_pGrp grp ) {
   const MMG5_pMesh mesh = grp->mesh;
   const MMG5_pSol  met  = grp->met;
   const MMG5_pSol  ls   = grp->ls;
   const MMG5_pSol  disp = grp->disp;
-  int              idx = 0;
+  size_t           idx = 0;
 
   /** Mesh size */
   idx += sizeof(int); // mesh->np
@@ -91,14 +91,14 @@ int PMMG_mpisizeof_meshSizes ( PMMG_pGrp grp ) {
  *
  */
 static
-int PMMG_mpisizeof_filenames ( PMMG_pGrp grp ) {
+size_t PMMG_mpisizeof_filenames ( PMMG_pGrp grp ) {
   const MMG5_pMesh mesh = grp->mesh;
   const MMG5_pSol  met  = grp->met;
   const MMG5_pSol  ls   = grp->ls;
   const MMG5_pSol  disp = grp->disp;
   MMG5_pSol        psl;
   int              is;
-  int              idx = 0;
+  size_t           idx = 0;
 
   /** Mesh names */
   idx += sizeof(int); // meshin
@@ -156,8 +156,8 @@ int PMMG_mpisizeof_filenames ( PMMG_pGrp grp ) {
  *
  */
 static
-int PMMG_mpisizeof_infos ( MMG5_Info *info ) {
-  int idx = 0;
+size_t PMMG_mpisizeof_infos ( MMG5_Info *info ) {
+  size_t idx = 0;
 
   /** Mesh infos: warning, some "useless" info are not sended */
   idx += sizeof(double); // mesh->info.dhd
@@ -229,13 +229,13 @@ int PMMG_mpisizeof_infos ( MMG5_Info *info ) {
  *
  */
 static
-int PMMG_mpisizeof_meshArrays ( PMMG_pGrp grp ) {
+size_t PMMG_mpisizeof_meshArrays ( PMMG_pGrp grp ) {
   const MMG5_pMesh mesh = grp->mesh;
   const MMG5_pSol  met  = grp->met;
   const MMG5_pSol  ls   = grp->ls;
   const MMG5_pSol  disp = grp->disp;
   MMG5_pSol        psl;
-  int              idx = 0;
+  size_t           idx = 0;
   int              is;
 
   /** Pack mesh points */
@@ -317,16 +317,16 @@ int PMMG_mpisizeof_meshArrays ( PMMG_pGrp grp ) {
 
   /** Pack metric */
   if ( met && met->m ) {
-    idx += met->size*met->np*sizeof(double); // met->m;
+    idx += (size_t)met->size*met->np*sizeof(double); // met->m;
   }
 
   /** Pack ls */
   if ( ls && ls->m ) {
-    idx += ls->size*ls->np*sizeof(double); // ls->m;
+    idx += (size_t)ls->size*ls->np*sizeof(double); // ls->m;
   }
   /** Pack disp */
   if ( disp && disp->m ) {
-    idx += disp->size*disp->np*sizeof(double); // disp->m;
+    idx += (size_t)disp->size*disp->np*sizeof(double); // disp->m;
   }
 
   /** Pack Fields  */
@@ -334,7 +334,7 @@ int PMMG_mpisizeof_meshArrays ( PMMG_pGrp grp ) {
     assert ( grp->field );
     for ( is=0; is<mesh->nsols; ++is ) {
       psl = &grp->field[is];
-      idx += psl->size*psl->np*sizeof(double); // psl->m;
+      idx += (size_t)psl->size*psl->np*sizeof(double); // psl->m;
     }
   }
 
@@ -350,8 +350,8 @@ int PMMG_mpisizeof_meshArrays ( PMMG_pGrp grp ) {
  *
  */
 static
-int PMMG_mpisizeof_grpintcomm ( PMMG_pGrp grp ) {
-  int              idx = 0;
+size_t PMMG_mpisizeof_grpintcomm ( PMMG_pGrp grp ) {
+  size_t           idx = 0;
 
   /** Pack communicators */
   /* Communicator sizes */
@@ -377,8 +377,8 @@ int PMMG_mpisizeof_grpintcomm ( PMMG_pGrp grp ) {
  *
  */
 static
-int PMMG_mpisizeof_nodeintvalues ( PMMG_pParMesh parmesh ) {
-  int              idx = 0;
+size_t PMMG_mpisizeof_nodeintvalues ( PMMG_pParMesh parmesh ) {
+  size_t           idx = 0;
 
   /** Pack intvalues array of nodal communicator */
   /* Array size */
@@ -399,9 +399,10 @@ int PMMG_mpisizeof_nodeintvalues ( PMMG_pParMesh parmesh ) {
  *
  */
 static
-int PMMG_mpisizeof_extnodecomm ( PMMG_pParMesh parmesh ) {
+size_t PMMG_mpisizeof_extnodecomm ( PMMG_pParMesh parmesh ) {
   PMMG_pExt_comm ext_node_comm;
-  int            k,idx = 0;
+  size_t         idx = 0;
+  int            k;
 
   /** Pack nodal external communicators */
   /* Number of external communicators */
@@ -428,10 +429,10 @@ int PMMG_mpisizeof_extnodecomm ( PMMG_pParMesh parmesh ) {
  * Compute the size of the compressed group.
  *
  */
-int PMMG_mpisizeof_grp ( PMMG_pGrp grp ) {
+size_t PMMG_mpisizeof_grp ( PMMG_pGrp grp ) {
   const MMG5_pMesh mesh = grp->mesh;
 
-  int idx;
+  size_t idx;
 
   /** Used or unused group */
   idx = sizeof(int);
@@ -466,9 +467,9 @@ int PMMG_mpisizeof_grp ( PMMG_pGrp grp ) {
  * before entering this function).
  *
  */
-int PMMG_mpisizeof_parmesh ( PMMG_pParMesh parmesh ) {
+size_t PMMG_mpisizeof_parmesh ( PMMG_pParMesh parmesh ) {
   PMMG_pGrp grp;
-  int       idx;
+  size_t    idx;
 
   assert ( parmesh->ngrp < 2 ); // Check that groups are merged
 
@@ -907,7 +908,7 @@ void PMMG_mpipack_meshArrays ( PMMG_pGrp grp,char **buffer ) {
   if ( met && met->m ) {
     for ( k=1; k<=met->np; ++k ) {
       for ( i=0; i<met->size; ++i ) {
-        *( (double *) tmp) = met->m[met->size*k + i]; tmp += sizeof(double);
+        *( (double *) tmp) = met->m[(size_t)met->size*k + i]; tmp += sizeof(double);
       }
     }
   }
@@ -916,7 +917,7 @@ void PMMG_mpipack_meshArrays ( PMMG_pGrp grp,char **buffer ) {
   if ( ls && ls->m ) {
     for ( k=1; k<=ls->np; ++k ) {
       for ( i=0; i<ls->size; ++i ) {
-        *( (double *) tmp) = ls->m[ls->size*k + i]; tmp += sizeof(double);
+        *( (double *) tmp) = ls->m[(size_t)ls->size*k + i]; tmp += sizeof(double);
       }
     }
   }
@@ -925,7 +926,7 @@ void PMMG_mpipack_meshArrays ( PMMG_pGrp grp,char **buffer ) {
   if ( disp && disp->m ) {
     for ( k=1; k<=disp->np; ++k ) {
       for ( i=0; i<disp->size; ++i ) {
-        *( (double *) tmp) = disp->m[disp->size*k + i]; tmp += sizeof(double);
+        *( (double *) tmp) = disp->m[(size_t)disp->size*k + i]; tmp += sizeof(double);
       }
     }
   }
@@ -936,7 +937,7 @@ void PMMG_mpipack_meshArrays ( PMMG_pGrp grp,char **buffer ) {
       psl = &grp->field[is];
       for ( k=1; k<=psl->np; ++k ) {
         for ( i=0; i<psl->size; ++i ) {
-          *( (double *) tmp) = psl->m[psl->size*k + i]; tmp += sizeof(double);
+          *( (double *) tmp) = psl->m[(size_t)psl->size*k + i]; tmp += sizeof(double);
         }
       }
     }
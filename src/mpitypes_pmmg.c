@@ -356,6 +356,115 @@ int PMMG_create_MPI_xTetra(MPI_Datatype *mpi_xtetra)
   return 1;
 }
 
+/**
+ * \param count number of chars of the buffer to communicate
+ * \param mpi_bigchar new MPI data type
+ *
+ * \return 0 if fail, 1 if success
+ *
+ * Create an MPI data type that describes a buffer of \a count chars, \a count
+ * being possibly larger than INT_MAX: the buffer is described by a block of
+ * chunks of \a PMMG_MPI_CHUNK_SIZE chars followed by the remaining chars.
+ *
+ */
+int PMMG_create_MPI_bigChar(size_t count,MPI_Datatype *mpi_bigchar)
+{
+  MPI_Datatype mpi_chunk;
+  MPI_Aint     displs[2];
+  MPI_Datatype types[2];
+  int          blck_lengths[2];
+
+  MPI_CHECK( MPI_Type_contiguous(PMMG_MPI_CHUNK_SIZE,MPI_CHAR,&mpi_chunk),
+             return 0);
+
+  blck_lengths[0] = (int)(count / PMMG_MPI_CHUNK_SIZE);
+  blck_lengths[1] = (int)(count % PMMG_MPI_CHUNK_SIZE);
+  displs[0]       = 0;
+  displs[1]       = (MPI_Aint)blck_lengths[0]*PMMG_MPI_CHUNK_SIZE;
+  types[0]        = mpi_chunk;
+  types[1]        = MPI_CHAR;
+
+  MPI_CHECK( MPI_Type_create_struct(2, blck_lengths, displs, types, mpi_bigchar),
+             MPI_Type_free(&mpi_chunk);return 0);
+  MPI_Type_free(&mpi_chunk);
+
+  MPI_CHECK( MPI_Type_commit(mpi_bigchar),return 0);
+
+  return 1;
+}
+
+/**
+ * \param buf buffer to send
+ * \param count number of chars of the buffer
+ * \param dest rank of the destination
+ * \param tag message tag
+ * \param comm MPI communicator
+ * \param request pointer toward the request of the send
+ *
+ * \return 0 if fail, 1 if success
+ *
+ * Post the send of a char buffer whose size may overflow the int counts of
+ * mpi (a \a PMMG_create_MPI_bigChar data type is used in this case).
+ *
+ */
+int PMMG_Isend_bigChar(char *buf,size_t count,int dest,int tag,MPI_Comm comm,
+                       MPI_Request *request)
+{
+  MPI_Datatype mpi_bigchar;
+
+  if ( count <= INT_MAX ) {
+    MPI_CHECK( MPI_Isend(buf,(int)count,MPI_CHAR,dest,tag,comm,request),
+               return 0);
+    return 1;
+  }
+
+  if ( !PMMG_create_MPI_bigChar(count,&mpi_bigchar) ) return 0;
+
+  MPI_CHECK( MPI_Isend(buf,1,mpi_bigchar,dest,tag,comm,request),
+             MPI_Type_free(&mpi_bigchar);return 0);
+
+  /* The data type is released by mpi at the completion of the request */
+  MPI_Type_free(&mpi_bigchar);
+
+  return 1;
+}
+
+/**
+ * \param buf buffer in which we receive
+ * \param count number of chars of the buffer
+ * \param source rank of the source
+ * \param tag message tag
+ * \param comm MPI communicator
+ * \param request pointer toward the request of the reception
+ *
+ * \return 0 if fail, 1 if success
+ *
+ * Post the reception of a char buffer whose size may overflow the int counts of
+ * mpi (a \a PMMG_create_MPI_bigChar data type is used in this case).
+ *
+ */
+int PMMG_Irecv_bigChar(char *buf,size_t count,int source,int tag,MPI_Comm comm,
+                       MPI_Request *request)
+{
+  MPI_Datatype mpi_bigchar;
+
+  if ( count <= INT_MAX ) {
+    MPI_CHECK( MPI_Irecv(buf,(int)count,MPI_CHAR,source,tag,comm,request),
+               return 0);
+    return 1;
+  }
+
+  if ( !PMMG_create_MPI_bigChar(count,&mpi_bigchar) ) return 0;
+
+  MPI_CHECK( MPI_Irecv(buf,1,mpi_bigchar,source,tag,comm,request),
+             MPI_Type_free(&mpi_bigchar);return 0);
+
+  /* The data type is released by mpi at the completion of the request */
+  MPI_Type_free(&mpi_bigchar);
+
+  return 1;
+}
+
 /**
  * \param mpi_point  pointer toward an MPI_Datatype
  * \param mpi_xpoint pointer toward an MPI_Datatype
@@ -51,6 +51,14 @@ int PMMG_create_MPI_Tria(MPI_Datatype *mpi_tria);
 
 int PMMG_create_MPI_xTetra(MPI_Datatype *mpi_xtetra);
 
+int PMMG_create_MPI_bigChar(size_t count,MPI_Datatype *mpi_bigchar);
+
+int PMMG_Isend_bigChar(char *buf,size_t count,int dest,int tag,MPI_Comm comm,
+                       MPI_Request *request);
+
+int PMMG_Irecv_bigChar(char *buf,size_t count,int source,int tag,MPI_Comm comm,
+                       MPI_Request *request);
+
 int PMMG_Free_MPI_meshDatatype( MPI_Datatype*,MPI_Datatype*,
                                 MPI_Datatype*,MPI_Datatype*);
 
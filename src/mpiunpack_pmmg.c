@@ -784,14 +784,14 @@ int PMMG_mpiunpack_meshArrays ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp
     if ( ier_met ) {
       for ( k=1; k<=np; ++k ) {
         for ( i=0; i<metsize; ++i ) {
-          met->m[metsize*k + i] = *( (double *) *buffer);
+          met->m[(size_t)metsize*k + i] = *( (double *) *buffer);
           *buffer += sizeof(double);
         }
       }
     }
     else {
       /* The metric array can't be allocated */
-      *buffer += np*metsize*sizeof(double);
+      *buffer += (size_t)np*metsize*sizeof(double);
     }
   }
 
@@ -800,14 +800,14 @@ int PMMG_mpiunpack_meshArrays ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp
     if ( ier_ls ) {
       for ( k=1; k<=np; ++k ) {
         for ( i=0; i<lssize; ++i ) {
-          ls->m[lssize*k + i] = *( (double *) *buffer);
+          ls->m[(size_t)lssize*k + i] = *( (double *) *buffer);
           *buffer += sizeof(double);
         }
       }
     }
     else {
       /* The ls array can't be allocated */
-      *buffer += np*lssize*sizeof(double);
+      *buffer += (size_t)np*lssize*sizeof(double);
     }
   }
 
@@ -816,14 +816,14 @@ int PMMG_mpiunpack_meshArrays ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp
     if ( ier_disp ) {
       for ( k=1; k<=np; ++k ) {
         for ( i=0; i<dispsize; ++i ) {
-          disp->m[dispsize*k + i] = *( (double *) *buffer);
+          disp->m[(size_t)dispsize*k + i] = *( (double *) *buffer);
           *buffer += sizeof(double);
         }
       }
     }
     else {
       /* The metric array can't be allocated */
-      *buffer += np*dispsize*sizeof(double);
+      *buffer += (size_t)np*dispsize*sizeof(double);
     }
   }
 
@@ -833,7 +833,7 @@ int PMMG_mpiunpack_meshArrays ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp
         psl = &grp->field[is];
         for ( k=1; k<=np; ++k ) {
           for ( i=0; i<psl->size; ++i ) {
-            psl->m[psl->size*k + i] = *( (double *) *buffer);
+            psl->m[(size_t)psl->size*k + i] = *( (double *) *buffer);
             *buffer += sizeof(double);
           }
         }
@@ -63,7 +63,7 @@ int main( int argc, char *argv[] )
   PMMG_pGrp     grp;
   int           rank;
   int           ier,iermesh,iresult,ierSave,fmtin,fmtout;
-  int8_t        tim,distributedInput;
+  int8_t        tim,distributedInput,parallelInput,parallelOutput;
   char          stim[32],*ptr;
 
   // Shared memory communicator: processes that are on the same node, sharing
@@ -153,13 +153,31 @@ int main( int argc, char *argv[] )
   fmtout = MMG5_Get_format(ptr,fmtin);
 
   distributedInput = 0;
+  parallelInput    = 0;
+  parallelOutput   = ( parmesh->info.fmtout == PMMG_FMT_ParallelMeditBinary );
 
   switch ( fmtin ) {
   case ( MMG5_FMT_MeditASCII ): case ( MMG5_FMT_MeditBinary ):
 
-    // Algiane: Dirty (to be discussed, I don't have a clean solution)
-    iermesh = PMMG_loadMesh_centralized(parmesh,parmesh->meshin);
-    MPI_Bcast( &iermesh,     1, MPI_INT, parmesh->info.root, parmesh->comm );
+    if ( parmesh->info.parallel_input && fmtin == MMG5_FMT_MeditBinary &&
+         grp->mesh->info.lag < 0 && !grp->mesh->info.iso &&
+         !(parmesh->fieldin && *parmesh->fieldin) ) {
+      /* Centralized mesh (and metric) read and distributed by all the
+       * processes. The fields and the level-set/displacement are not read in
+       * parallel: fall back on the centralized reading when they are
+       * provided. */
+      iermesh = PMMG_loadMesh_parallel(parmesh,parmesh->meshin);
+      parallelInput = ( iermesh == 1 );
+    }
+    else {
+      iermesh = PMMG_MPIIO_CENTRALIZED;
+    }
+
+    if ( iermesh == PMMG_MPIIO_CENTRALIZED ) {
+      // Algiane: Dirty (to be discussed, I don't have a clean solution)
+      iermesh = PMMG_loadMesh_centralized(parmesh,parmesh->meshin);
+      MPI_Bcast( &iermesh,     1, MPI_INT, parmesh->info.root, parmesh->comm );
+    }
 
     if ( 1 != iermesh ) {
       /* try to load distributed mesh */
@@ -207,6 +225,8 @@ int main( int argc, char *argv[] )
         /* format is already good: store it in parmesh->info.fmtout */
         parmesh->info.fmtout = fmtout;
       }
+      /* The mesh read in parallel is already distributed */
+      distributedInput = parallelInput;
     }
 
     if ( 1 != iermesh && rank == parmesh->info.root ) {
@@ -256,7 +276,11 @@ int main( int argc, char *argv[] )
     }
     else {
       /* Facultative metric */
-      if ( !distributedInput ) {
+      if ( parallelInput ) {
+        /* Already read with the mesh */
+        iermesh = 1;
+      }
+      else if ( !distributedInput ) {
         iermesh = PMMG_loadMet_centralized( parmesh, parmesh->metin );
       }
       else {
@@ -272,7 +296,7 @@ int main( int argc, char *argv[] )
       }
     }
     /* In iso mode: read metric if any */
-    if ( grp->mesh->info.iso && parmesh->metin ) {
+    if ( grp->mesh->info.iso && parmesh->metin && !parallelInput ) {
       if ( !distributedInput ) {
         iermesh = PMMG_loadMet_centralized( parmesh, parmesh->metin );
       }
@@ -315,6 +339,17 @@ int main( int argc, char *argv[] )
     goto check_mesh_loading;
   }
 
+  if ( parallelOutput ) {
+    /* Centralized binary Medit output written by all the processes */
+    if ( fmtout == MMG5_FMT_MeditBinary ) {
+      parmesh->info.fmtout = PMMG_FMT_ParallelMeditBinary;
+    }
+    else if ( rank == parmesh->info.root ) {
+      fprintf(stderr,"  ## Warning: parallel output is only available for"
+              " binary Medit files (.meshb). Ignored.\n");
+    }
+  }
+
   if ( !PMMG_parsop(parmesh) ) {
     ier = 0;
     goto check_mesh_loading;
@@ -419,6 +454,20 @@ check_mesh_loading:
         PMMG_RETURN_AND_FREE(parmesh,PMMG_STRONGFAILURE);
       }
       break;
+    case ( PMMG_FMT_ParallelMeditBinary ):
+      ierSave = PMMG_saveMesh_parallel(parmesh,parmesh->meshout);
+      if ( ierSave && parmesh->listgrp[0].met && parmesh->listgrp[0].met->m ) {
+        ierSave = PMMG_saveMet_parallel(parmesh,parmesh->metout);
+      }
+      if ( ierSave &&  grp->field ) {
+        fprintf(stderr,"  ## Error: %s: PMMG_saveAllSols_parallel function"
+                " not yet implemented."
+                " Ignored.\n",__func__);
+      }
+      if ( !ierSave ) {
+        PMMG_RETURN_AND_FREE(parmesh,PMMG_STRONGFAILURE);
+      }
+      break;
     default:
       ierSave = PMMG_saveMesh_centralized(parmesh,parmesh->meshout);
       if ( !ierSave ) {
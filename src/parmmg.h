@@ -47,6 +47,8 @@
 
 #include "libparmmg.h"
 #include "interpmesh_pmmg.h"
+#include "trace_pmmg.h"
+#include "arena_pmmg.h"
 #include "mmg3d.h"
 
 #ifdef __cplusplus
@@ -69,6 +71,22 @@ extern "C" {
  */
 #define PMMG_NITER   3
 
+/**
+ * \def PMMG_NITERMAX
+ *
+ * Default maximal number of iterations of the adaptive iterations mode
+ *
+ */
+#define PMMG_NITERMAX   6
+
+/**
+ * \def PMMG_NTHREADS
+ *
+ * Default number of threads used to remesh the groups of a process
+ *
+ */
+#define PMMG_NTHREADS   1
+
 /**
  * \def PMMG_IMPRIM
  *
@@ -202,6 +220,7 @@ enum PMMG_Format {
   PMMG_FMT_Distributed,                       /*!< Distributed Setters/Getters */
   PMMG_FMT_DistributedMeditASCII,             /*!< Distributed ASCII Medit (.mesh) */
   PMMG_FMT_DistributedMeditBinary,            /*!< Distributed Binary Medit (.meshb) */
+  PMMG_FMT_ParallelMeditBinary,               /*!< Centralized Binary Medit (.meshb) written by all the processes */
   PMMG_FMT_Unknown,                           /*!< Unrecognized */
 };
 
@@ -226,6 +245,39 @@ static const double PMMG_GRPS_RATIO = 2.0;
 /**< Number of elements layers for interface displacement */
 static const int PMMG_MVIFCS_NLAYERS = 2;
 
+/**< Bounds of the edge lengths considered as adapted by the convergence test */
+static const double PMMG_CONV_LMIN = 0.7071;
+static const double PMMG_CONV_LMAX = 1.4142;
+
+/**< Default max fraction of edges out of [PMMG_CONV_LMIN,PMMG_CONV_LMAX] at
+ * convergence */
+static const double PMMG_CONV_LENGTH = 0.05;
+
+/**< Max fraction of edges out of [PMMG_CONV_LMIN,PMMG_CONV_LMAX] for a group
+ * to be skipped by the remeshing (much stricter than the convergence test) */
+static const double PMMG_SKIP_LENGTH = 0.001;
+
+/**< Default minimal element quality at convergence */
+static const double PMMG_CONV_QUAL = 0.05;
+
+/**< Auto-tuning: max fraction of the group remeshing time spent in the fixed
+ * cost of a group */
+static const double PMMG_TUNE_OVERHEAD = 0.05;
+
+/**< Auto-tuning: min relative variance of the groups sizes to fit the model of
+ * the remeshing time */
+static const double PMMG_TUNE_SPREAD = 0.01;
+
+/**< Auto-tuning: max/avg remeshing time of the processes above which the metis
+ * nodes are refined */
+static const double PMMG_TUNE_IMBALANCE = 1.1;
+
+/**< Auto-tuning: max change factor of the groups size between two iterations */
+static const double PMMG_TUNE_FACTOR = 4.;
+
+/**< Auto-tuning: min groups size */
+static const int PMMG_TUNE_NELEM_MIN = 1000;
+
 /**
  * \param parmesh pointer toward a parmesh structure
  * \param val     exit value
@@ -448,6 +500,7 @@ int PMMG_hashOldPar_pmmg( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_Hash *hash
 /* Internal library */
 void PMMG_setfunc( PMMG_pParMesh parmesh );
 int PMMG_parmmglib1 ( PMMG_pParMesh parmesh );
+int PMMG_update_niter( PMMG_pParMesh parmesh );
 
 /* Mesh distrib */
 int PMMG_bdryUpdate( MMG5_pMesh mesh );
@@ -464,11 +517,14 @@ int PMMG_loadBalancing( PMMG_pParMesh parmesh );
 int PMMG_split_n2mGrps( PMMG_pParMesh,int,int );
 double PMMG_computeWgt( MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,int ifac );
 void PMMG_computeWgt_mesh( MMG5_pMesh mesh,MMG5_pSol met,int tag );
+double PMMG_computeWorkWgt( MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt );
 
 /* Mesh interpolation */
 int PMMG_oldGrps_newGroup( PMMG_pParMesh parmesh,int igrp );
 int PMMG_oldGrps_fillGroup( PMMG_pParMesh parmesh,int igrp );
 int PMMG_update_oldGrps( PMMG_pParMesh parmesh );
+int PMMG_oldGrps_needed( PMMG_pParMesh parmesh );
+void PMMG_free_oldGrps( PMMG_pParMesh parmesh );
 int PMMG_interpMetricsAndFields( PMMG_pParMesh parmesh,int* );
 int PMMG_copyMetricsAndFields_point( MMG5_pMesh mesh, MMG5_pMesh oldMesh, MMG5_pSol met, MMG5_pSol oldMet, MMG5_pSol,MMG5_pSol, int* permNodGlob,uint8_t);
 
@@ -484,12 +540,19 @@ void PMMG_tria2elmFace_flags( PMMG_pParMesh parmesh );
 void PMMG_tria2elmFace_coords( PMMG_pParMesh parmesh );
 int PMMG_build_nodeCommIndex( PMMG_pParMesh parmesh );
 int PMMG_build_faceCommIndex( PMMG_pParMesh parmesh );
-int PMMG_build_nodeCommFromFaces( PMMG_pParMesh parmesh );
+int PMMG_build_nodeCommFromFaces( PMMG_pParMesh parmesh,int8_t keepIntComm );
 int PMMG_build_faceCommFromNodes( PMMG_pParMesh parmesh );
 int PMMG_build_simpleExtNodeComm( PMMG_pParMesh parmesh );
 int PMMG_build_intNodeComm( PMMG_pParMesh parmesh );
 int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh );
 int PMMG_build_edgeComm( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *hpar );
+int PMMG_extComm_halo_init( PMMG_pParMesh parmesh,PMMG_pExt_comm ext_comm,
+                            int next_comm,int nint,int ndouble,int tag,
+                            MPI_Request **request );
+int PMMG_extComm_halo_exchange( PMMG_pParMesh parmesh,MPI_Request *request,
+                                int next_comm,int withDouble );
+void PMMG_extComm_halo_free( PMMG_pParMesh parmesh,MPI_Request **request,
+                             int next_comm );
 
 int PMMG_pack_faceCommunicators(PMMG_pParMesh parmesh);
 int PMMG_pack_nodeCommunicators(PMMG_pParMesh parmesh);
@@ -500,6 +563,7 @@ int PMMG_check_extFaceComm( PMMG_pParMesh parmesh );
 int PMMG_check_intNodeComm( PMMG_pParMesh parmesh );
 int PMMG_check_extNodeComm( PMMG_pParMesh parmesh );
 int PMMG_check_extEdgeComm( PMMG_pParMesh parmesh );
+int PMMG_check_comms( PMMG_pParMesh parmesh );
 
 /* Tags */
 void PMMG_tag_par_node(MMG5_pPoint ppt);
@@ -545,6 +609,7 @@ int  PMMG_link_mesh( MMG5_pMesh mesh );
 void PMMG_listgrp_free( PMMG_pParMesh parmesh, PMMG_pGrp *listgrp, int ngrp );
 void PMMG_grp_free( PMMG_pParMesh parmesh, PMMG_pGrp grp );
 int  PMMG_parmesh_SetMemMax( PMMG_pParMesh parmesh);
+int  PMMG_parmesh_ShareMemMax( PMMG_pParMesh parmesh );
 int  PMMG_setMeshSize( MMG5_pMesh,int,int,int,int,int );
 int  PMMG_setMeshSize_alloc( MMG5_pMesh );
 int  PMMG_setMeshSize_realloc( MMG5_pMesh,int,int,int,int);
@@ -564,6 +629,9 @@ int PMMG_copy_mmgInfo ( MMG5_Info *info, MMG5_Info *info_cpy );
 int PMMG_qualhisto( PMMG_pParMesh parmesh,int,int );
 int PMMG_prilen( PMMG_pParMesh parmesh,int8_t,int );
 int PMMG_tetraQual( PMMG_pParMesh parmesh,int8_t metRidTyp );
+int PMMG_convergenceStats( PMMG_pParMesh parmesh,double *lenOut,double *lenOutIfc,
+                           double *qmin );
+int PMMG_isAdapted_grp( PMMG_pParMesh parmesh,int igrp );
 
 /* Variadic_pmmg.c */
 int PMMG_Init_parMesh_var_internal(va_list argptr,int callFromC);
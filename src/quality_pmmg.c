@@ -731,3 +731,164 @@ int PMMG_tetraQual( PMMG_pParMesh parmesh,int8_t metRidTyp ) {
 
   return 1;
 }
+
+/**
+ * \param mesh pointer toward the mesh structure of a group.
+ * \param met pointer toward the metric of the group.
+ * \param cnt number of edges, of unadapted edges, of interface edges and of
+ * unadapted interface edges (updated).
+ * \param qmin minimal quality of the elements (updated).
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Count the edges of a group whose length is out of
+ * [PMMG_CONV_LMIN,PMMG_CONV_LMAX] (each edge of the group is counted once).
+ *
+ */
+static
+int PMMG_convergenceStats_grp( MMG5_pMesh mesh,MMG5_pSol met,double cnt[4],
+                               double *qmin ) {
+  MMG5_pTetra pt;
+  MMG5_Hash   hash;
+  double      len;
+  int         k,ia,np,nq,ifc,out;
+
+  if ( !MMG5_hashNew(mesh,&hash,mesh->np,7*mesh->np) ) return 0;
+
+  for ( k=1; k<=mesh->ne; ++k ) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) ) continue;
+
+    *qmin = MG_MIN(*qmin,pt->qual);
+
+    for ( ia=0; ia<6; ++ia ) {
+      np = pt->v[MMG5_iare[ia][0]];
+      nq = pt->v[MMG5_iare[ia][1]];
+
+      if ( MMG5_hashGet(&hash,np,nq) ) continue;
+      if ( !MMG5_hashEdge(mesh,&hash,np,nq,1) ) {
+        MMG5_DEL_MEM(mesh,hash.item);
+        return 0;
+      }
+
+      len = MMG5_lenedg(mesh,met,ia,pt);
+      out = ( len < PMMG_CONV_LMIN || len > PMMG_CONV_LMAX );
+
+      /* Edges of the interfaces that have been frozen during the remeshing */
+      ifc = ( (mesh->point[np].tag & MG_PARBDY) &&
+              (mesh->point[nq].tag & MG_PARBDY) );
+
+      cnt[0] += 1.;
+      cnt[1] += out;
+      if ( ifc ) {
+        cnt[2] += 1.;
+        cnt[3] += out;
+      }
+    }
+  }
+
+  MMG5_DEL_MEM(mesh,hash.item);
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param lenOut fraction of unadapted edges (to fill).
+ * \param lenOutIfc fraction of unadapted edges among the edges of the parallel
+ * interfaces (to fill).
+ * \param qmin minimal normalized quality of the elements (to fill).
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Compute the global convergence criteria of the adaptation. Elements
+ * qualities must be up to date (see \ref PMMG_tetraQual).
+ *
+ * \warning the edges shared by several groups are counted once per group.
+ *
+ */
+int PMMG_convergenceStats( PMMG_pParMesh parmesh,double *lenOut,double *lenOutIfc,
+                           double *qmin ) {
+  PMMG_pGrp grp;
+  double    cnt[4],cnt_result[4],qual,qual_result;
+  int       igrp,ier,ieresult;
+
+  ier  = 1;
+  qual = DBL_MAX;
+  memset(cnt,0,4*sizeof(double));
+
+  for( igrp = 0; igrp < parmesh->ngrp; igrp++ ) {
+    grp = &parmesh->listgrp[igrp];
+    if ( !grp->mesh || !grp->met || !grp->met->m ) continue;
+
+    if ( !PMMG_convergenceStats_grp(grp->mesh,grp->met,cnt,&qual) ) {
+      fprintf(stderr,"\n  ## Error: %s: unable to hash the edges of group %d.\n",
+              __func__,igrp);
+      ier = 0;
+      break;
+    }
+  }
+
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) return 0;
+
+  MPI_Allreduce( cnt, cnt_result, 4, MPI_DOUBLE, MPI_SUM, parmesh->comm );
+  MPI_Allreduce( &qual, &qual_result, 1, MPI_DOUBLE, MPI_MIN, parmesh->comm );
+
+  *lenOut    = ( cnt_result[0] > 0. ) ? cnt_result[1]/cnt_result[0] : 0.;
+  *lenOutIfc = ( cnt_result[2] > 0. ) ? cnt_result[3]/cnt_result[2] : 0.;
+  *qmin      = ( qual_result < DBL_MAX ) ? MMG3D_ALPHAD*qual_result : 1.;
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param igrp index of the group.
+ *
+ * \return 1 if the group is already adapted, 0 otherwise.
+ *
+ * Cheap estimate of the remeshing work of a group: the group is adapted if it
+ * has no element of quality lower than \a info.conv_qual and if the fraction of
+ * its edges of length out of [PMMG_CONV_LMIN,PMMG_CONV_LMAX] is lower than
+ * PMMG_SKIP_LENGTH. The edges of the parallel interfaces are ignored as they
+ * are frozen during the remeshing. Edges are not hashed, thus they are counted
+ * once per element. Elements qualities must be up to date.
+ *
+ */
+int PMMG_isAdapted_grp( PMMG_pParMesh parmesh,int igrp ) {
+  MMG5_pMesh  mesh;
+  MMG5_pSol   met;
+  MMG5_pTetra pt;
+  double      len,ned,nout;
+  int         k,ia,np,nq;
+
+  mesh = parmesh->listgrp[igrp].mesh;
+  met  = parmesh->listgrp[igrp].met;
+
+  if ( !met || !met->m || met->np != mesh->np ) return 0;
+
+  ned  = 0.;
+  nout = 0.;
+  for ( k=1; k<=mesh->ne; ++k ) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) ) continue;
+
+    if ( MMG3D_ALPHAD*pt->qual < parmesh->info.conv_qual ) return 0;
+
+    for ( ia=0; ia<6; ++ia ) {
+      np = pt->v[MMG5_iare[ia][0]];
+      nq = pt->v[MMG5_iare[ia][1]];
+
+      if ( (mesh->point[np].tag & MG_PARBDY) &&
+           (mesh->point[nq].tag & MG_PARBDY) ) continue;
+
+      len = MMG5_lenedg(mesh,met,ia,pt);
+
+      ned  += 1.;
+      nout += ( len < PMMG_CONV_LMIN || len > PMMG_CONV_LMAX );
+    }
+  }
+
+  return ( nout <= PMMG_SKIP_LENGTH*ned );
+}
@@ -0,0 +1,460 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file sfc_pmmg.c
+ * \brief Partition mesh along a space filling curve
+ * \copyright GNU Lesser General Public License.
+ *
+ * The elements are sorted along the Hilbert curve of their barycenters and the
+ * sorted list is cut into slices of equal weight. Unlike metis, no graph is
+ * built: the partitioning costs one sort of the elements.
+ *
+ * The same sort is used to renumber the entities of the groups for a better
+ * memory locality during the remeshing and the interpolation.
+ *
+ */
+#include "sfc_pmmg.h"
+
+/**
+ * \param c point coordinates.
+ * \param min lower corner of the bounding box.
+ * \param scale scaling factor of the bounding box toward the key grid (see
+ * \ref PMMG_sfc_scale).
+ *
+ * \return the Hilbert key of the point.
+ *
+ * Compute the index of the point along the 3D Hilbert curve of order \a
+ * PMMG_SFC_KEYBITS (Skilling's algorithm: the coordinates are transposed to
+ * the Hilbert index and the bits are interleaved).
+ *
+ */
+uint64_t PMMG_sfc_hilbertKey( const double c[3],const double min[3],double scale ) {
+  uint32_t x[3],m,p,q,t;
+  uint64_t key;
+  double   r;
+  int      b,d;
+
+  for ( d=0; d<3; ++d ) {
+    r    = (c[d]-min[d])*scale;
+    r    = MG_MAX(0.,MG_MIN(r,(double)((1<<PMMG_SFC_KEYBITS)-1)));
+    x[d] = (uint32_t)r;
+  }
+
+  /* Inverse undo */
+  m = 1u << (PMMG_SFC_KEYBITS-1);
+  for ( q=m; q>1; q>>=1 ) {
+    p = q-1;
+    for ( d=0; d<3; ++d ) {
+      if ( x[d] & q ) {
+        x[0] ^= p;
+      }
+      else {
+        t     = (x[0] ^ x[d]) & p;
+        x[0] ^= t;
+        x[d] ^= t;
+      }
+    }
+  }
+
+  /* Gray encode */
+  for ( d=1; d<3; ++d ) {
+    x[d] ^= x[d-1];
+  }
+  t = 0;
+  for ( q=m; q>1; q>>=1 ) {
+    if ( x[2] & q ) t ^= q-1;
+  }
+  for ( d=0; d<3; ++d ) {
+    x[d] ^= t;
+  }
+
+  /* Interleave the transposed bits */
+  key = 0;
+  for ( b=PMMG_SFC_KEYBITS-1; b>=0; --b ) {
+    for ( d=0; d<3; ++d ) {
+      key = (key<<1) | ((x[d]>>b)&1);
+    }
+  }
+  return key;
+}
+
+/**
+ * \param min lower corner of the bounding box.
+ * \param max upper corner of the bounding box.
+ *
+ * \return the scaling factor from the bounding box toward the key grid.
+ *
+ * The same factor is used in the 3 directions so the curve cells are cubes.
+ *
+ */
+double PMMG_sfc_scale( const double min[3],const double max[3] ) {
+  double ext;
+  int    d;
+
+  ext = 0.;
+  for ( d=0; d<3; ++d ) {
+    ext = MG_MAX(ext,max[d]-min[d]);
+  }
+  return ( ext > 0. ) ? ((double)((1<<PMMG_SFC_KEYBITS)-1))/ext : 0.;
+}
+
+/**
+ * \param a pointer toward a PMMG_sfcItem structure.
+ * \param b pointer toward a PMMG_sfcItem structure.
+ *
+ * \return -1 if a is before b along the curve, 1 if it is after, 0 otherwise.
+ *
+ * Compare two items along the curve (items of same key are ordered by index).
+ *
+ */
+int PMMG_sfc_compare( const void *a,const void *b ) {
+  const PMMG_sfcItem *ia = (const PMMG_sfcItem*)a;
+  const PMMG_sfcItem *ib = (const PMMG_sfcItem*)b;
+
+  if ( ia->key < ib->key ) return -1;
+  if ( ia->key > ib->key ) return  1;
+  if ( ia->idx < ib->idx ) return -1;
+  if ( ia->idx > ib->idx ) return  1;
+  return 0;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part pointer of an array containing the partitions (at the end)
+ * \param nproc number of partitions asked
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Partition the first mesh in the list of meshes into nproc groups of
+ * contiguous elements along the Hilbert curve. The elements are weighted by
+ * their predicted remeshing work if asked, and no partition is left empty if
+ * the mesh has enough elements.
+ *
+ */
+int PMMG_part_meshElts2sfc( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc ) {
+  PMMG_pGrp    grp  = parmesh->listgrp;
+  MMG5_pMesh   mesh = grp[0].mesh;
+  MMG5_pSol    met  = grp[0].met;
+  MMG5_pTetra  pt;
+  PMMG_sfcItem *list;
+  double       *bary,min[3],max[3],scale,wgt,wtot,wcur;
+  int          ne,k,i,d,ip,iplo,work;
+
+  ne = mesh->ne;
+
+  if ( nproc <= 1 ) {
+    for ( k=0; k<ne; ++k ) {
+      part[k] = 0;
+    }
+    return 1;
+  }
+
+  list = NULL;
+  bary = NULL;
+  PMMG_MALLOC(parmesh,bary,3*(size_t)ne,double,"sfc barycenters",return 0);
+  PMMG_MALLOC(parmesh,list,ne,PMMG_sfcItem,"sfc items",
+              PMMG_DEL_MEM(parmesh,bary,double,"sfc barycenters");
+              return 0);
+
+  /** Barycenters and bounding box of the elements */
+  for ( d=0; d<3; ++d ) {
+    min[d] =  DBL_MAX;
+    max[d] = -DBL_MAX;
+  }
+  for ( k=1; k<=ne; ++k ) {
+    pt = &mesh->tetra[k];
+    for ( d=0; d<3; ++d ) {
+      bary[3*(k-1)+d] = 0.;
+    }
+    for ( i=0; i<4; ++i ) {
+      for ( d=0; d<3; ++d ) {
+        bary[3*(k-1)+d] += 0.25*mesh->point[pt->v[i]].c[d];
+      }
+    }
+    for ( d=0; d<3; ++d ) {
+      min[d] = MG_MIN(min[d],bary[3*(k-1)+d]);
+      max[d] = MG_MAX(max[d],bary[3*(k-1)+d]);
+    }
+  }
+  scale = PMMG_sfc_scale(min,max);
+
+  /** Sort the elements along the curve */
+  for ( k=0; k<ne; ++k ) {
+    list[k].key = PMMG_sfc_hilbertKey(&bary[3*k],min,scale);
+    list[k].idx = k;
+  }
+  PMMG_DEL_MEM(parmesh,bary,double,"sfc barycenters");
+
+  qsort(list,ne,sizeof(PMMG_sfcItem),PMMG_sfc_compare);
+
+  /** Cut the curve into slices of equal weight */
+  work = ( parmesh->info.work_wgt && met && met->m );
+  wtot = 0.;
+  if ( work ) {
+    for ( k=1; k<=ne; ++k ) {
+      wtot += PMMG_computeWorkWgt(mesh,met,&mesh->tetra[k]);
+    }
+  }
+  else {
+    wtot = (double)ne;
+  }
+
+  wcur = 0.;
+  ip   = -1;
+  for ( k=0; k<ne; ++k ) {
+    wgt = work ? PMMG_computeWorkWgt(mesh,met,&mesh->tetra[list[k].idx+1]) : 1.;
+
+    /* Slice containing the middle of the element weight */
+    i = ( wtot > 0. ) ? (int)((wcur+0.5*wgt)*nproc/wtot) : 0;
+    wcur += wgt;
+
+    /* Slices are consecutive, and keep enough elements for the next ones */
+    iplo = MG_MAX(ip,(int)nproc-(ne-k));
+    i    = MG_MAX(i,iplo);
+    i    = MG_MIN(i,ip+1);
+    i    = MG_MIN(i,(int)nproc-1);
+    ip   = i;
+
+    part[list[k].idx] = i;
+  }
+
+  PMMG_DEL_MEM(parmesh,list,PMMG_sfcItem,"sfc items");
+
+  return 1;
+}
+
+/**
+ * \param sol pointer toward a solution structure defined at the mesh points.
+ * \param np number of points.
+ * \param permNod new index of each point.
+ * \param buf work buffer of at least \a sol->size*np doubles.
+ *
+ * Permute the values of a solution defined at the points.
+ *
+ */
+static
+void PMMG_sfc_permuteSol( MMG5_pSol sol,int np,int *permNod,double *buf ) {
+  int k,i,size;
+
+  if ( !sol || !sol->m ) return;
+
+  size = sol->size;
+  memcpy(buf,&sol->m[size],(size_t)size*np*sizeof(double));
+  for ( k=1; k<=np; ++k ) {
+    for ( i=0; i<size; ++i ) {
+      sol->m[size*permNod[k]+i] = buf[size*(k-1)+i];
+    }
+  }
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param igrp index of the group.
+ *
+ * \return 1 if success, 0 if fail (the group is left unchanged).
+ *
+ * Renumber the tetra of the group along the Hilbert curve of their barycenters
+ * and the points in their order of first appearance in the sorted tetra. The
+ * tetra adjacency, the boundary triangles and edges, the metric and the
+ * solution fields, and the node and face communicators of the group are
+ * updated. Only packed meshes are renumbered (the lists of unused entities are
+ * not updated).
+ *
+ */
+int PMMG_sfc_renumber_grp( PMMG_pParMesh parmesh,int igrp ) {
+  PMMG_pGrp    grp = &parmesh->listgrp[igrp];
+  MMG5_pMesh   mesh = grp->mesh;
+  MMG5_pTetra  pt;
+  MMG5_pTria   ptt;
+  MMG5_pPoint  ppt;
+  PMMG_sfcItem *list;
+  double       bary[3],min[3],max[3],scale;
+  size_t       bufsize;
+  char         *buf;
+  int          *permTet,*permNod,*adja,ne,np,nsol,k,i,d,ip,iel,idx;
+
+  if ( !mesh || mesh->ne < 2 || mesh->nprism || mesh->nquad ) return 1;
+
+  ne = mesh->ne;
+  np = mesh->np;
+  for ( k=1; k<=ne; ++k ) {
+    if ( !MG_EOK(&mesh->tetra[k]) ) return 1;
+  }
+  for ( k=1; k<=np; ++k ) {
+    if ( !MG_VOK(&mesh->point[k]) ) return 1;
+  }
+
+  /** Allocate all the work arrays before modifying the group */
+  nsol = grp->met && grp->met->m ? grp->met->size : 0;
+  if ( grp->ls && grp->ls->m ) nsol = MG_MAX(nsol,grp->ls->size);
+  if ( grp->disp && grp->disp->m ) nsol = MG_MAX(nsol,grp->disp->size);
+  for ( k=0; k<mesh->nsols; ++k ) {
+    if ( grp->field[k].m ) nsol = MG_MAX(nsol,grp->field[k].size);
+  }
+
+  bufsize = MG_MAX((size_t)ne*sizeof(MMG5_Tetra),(size_t)np*sizeof(MMG5_Point));
+  bufsize = MG_MAX(bufsize,4*(size_t)ne*sizeof(int));
+  bufsize = MG_MAX(bufsize,(size_t)nsol*np*sizeof(double));
+
+  list = NULL;
+  buf  = NULL;
+  permTet = permNod = NULL;
+  PMMG_MALLOC(parmesh,list,ne,PMMG_sfcItem,"sfc items",goto fail);
+  PMMG_MALLOC(parmesh,permTet,ne+1,int,"sfc tetra permutation",goto fail);
+  PMMG_CALLOC(parmesh,permNod,np+1,int,"sfc point permutation",goto fail);
+  PMMG_MALLOC(parmesh,buf,bufsize,char,"sfc renumbering buffer",goto fail);
+
+  /** Sort the tetra along the curve (the barycenters are in the bounding box
+   * of the points) */
+  for ( d=0; d<3; ++d ) {
+    min[d] =  DBL_MAX;
+    max[d] = -DBL_MAX;
+  }
+  for ( k=1; k<=np; ++k ) {
+    ppt = &mesh->point[k];
+    for ( d=0; d<3; ++d ) {
+      min[d] = MG_MIN(min[d],ppt->c[d]);
+      max[d] = MG_MAX(max[d],ppt->c[d]);
+    }
+  }
+  scale = PMMG_sfc_scale(min,max);
+
+  for ( k=1; k<=ne; ++k ) {
+    pt = &mesh->tetra[k];
+    for ( d=0; d<3; ++d ) {
+      bary[d] = 0.25*( mesh->point[pt->v[0]].c[d] + mesh->point[pt->v[1]].c[d] +
+                       mesh->point[pt->v[2]].c[d] + mesh->point[pt->v[3]].c[d] );
+    }
+    list[k-1].key = PMMG_sfc_hilbertKey(bary,min,scale);
+    list[k-1].idx = k;
+  }
+  qsort(list,ne,sizeof(PMMG_sfcItem),PMMG_sfc_compare);
+
+  /** New indices of the tetra and of the points */
+  ip = 0;
+  for ( k=0; k<ne; ++k ) {
+    permTet[list[k].idx] = k+1;
+    pt = &mesh->tetra[list[k].idx];
+    for ( i=0; i<4; ++i ) {
+      if ( !permNod[pt->v[i]] ) permNod[pt->v[i]] = ++ip;
+    }
+  }
+  for ( k=1; k<=np; ++k ) {
+    /* Points that don't belong to a tetra */
+    if ( !permNod[k] ) permNod[k] = ++ip;
+  }
+  assert ( ip == np );
+  PMMG_DEL_MEM(parmesh,list,PMMG_sfcItem,"sfc items");
+
+  /** Permute the tetra and update their vertices and adjacency */
+  memcpy(buf,&mesh->tetra[1],(size_t)ne*sizeof(MMG5_Tetra));
+  for ( k=1; k<=ne; ++k ) {
+    pt  = &mesh->tetra[permTet[k]];
+    *pt = ((MMG5_pTetra)buf)[k-1];
+    for ( i=0; i<4; ++i ) {
+      pt->v[i] = permNod[pt->v[i]];
+    }
+  }
+
+  if ( mesh->adja ) {
+    adja = (int*)buf;
+    memcpy(adja,&mesh->adja[1],4*(size_t)ne*sizeof(int));
+    for ( k=1; k<=ne; ++k ) {
+      for ( i=0; i<4; ++i ) {
+        iel = adja[4*(k-1)+i];
+        mesh->adja[4*(permTet[k]-1)+1+i] = iel ? 4*permTet[iel/4]+iel%4 : 0;
+      }
+    }
+  }
+
+  /** Permute the points */
+  memcpy(buf,&mesh->point[1],(size_t)np*sizeof(MMG5_Point));
+  for ( k=1; k<=np; ++k ) {
+    mesh->point[permNod[k]] = ((MMG5_pPoint)buf)[k-1];
+  }
+
+  /** Update the boundary entities */
+  for ( k=1; k<=mesh->nt; ++k ) {
+    ptt = &mesh->tria[k];
+    for ( i=0; i<3; ++i ) {
+      ptt->v[i] = permNod[ptt->v[i]];
+    }
+    if ( ptt->cc ) ptt->cc = 4*permTet[ptt->cc/4]+ptt->cc%4;
+  }
+  for ( k=1; k<=mesh->na; ++k ) {
+    mesh->edge[k].a = permNod[mesh->edge[k].a];
+    mesh->edge[k].b = permNod[mesh->edge[k].b];
+  }
+
+  /** Permute the metric and the solutions */
+  PMMG_sfc_permuteSol(grp->met,np,permNod,(double*)buf);
+  PMMG_sfc_permuteSol(grp->ls,np,permNod,(double*)buf);
+  PMMG_sfc_permuteSol(grp->disp,np,permNod,(double*)buf);
+  for ( k=0; k<mesh->nsols; ++k ) {
+    PMMG_sfc_permuteSol(&grp->field[k],np,permNod,(double*)buf);
+  }
+
+  /** Update the communicators */
+  for ( k=0; k<grp->nitem_int_node_comm; ++k ) {
+    grp->node2int_node_comm_index1[k] = permNod[grp->node2int_node_comm_index1[k]];
+  }
+  for ( k=0; k<grp->nitem_int_face_comm; ++k ) {
+    idx = grp->face2int_face_comm_index1[k];
+    grp->face2int_face_comm_index1[k] = 12*permTet[idx/12]+idx%12;
+  }
+
+  PMMG_DEL_MEM(parmesh,buf,char,"sfc renumbering buffer");
+  PMMG_DEL_MEM(parmesh,permNod,int,"sfc point permutation");
+  PMMG_DEL_MEM(parmesh,permTet,int,"sfc tetra permutation");
+
+  return 1;
+
+fail:
+  PMMG_DEL_MEM(parmesh,buf,char,"sfc renumbering buffer");
+  PMMG_DEL_MEM(parmesh,permNod,int,"sfc point permutation");
+  PMMG_DEL_MEM(parmesh,permTet,int,"sfc tetra permutation");
+  PMMG_DEL_MEM(parmesh,list,PMMG_sfcItem,"sfc items");
+  return 0;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * \return 1 if success, 0 if the renumbering of a group has failed (the group
+ * keeps its numbering).
+ *
+ * Renumber the groups of the process along the Hilbert curve (see \ref
+ * PMMG_sfc_renumber_grp).
+ *
+ */
+int PMMG_sfc_renumber_grps( PMMG_pParMesh parmesh ) {
+  int igrp,ier;
+
+  ier = 1;
+  for ( igrp=0; igrp<parmesh->ngrp; ++igrp ) {
+    if ( !PMMG_sfc_renumber_grp(parmesh,igrp) ) ier = 0;
+  }
+
+  return ier;
+}
@@ -0,0 +1,58 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file sfc_pmmg.h
+ * \brief Geometric partitioning along a space filling curve.
+ * \copyright GNU Lesser General Public License.
+ */
+
+#ifndef SFC_PMMG_H
+
+#define SFC_PMMG_H
+
+#include "metis_pmmg.h"
+#include <stdint.h>
+
+/** Number of bits of the curve coordinates in each direction (the keys fit in
+ * 63 bits) */
+#define PMMG_SFC_KEYBITS 21
+
+/** \struct PMMG_sfcItem
+ *
+ * \brief Position of an element along the space filling curve
+ *
+ */
+typedef struct {
+  uint64_t key; /*!< Hilbert key of the element barycenter */
+  int      idx; /*!< element index */
+} PMMG_sfcItem;
+
+uint64_t PMMG_sfc_hilbertKey( const double c[3],const double min[3],double scale );
+double   PMMG_sfc_scale( const double min[3],const double max[3] );
+int      PMMG_sfc_compare( const void *a,const void *b );
+int      PMMG_part_meshElts2sfc( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc );
+int      PMMG_sfc_renumber_grp( PMMG_pParMesh parmesh,int igrp );
+int      PMMG_sfc_renumber_grps( PMMG_pParMesh parmesh );
+
+#endif
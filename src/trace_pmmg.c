@@ -0,0 +1,380 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file trace_pmmg.c
+ * \brief Per-process and per-phase performance trace.
+ * \copyright GNU Lesser General Public License.
+ *
+ * The timings and counts of the main phases of each process are recorded in
+ * memory and gathered on the root process at the end of the library call. The
+ * output file uses the Chrome trace event format (one event per line, the
+ * process rank being the event pid) and can be loaded in chrome://tracing or
+ * Perfetto, or filtered line by line. The trace is also used (without output
+ * file) to report the load imbalance of the phases in the auto-tuning mode.
+ *
+ */
+#include "parmmg.h"
+#include <inttypes.h>
+
+/** Max length of a formatted event */
+#define PMMG_TRACE_LINE 512
+
+/** Phase names in the trace file */
+static const char *PMMG_trace_phaseName[PMMG_TRACE_NPHASES] = {
+  "split","mmg","interpolation","load_balancing","analysis","merge","pack"
+};
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * \return the number of tetra of the process.
+ *
+ */
+static inline
+int64_t PMMG_trace_ne( PMMG_pParMesh parmesh ) {
+  int64_t ne;
+  int     k;
+
+  ne = 0;
+  for ( k=0; k<parmesh->ngrp; ++k ) {
+    if ( parmesh->listgrp[k].mesh ) ne += parmesh->listgrp[k].mesh->ne;
+  }
+  return ne;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Start a new trace if a trace file name has been provided or if the
+ * auto-tuning is enabled. Collective function (the processes are synchronized
+ * to share the reference time).
+ *
+ */
+int PMMG_trace_init( PMMG_pParMesh parmesh ) {
+  int ier;
+
+  if ( !parmesh->tracename && !parmesh->info.auto_tune ) return 1;
+
+  PMMG_trace_free( parmesh );
+
+  ier = 1;
+  PMMG_CALLOC(parmesh,parmesh->trace,1,PMMG_Trace,"trace",ier = 0);
+
+  MPI_CHECK( MPI_Barrier(parmesh->comm), ier = 0 );
+
+  if ( !ier ) {
+    fprintf(stderr,"\n  ## Warning: %s: rank %d: unable to initialize the"
+            " performance trace.\n",__func__,parmesh->myrank);
+    PMMG_trace_free( parmesh );
+    return 0;
+  }
+
+  parmesh->trace->t0 = MPI_Wtime();
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param phase phase to start.
+ *
+ * Record the start of a phase (nothing is done if the trace is disabled).
+ *
+ */
+void PMMG_trace_begin( PMMG_pParMesh parmesh,int phase ) {
+  PMMG_Trace *trace = parmesh->trace;
+
+  if ( !trace ) return;
+
+  assert ( phase >= 0 && phase < PMMG_TRACE_NPHASES );
+
+  trace->start[phase]     = MPI_Wtime();
+  trace->nein[phase]      = PMMG_trace_ne(parmesh);
+  trace->bytes0[phase]    = trace->bytes;
+  trace->nexhaust0[phase] = trace->nexhaust;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param phase phase to end.
+ *
+ * Record the end of a phase and store the event (nothing is done if the trace
+ * is disabled).
+ *
+ */
+void PMMG_trace_end( PMMG_pParMesh parmesh,int phase ) {
+  PMMG_Trace      *trace = parmesh->trace;
+  PMMG_traceEvent *ev;
+  double          t;
+  int             newsize;
+
+  if ( !trace ) return;
+
+  assert ( phase >= 0 && phase < PMMG_TRACE_NPHASES );
+
+  t = MPI_Wtime();
+
+  if ( trace->nevent == trace->nevent_max ) {
+    newsize = MG_MAX(2*trace->nevent_max,32);
+    PMMG_RECALLOC(parmesh,trace->event,newsize,trace->nevent_max,PMMG_traceEvent,
+                  "trace events",return);
+    trace->nevent_max = newsize;
+  }
+
+  ev = &trace->event[trace->nevent++];
+  ev->phase    = phase;
+  ev->iter     = parmesh->iter;
+  ev->start    = trace->start[phase] - trace->t0;
+  ev->dur      = t - trace->start[phase];
+  ev->nein     = trace->nein[phase];
+  ev->neout    = PMMG_trace_ne(parmesh);
+  ev->bytes    = trace->bytes - trace->bytes0[phase];
+  ev->nexhaust = trace->nexhaust - trace->nexhaust0[phase];
+
+  trace->iterdur[phase] += ev->dur;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param nbytes number of sent bytes.
+ *
+ * Count sent bytes in the open phases.
+ *
+ */
+void PMMG_trace_addBytes( PMMG_pParMesh parmesh,size_t nbytes ) {
+
+  if ( !parmesh->trace ) return;
+
+  parmesh->trace->bytes += nbytes;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param nexhaust number of exhaustive point localizations.
+ *
+ * Count exhaustive localizations in the open phases.
+ *
+ */
+void PMMG_trace_addExhaustive( PMMG_pParMesh parmesh,int nexhaust ) {
+
+  if ( !parmesh->trace ) return;
+
+  parmesh->trace->nexhaust += nexhaust;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Print the load imbalance (maximal over average time of the processes) of
+ * each phase since the last call, then reset the phase times. Collective
+ * function (nothing is done if neither the trace file nor the auto-tuning are
+ * enabled).
+ *
+ */
+int PMMG_trace_balance( PMMG_pParMesh parmesh ) {
+  double    dur[PMMG_TRACE_NPHASES],durmax[PMMG_TRACE_NPHASES];
+  double    dursum[PMMG_TRACE_NPHASES];
+  int       k;
+  const int root = parmesh->info.root;
+
+  if ( !parmesh->tracename && !parmesh->info.auto_tune ) return 1;
+
+  /* The trace may be missing on a process if its allocation has failed */
+  for ( k=0; k<PMMG_TRACE_NPHASES; ++k ) {
+    dur[k] = parmesh->trace ? parmesh->trace->iterdur[k] : 0.;
+    if ( parmesh->trace ) parmesh->trace->iterdur[k] = 0.;
+  }
+
+  MPI_CHECK( MPI_Reduce(dur,durmax,PMMG_TRACE_NPHASES,MPI_DOUBLE,MPI_MAX,root,
+                        parmesh->comm), return 0 );
+  MPI_CHECK( MPI_Reduce(dur,dursum,PMMG_TRACE_NPHASES,MPI_DOUBLE,MPI_SUM,root,
+                        parmesh->comm), return 0 );
+
+  if ( parmesh->myrank == root && parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
+    fprintf(stdout,"       load imbalance (max/avg):");
+    for ( k=0; k<PMMG_TRACE_NPHASES; ++k ) {
+      if ( dursum[k] <= 0. ) continue;
+      fprintf(stdout," %s %.2f",PMMG_trace_phaseName[k],
+              durmax[k]*parmesh->nprocs/dursum[k]);
+    }
+    fprintf(stdout,"\n");
+  }
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param buf pointer toward the allocated buffer (to fill).
+ *
+ * \return the length of the buffer, -1 if fail.
+ *
+ * Format the events of the process.
+ *
+ */
+static
+int PMMG_trace_format( PMMG_pParMesh parmesh,char **buf ) {
+  PMMG_Trace      *trace = parmesh->trace;
+  PMMG_traceEvent *ev;
+  size_t          size;
+  int             k,len;
+
+  *buf = NULL;
+
+  size = (size_t)PMMG_TRACE_LINE*((trace ? trace->nevent : 0) + 1);
+  if ( size > INT_MAX ) return -1;
+
+  PMMG_MALLOC(parmesh,*buf,size,char,"trace buffer",return -1);
+
+  /* Name the process after its rank */
+  len = snprintf(*buf,PMMG_TRACE_LINE,
+                 "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,"
+                 "\"args\":{\"name\":\"rank %d\"}},\n",
+                 parmesh->myrank,parmesh->myrank);
+
+  for ( k=0; trace && k<trace->nevent; ++k ) {
+    ev = &trace->event[k];
+    /* Chrome trace timestamps are in microseconds */
+    len += snprintf(*buf+len,PMMG_TRACE_LINE,
+                    "{\"name\":\"%s\",\"cat\":\"parmmg\",\"ph\":\"X\",\"pid\":%d,"
+                    "\"tid\":0,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"iter\":%d,"
+                    "\"ne_in\":%" PRId64 ",\"ne_out\":%" PRId64 ",\"bytes\":%" PRIu64
+                    ",\"exhaustive_locates\":%" PRId64 "}},\n",
+                    PMMG_trace_phaseName[ev->phase],parmesh->myrank,
+                    1.e6*ev->start,1.e6*ev->dur,ev->iter,ev->nein,ev->neout,
+                    ev->bytes,ev->nexhaust);
+  }
+
+  return len;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Gather the events of all the processes on the root one and write the trace
+ * file. Collective function (nothing is done if no trace file name has been
+ * provided). The trace is freed.
+ *
+ */
+int PMMG_trace_write( PMMG_pParMesh parmesh ) {
+  FILE      *inm;
+  char      *buf,*rcvbuf;
+  long long lentot,len_ll;
+  int       *lens,*displs,len,k,ier,iresult;
+  const int root = parmesh->info.root;
+
+  if ( !parmesh->tracename ) return 1;
+
+  buf = rcvbuf = NULL;
+  lens = displs = NULL;
+
+  len = PMMG_trace_format( parmesh,&buf );
+  ier = ( len >= 0 );
+  if ( !ier ) len = 0;
+
+  /* The gathered text is indexed by int */
+  len_ll = len;
+  MPI_CHECK( MPI_Allreduce(&len_ll,&lentot,1,MPI_LONG_LONG,MPI_SUM,parmesh->comm),
+             ier = 0 );
+  MPI_CHECK( MPI_Allreduce(&ier,&iresult,1,MPI_INT,MPI_MIN,parmesh->comm),
+             iresult = 0 );
+  if ( !iresult || lentot > INT_MAX ) {
+    if ( parmesh->myrank == root ) {
+      fprintf(stderr,"\n  ## Warning: %s: unable to gather the performance"
+              " trace.\n",__func__);
+    }
+    PMMG_DEL_MEM(parmesh,buf,char,"trace buffer");
+    PMMG_trace_free( parmesh );
+    return 0;
+  }
+
+  if ( parmesh->myrank == root ) {
+    PMMG_MALLOC(parmesh,lens,parmesh->nprocs,int,"trace lengths",ier = 0);
+    PMMG_MALLOC(parmesh,displs,parmesh->nprocs,int,"trace displs",ier = 0);
+    PMMG_MALLOC(parmesh,rcvbuf,lentot+1,char,"trace rcv buffer",ier = 0);
+  }
+  MPI_CHECK( MPI_Bcast(&ier,1,MPI_INT,root,parmesh->comm), ier = 0 );
+
+  if ( ier ) {
+    MPI_CHECK( MPI_Gather(&len,1,MPI_INT,lens,1,MPI_INT,root,parmesh->comm),
+               ier = 0 );
+    if ( parmesh->myrank == root ) {
+      displs[0] = 0;
+      for ( k=1; k<parmesh->nprocs; ++k ) {
+        displs[k] = displs[k-1] + lens[k-1];
+      }
+    }
+    MPI_CHECK( MPI_Gatherv(buf,len,MPI_CHAR,rcvbuf,lens,displs,MPI_CHAR,root,
+                           parmesh->comm), ier = 0 );
+  }
+
+  if ( ier && parmesh->myrank == root ) {
+    inm = fopen(parmesh->tracename,"w");
+    if ( !inm ) {
+      fprintf(stderr,"\n  ## Warning: %s: unable to open the trace file %s.\n",
+              __func__,parmesh->tracename);
+      ier = 0;
+    }
+    else {
+      fprintf(inm,"[\n");
+      fwrite(rcvbuf,sizeof(char),lentot,inm);
+      fprintf(inm,"{\"name\":\"trace_info\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,"
+              "\"args\":{\"nprocs\":%d,\"clock\":\"MPI_Wtime\"}}\n]\n",
+              root,parmesh->nprocs);
+      fclose(inm);
+      if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
+        fprintf(stdout,"  %%%% %s OPENED\n",parmesh->tracename);
+      }
+    }
+  }
+
+  PMMG_DEL_MEM(parmesh,rcvbuf,char,"trace rcv buffer");
+  PMMG_DEL_MEM(parmesh,displs,int,"trace displs");
+  PMMG_DEL_MEM(parmesh,lens,int,"trace lengths");
+  PMMG_DEL_MEM(parmesh,buf,char,"trace buffer");
+
+  PMMG_trace_free( parmesh );
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * Free the performance trace.
+ *
+ */
+void PMMG_trace_free( PMMG_pParMesh parmesh ) {
+
+  if ( !parmesh->trace ) return;
+
+  PMMG_DEL_MEM(parmesh,parmesh->trace->event,PMMG_traceEvent,"trace events");
+  PMMG_DEL_MEM(parmesh,parmesh->trace,PMMG_Trace,"trace");
+}
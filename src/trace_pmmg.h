@@ -0,0 +1,97 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file trace_pmmg.h
+ * \brief trace_pmmg.c header file
+ * \copyright GNU Lesser General Public License.
+ */
+
+#ifndef TRACE_PMMG_H
+
+#define TRACE_PMMG_H
+
+#include <stdint.h>
+
+/**
+ * \enum PMMG_tracePhase
+ * \brief Phases recorded in the performance trace.
+ */
+enum PMMG_tracePhase {
+  PMMG_TRACE_split,         /*!< Group splitting */
+  PMMG_TRACE_mmg,           /*!< Remeshing of the groups by Mmg */
+  PMMG_TRACE_interp,        /*!< Metrics and fields interpolation */
+  PMMG_TRACE_loadBalancing, /*!< Load balancing (groups redistribution) */
+  PMMG_TRACE_analys,        /*!< Mesh analysis */
+  PMMG_TRACE_merge,         /*!< Groups merging */
+  PMMG_TRACE_pack,          /*!< Mesh packing */
+  PMMG_TRACE_NPHASES
+};
+
+/**
+ * \struct PMMG_traceEvent
+ *
+ * \brief Timing and counts of one phase on one process.
+ *
+ */
+typedef struct {
+  int      phase;    /*!< traced phase (see \ref PMMG_tracePhase) */
+  int      iter;     /*!< adaptation iteration */
+  double   start;    /*!< beginning of the phase (s since the trace init) */
+  double   dur;      /*!< duration of the phase (s) */
+  int64_t  nein;     /*!< number of tetra at the beginning of the phase */
+  int64_t  neout;    /*!< number of tetra at the end of the phase */
+  uint64_t bytes;    /*!< bytes of packed meshes sent during the phase */
+  int64_t  nexhaust; /*!< number of exhaustive point localizations */
+} PMMG_traceEvent;
+
+/**
+ * \struct PMMG_Trace
+ *
+ * \brief Performance trace of the current process.
+ *
+ */
+typedef struct PMMG_Trace {
+  double          t0;     /*!< reference time */
+  double          start[PMMG_TRACE_NPHASES];    /*!< start of the open phases */
+  int64_t         nein[PMMG_TRACE_NPHASES];     /*!< tetra at the phases start */
+  uint64_t        bytes0[PMMG_TRACE_NPHASES];   /*!< bytes at the phases start */
+  int64_t         nexhaust0[PMMG_TRACE_NPHASES];/*!< locates at the phases start */
+  double          iterdur[PMMG_TRACE_NPHASES];  /*!< phases time since the last balance report */
+  uint64_t        bytes;    /*!< cumulated number of bytes sent */
+  int64_t         nexhaust; /*!< cumulated number of exhaustive localizations */
+  int             nevent;     /*!< number of recorded events */
+  int             nevent_max; /*!< size of the event array */
+  PMMG_traceEvent *event;     /*!< recorded events */
+} PMMG_Trace;
+
+int  PMMG_trace_init( PMMG_pParMesh parmesh );
+void PMMG_trace_begin( PMMG_pParMesh parmesh,int phase );
+void PMMG_trace_end( PMMG_pParMesh parmesh,int phase );
+void PMMG_trace_addBytes( PMMG_pParMesh parmesh,size_t nbytes );
+void PMMG_trace_addExhaustive( PMMG_pParMesh parmesh,int nexhaust );
+int  PMMG_trace_balance( PMMG_pParMesh parmesh );
+int  PMMG_trace_write( PMMG_pParMesh parmesh );
+void PMMG_trace_free( PMMG_pParMesh parmesh );
+
+#endif
@@ -287,6 +287,10 @@ int PMMG_Free_all_var(va_list argptr)
     }
   }
 
+  PMMG_trace_free( *parmesh );
+
+  PMMG_arena_free( *parmesh );
+
   PMMG_Free_names( *parmesh );
 
   PMMG_parmesh_Free_Comm( *parmesh );
@@ -126,6 +126,63 @@ int PMMG_parmesh_SetMemMax( PMMG_pParMesh parmesh ) {
   return 1;
 }
 
+/**
+ * \param parmesh parmesh structure
+ *
+ * \return 1 if success, 0 if fail
+ *
+ * Share the memory that is still available between the meshes of listgrp
+ * (proportionally to their current memory usage) so that they can be remeshed
+ * concurrently without exceeding the maximal memory allowed to the process.
+ * The \ref PMMG_parmesh_SetMemMax function restores the default values.
+ *
+ */
+int PMMG_parmesh_ShareMemMax( PMMG_pParMesh parmesh ) {
+  MMG5_pMesh mesh;
+  size_t     memUsed,memGrps,memAvail;
+  int        i;
+
+  /** Step 1: Compute the memory used by the parmesh, the groups and the old
+   * groups */
+  memUsed = parmesh->memCur;
+  memGrps = 0;
+  for( i = 0; i < parmesh->ngrp; ++i ) {
+    mesh = parmesh->listgrp[i].mesh;
+    if ( !mesh ) continue;
+    memGrps += mesh->memCur;
+  }
+  for( i = 0; parmesh->old_listgrp && i < parmesh->nold_grp; ++i ) {
+    mesh = parmesh->old_listgrp[i].mesh;
+    if ( !mesh ) continue;
+    memUsed += mesh->memCur;
+  }
+  memUsed += memGrps;
+
+  if ( memUsed >= parmesh->memGloMax ) {
+    fprintf(stderr,"\n  ## Warning: %s: no memory available to remesh the"
+            " groups concurrently (%zu MB used, %zu MB allowed).\n",__func__,
+            memUsed/MMG5_MILLION,parmesh->memGloMax/MMG5_MILLION);
+    return 0;
+  }
+  memAvail = parmesh->memGloMax - memUsed;
+
+  /** Step 2: Give to each group a share of the available memory */
+  for( i = 0; i < parmesh->ngrp; ++i ) {
+    mesh = parmesh->listgrp[i].mesh;
+    if ( !mesh ) continue;
+
+    if ( memGrps ) {
+      mesh->memMax = mesh->memCur +
+        (size_t)((double)memAvail*((double)mesh->memCur/(double)memGrps));
+    }
+    else {
+      mesh->memMax = memAvail/parmesh->ngrp;
+    }
+  }
+
+  return 1;
+}
+
 /**
  * \param mesh pointer toward the mesh structure
  * \param met pointer toward the metric structure